@@ -14,6 +14,8 @@
 #include "archival/logger.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
+#include "cloud_storage/remote_segment.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
 #include "cluster/partition_manager.h"
@@ -25,6 +27,7 @@
 #include "storage/fs_utils.h"
 #include "storage/parser.h"
 #include "utils/gate_guard.h"
+#include "utils/stream_utils.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/coroutine.hh>
@@ -374,9 +377,41 @@ ss::future<cloud_storage::upload_result> ntp_archiver::upload_manifest() {
     co_return co_await _remote.upload_manifest(_bucket, manifest(), fib);
 }
 
+namespace {
+
+/// Stream provider that feeds the uploaded data to the segment index
+/// builder. The builder reads from the same file as the upload, so the
+/// file is closed only after the builder is done with it.
+class indexing_stream_provider final : public storage::stream_provider {
+public:
+    indexing_stream_provider(
+      storage::segment_reader_handle handle,
+      ss::input_stream<char> upload,
+      ss::future<> parse)
+      : _handle(std::move(handle))
+      , _upload(std::move(upload))
+      , _parse(std::move(parse)) {}
+
+    ss::input_stream<char> take_stream() override {
+        return std::move(_upload);
+    }
+
+    ss::future<> close() override {
+        co_await std::move(_parse);
+        co_await _handle.close();
+    }
+
+private:
+    storage::segment_reader_handle _handle;
+    ss::input_stream<char> _upload;
+    ss::future<> _parse;
+};
+
+} // namespace
+
 // from offset to offset (by record batch boundary)
-ss::future<cloud_storage::upload_result>
-ntp_archiver::upload_segment(upload_candidate candidate) {
+ss::future<cloud_storage::upload_result> ntp_archiver::upload_segment(
+  upload_candidate candidate, model::offset_delta delta) {
     gate_guard guard{_gate};
     retry_chain_node fib(
       _segment_upload_timeout, _cloud_storage_initial_backoff, &_rtcnode);
@@ -387,13 +422,46 @@ ntp_archiver::upload_segment(upload_candidate candidate) {
 
     vlog(ctxlog.debug, "Uploading segment {} to {}", candidate, path);
 
+    // The offset index is built from the data which is uploaded. Every
+    // upload attempt re-reads the segment and starts a new index. Same
+    // parameters are used by the remote_segment when it builds the index
+    // during hydration.
+    delta = std::clamp(
+      delta, model::offset_delta(0), model::offset_delta::max());
+    std::optional<cloud_storage::offset_index> index;
+    bool index_built = false;
     auto reset_func =
-      [this,
-       candidate]() -> ss::future<std::unique_ptr<storage::stream_provider>> {
+      [this, candidate, delta, &index, &index_built, &ctxlog]()
+      -> ss::future<std::unique_ptr<storage::stream_provider>> {
+        index_built = false;
+        index.emplace(
+          candidate.starting_offset,
+          candidate.starting_offset - delta,
+          0,
+          cloud_storage::remote_segment_sampling_step_bytes);
         auto handle = co_await candidate.source->reader().data_stream(
           candidate.file_offset, candidate.final_file_offset, _io_priority);
-        co_return std::make_unique<storage::segment_reader_handle>(
-          std::move(handle));
+        auto [sparse, supload] = input_stream_fanout<2>(
+          handle.take_stream(), 1);
+        auto parser = cloud_storage::make_remote_segment_index_builder(
+          std::move(sparse),
+          *index,
+          delta,
+          cloud_storage::remote_segment_sampling_step_bytes);
+        auto fparse
+          = parser->consume()
+              .then([&index_built](auto res) {
+                  index_built = !res.has_error();
+              })
+              .handle_exception([&ctxlog](std::exception_ptr e) {
+                  vlog(
+                    ctxlog.debug,
+                    "Failed to build index of the uploaded segment: {}",
+                    e);
+              })
+              .finally([parser] { return parser->close(); });
+        co_return std::make_unique<indexing_stream_provider>(
+          std::move(handle), std::move(supload), std::move(fparse));
     };
 
     auto original_term = _partition->term();
@@ -416,13 +484,26 @@ ntp_archiver::upload_segment(upload_candidate candidate) {
           return lost_leadership;
       },
     };
-    co_return co_await _remote.upload_segment(
+    auto res = co_await _remote.upload_segment(
       _bucket,
       path,
       candidate.content_length,
       reset_func,
       fib,
       lazy_abort_source);
+    if (res != cloud_storage::upload_result::success) {
+        co_return res;
+    }
+    if (!index_built) {
+        // The segment is not added to the manifest, the next upload
+        // attempt will rebuild the index.
+        vlog(
+          ctxlog.warn,
+          "Failed to build index of the segment {}",
+          candidate.exposed_name);
+        co_return cloud_storage::upload_result::failed;
+    }
+    co_return co_await upload_index(path, std::move(*index), fib);
 }
 
 ss::future<cloud_storage::upload_result>
@@ -453,6 +534,21 @@ ntp_archiver::upload_tx(upload_candidate candidate) {
     co_return co_await _remote.upload_manifest(_bucket, manifest, fib);
 }
 
+ss::future<cloud_storage::upload_result> ntp_archiver::upload_index(
+  const cloud_storage::remote_segment_path& path,
+  cloud_storage::offset_index ix,
+  retry_chain_node& parent) {
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(archival_log, fib, _ntp.path());
+
+    cloud_storage::segment_index_manifest manifest(path, std::move(ix));
+    vlog(
+      ctxlog.debug,
+      "Uploading segment's index {}",
+      manifest.get_manifest_path());
+    co_return co_await _remote.upload_manifest(_bucket, manifest, fib);
+}
+
 ss::future<ntp_archiver::scheduled_upload> ntp_archiver::schedule_single_upload(
   model::offset start_upload_offset, model::offset last_stable_offset) {
     std::optional<storage::log> log = _partition_manager.log(_ntp);
@@ -548,9 +644,10 @@ ss::future<ntp_archiver::scheduled_upload> ntp_archiver::schedule_single_upload(
 
     auto segment_lock_deadline = std::chrono::steady_clock::now()
                                  + _segment_upload_timeout;
-    // The upload is successful only if both segment and tx_range are uploaded.
+    // The upload is successful only if the segment with its index and
+    // tx_range are uploaded.
     auto upl_fut
-      = ss::when_all(upload_segment(upload), upload_tx(upload))
+      = ss::when_all(upload_segment(upload, delta), upload_tx(upload))
           .then([](auto tup) {
               auto [fs, ftx] = std::move(tup);
               auto rs = fs.get();
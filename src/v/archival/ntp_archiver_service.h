@@ -14,6 +14,7 @@
 #include "archival/types.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/types.h"
 #include "cluster/fwd.h"
 #include "cluster/partition.h"
@@ -182,11 +183,13 @@ private:
     ss::future<ntp_archiver::batch_result> wait_all_scheduled_uploads(
       std::vector<ntp_archiver::scheduled_upload> scheduled);
 
-    /// Upload individual segment to S3.
+    /// Upload individual segment and its offset index to S3.
     ///
+    /// The index is built from the uploaded data, the upload fails if
+    /// the index can't be built or uploaded.
     /// \return error code
     ss::future<cloud_storage::upload_result>
-    upload_segment(upload_candidate candidate);
+    upload_segment(upload_candidate candidate, model::offset_delta delta);
 
     /// Upload segment's transactions metadata to S3.
     ///
@@ -194,6 +197,14 @@ private:
     ss::future<cloud_storage::upload_result>
     upload_tx(upload_candidate candidate);
 
+    /// Upload offset index of the segment to S3.
+    ///
+    /// \return error code
+    ss::future<cloud_storage::upload_result> upload_index(
+      const cloud_storage::remote_segment_path& path,
+      cloud_storage::offset_index ix,
+      retry_chain_node& parent);
+
     /// Upload manifest to the pre-defined S3 location
     ss::future<cloud_storage::upload_result> upload_manifest();
 
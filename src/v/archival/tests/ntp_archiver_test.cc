@@ -13,6 +13,8 @@
 #include "archival/tests/service_fixture.h"
 #include "bytes/iobuf.h"
 #include "cloud_storage/remote.h"
+#include "cloud_storage/remote_segment.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/types.h"
 #include "model/metadata.h"
 #include "net/unresolved_address.h"
@@ -123,7 +125,7 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
     for (auto [url, req] : get_targets()) {
         vlog(test_log.info, "{} {}", req._method, req._url);
     }
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 5);
 
     cloud_storage::partition_manifest manifest;
     {
@@ -156,6 +158,25 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
         verify_segment(manifest_ntp, segment2_name, req.content);
     }
 
+    for (const auto& [name, meta] : manifest) {
+        // Every uploaded segment should have an index next to it
+        auto index_url = cloud_storage::generate_remote_index_path(
+          manifest.generate_segment_path(name, meta));
+        auto it = get_targets().find("/" + index_url().string());
+        BOOST_REQUIRE(it != get_targets().end());
+        const auto& [url, req] = *it;
+        BOOST_REQUIRE_EQUAL(req._method, "PUT"); // NOLINT
+
+        cloud_storage::offset_index ix(
+          meta.base_offset,
+          meta.base_offset - meta.delta_offset,
+          0,
+          cloud_storage::remote_segment_sampling_step_bytes);
+        iobuf buf;
+        buf.append(req.content.data(), req.content.size());
+        ix.from_iobuf(std::move(buf));
+    }
+
     BOOST_REQUIRE(part->archival_meta_stm());
     const auto& stm_manifest = part->archival_meta_stm()->manifest();
     BOOST_REQUIRE_EQUAL(stm_manifest.size(), segments.size());
@@ -168,6 +189,56 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
     }
 }
 
+static constexpr std::string_view access_denied_payload
+  = R"xml(<?xml version="1.0" encoding="UTF-8"?>
+<Error>
+    <Code>AccessDenied</Code>
+    <Message>Access denied</Message>
+    <Resource>resource</Resource>
+    <RequestId>requestid</RequestId>
+</Error>)xml";
+
+// NOLINTNEXTLINE
+FIXTURE_TEST(test_upload_segments_index_failure, archiver_fixture) {
+    // Segment is not added to the manifest if its index can't be uploaded
+    fail_request_if(
+      [](const ss::httpd::request& req) {
+          return req._method == "PUT"
+                 && std::string_view(req._url).ends_with(".index");
+      },
+      http_test_utils::response{
+        .body = ss::sstring(access_denied_payload),
+        .status = ss::httpd::reply::status_type::forbidden});
+    listen();
+    auto [arch_conf, remote_conf] = get_configurations();
+    cloud_storage::remote remote(
+      remote_conf.connection_limit,
+      remote_conf.client_config,
+      remote_conf.cloud_credentials_source);
+
+    std::vector<segment_desc> segments = {
+      {manifest_ntp, model::offset(0), model::term_id(1)},
+      {manifest_ntp, model::offset(1000), model::term_id(4)},
+    };
+    init_storage_api_local(segments);
+    wait_for_partition_leadership(manifest_ntp);
+    auto part = app.partition_manager.local().get(manifest_ntp);
+    tests::cooperative_spin_wait_with_timeout(10s, [part]() mutable {
+        return part->high_watermark() >= model::offset(1);
+    }).get();
+
+    archival::ntp_archiver archiver(
+      get_ntp_conf(), app.partition_manager.local(), arch_conf, remote, part);
+    auto action = ss::defer([&archiver] { archiver.stop().get(); });
+
+    auto res = archiver.upload_next_candidates().get();
+    BOOST_REQUIRE_EQUAL(res.num_succeded, 0);
+    BOOST_REQUIRE_EQUAL(res.num_failed, 2);
+
+    BOOST_REQUIRE(part->archival_meta_stm());
+    BOOST_REQUIRE_EQUAL(part->archival_meta_stm()->manifest().size(), 0);
+}
+
 // NOLINTNEXTLINE
 FIXTURE_TEST(test_archiver_policy, archiver_fixture) {
     model::offset lso{9999};
@@ -578,7 +649,7 @@ FIXTURE_TEST(test_upload_segments_leadership_transfer, archiver_fixture) {
     for (auto req : get_requests()) {
         vlog(test_log.info, "{} {}", req._method, req._url);
     }
-    BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
+    BOOST_REQUIRE_EQUAL(get_requests().size(), 5);
 
     cloud_storage::partition_manifest manifest;
     {
@@ -806,7 +877,7 @@ static void test_partial_upload_impl(
     BOOST_REQUIRE_EQUAL(res.num_failed, 0);
 
     test_server.log_requests();
-    BOOST_REQUIRE_EQUAL(test_server.get_requests().size(), 2);
+    BOOST_REQUIRE_EQUAL(test_server.get_requests().size(), 3);
 
     {
         auto [begin, end] = test_server.get_targets().equal_range(manifest_url);
@@ -840,7 +911,7 @@ static void test_partial_upload_impl(
     BOOST_REQUIRE_EQUAL(res.num_failed, 0);
 
     test_server.log_requests();
-    BOOST_REQUIRE_EQUAL(test_server.get_requests().size(), 4);
+    BOOST_REQUIRE_EQUAL(test_server.get_requests().size(), 6);
     {
         auto [begin, end] = test_server.get_targets().equal_range(manifest_url);
         size_t len = std::distance(begin, end);
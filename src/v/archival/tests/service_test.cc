@@ -168,8 +168,8 @@ FIXTURE_TEST(test_segment_upload, archiver_fixture) {
     service.reconcile_archivers().get();
     BOOST_REQUIRE(service.contains(ntp));
 
-    // 1 topic manifest, 1 partition manifest, 2 segments
-    const size_t num_requests_expected = 4;
+    // 1 topic manifest, 1 partition manifest, 2 segments, 2 segment indexes
+    const size_t num_requests_expected = 6;
     tests::cooperative_spin_wait_with_timeout(10s, [this] {
         return get_requests().size() == num_requests_expected;
     }).get();
@@ -52,7 +52,7 @@ public:
        66432,
        99648,
        131072});
-    static size_t next_allocation_size(size_t data_size);
+    static constexpr size_t next_allocation_size(size_t data_size);
 
     // Pick next allocation size for when the total remaining data size is
     // known, e.g. in an iobuf copy operation.
@@ -75,7 +75,7 @@ public:
 // - try to not exceed max_chunk_size
 // - must be enough for data_size
 // - uses folly::vector of 1.5 growth without using double conversions
-inline size_t io_allocation_size::next_allocation_size(size_t data_size) {
+constexpr size_t io_allocation_size::next_allocation_size(size_t data_size) {
     // size_t next_size = ((_next_alloc_sz * 3) + 1) / 2;
     if (data_size > alloc_table.back()) {
         return alloc_table.back();
@@ -39,6 +39,10 @@ public:
     ~io_fragment() noexcept = default;
 #pragma GCC diagnostic pop
 
+    /// fragments are allocated from the per shard io_pool
+    static void* operator new(size_t);
+    static void operator delete(void*) noexcept;
+
     bool operator==(const io_fragment& o) const {
         return _used_bytes == o._used_bytes && _buf == o._buf;
     }
@@ -0,0 +1,176 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/details/io_allocation_size.h"
+#include "bytes/details/io_fragment.h"
+#include "seastarx.h"
+#include "vassert.h"
+
+#include <seastar/core/deleter.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace details {
+
+struct io_pool_stats {
+    /// served by the allocator
+    uint64_t allocations{0};
+    /// served from the pool
+    uint64_t reuses{0};
+};
+
+/// Free list of memory blocks of a fixed size. Keeps up to `max_cached`
+/// released blocks, the rest is returned to the allocator.
+template<size_t BlockSize>
+class io_free_list {
+    struct node {
+        node* next;
+    };
+    static_assert(BlockSize >= sizeof(node));
+
+public:
+    constexpr explicit io_free_list(size_t max_cached) noexcept
+      : _max_cached(max_cached) {}
+
+    void* allocate() {
+        if (_head) {
+            auto n = _head;
+            _head = n->next;
+            --_cached;
+            ++_stats.reuses;
+            return n;
+        }
+        ++_stats.allocations;
+        return ::operator new(BlockSize);
+    }
+
+    void deallocate(void* p) noexcept {
+        if (_cached < _max_cached) {
+            _head = new (p) node{.next = _head};
+            ++_cached;
+            return;
+        }
+        ::operator delete(p);
+    }
+
+    void set_max_cached(size_t max_cached) noexcept {
+        _max_cached = max_cached;
+        while (_cached > _max_cached) {
+            auto n = _head;
+            _head = n->next;
+            --_cached;
+            ::operator delete(n);
+        }
+    }
+
+    size_t cached() const noexcept { return _cached; }
+    const io_pool_stats& stats() const noexcept { return _stats; }
+
+private:
+    node* _head{nullptr};
+    size_t _cached{0};
+    size_t _max_cached;
+    io_pool_stats _stats;
+};
+
+/**
+ * \brief Per shard cache of the memory used by iobufs.
+ *
+ * Every iobuf fragment takes two allocations: the fragment descriptor and the
+ * buffer it points to. Small messages (request headers, small records, rpc
+ * envelopes) are the bulk of what is encoded and parsed, they are created and
+ * destroyed at a high rate and almost all of them fit into the first chunk
+ * of an iobuf. The pool recycles the fragment descriptors and the buffers of
+ * the first chunk size, so in steady state building and dropping such an
+ * iobuf doesn't hit the allocator at all.
+ *
+ * The buffers are owned by a seastar deleter that returns them to the pool,
+ * so sharing them is free (no deleter has to be allocated on the first share
+ * as it happens for buffers released with free()) and a buffer that is still
+ * shared when its fragment goes away stays alive.
+ *
+ * Memory returned on a different shard than it was allocated on is cached by
+ * the shard that released it. Caching is disabled with the default allocator
+ * so that the sanitizers keep tracking every allocation.
+ */
+class io_pool {
+public:
+    /// Size of the first chunk allocated by an iobuf
+    static constexpr size_t chunk_size
+      = io_allocation_size::next_allocation_size(
+        io_allocation_size::default_chunk_size);
+
+#ifdef SEASTAR_DEFAULT_ALLOCATOR
+    static constexpr size_t default_max_cached_fragments = 0;
+    static constexpr size_t default_max_cached_chunks = 0;
+#else
+    static constexpr size_t default_max_cached_fragments = 4096;
+    static constexpr size_t default_max_cached_chunks = 512;
+#endif
+
+    static io_pool& local() noexcept { return _local; }
+
+    void* allocate_fragment() { return _fragments.allocate(); }
+    void deallocate_fragment(void* p) noexcept { _fragments.deallocate(p); }
+
+    /// Buffer of chunk_size bytes
+    ss::temporary_buffer<char> allocate_chunk() {
+        auto c = new chunk();
+        return ss::temporary_buffer<char>(
+          c->data, chunk_size, ss::deleter(c));
+    }
+
+    /// Change the number of the cached fragments and chunks, 0 disables the
+    /// caching
+    void set_max_cached(size_t fragments, size_t chunks) noexcept {
+        _fragments.set_max_cached(fragments);
+        _chunks.set_max_cached(chunks);
+    }
+
+    const io_pool_stats& fragment_stats() const noexcept {
+        return _fragments.stats();
+    }
+    const io_pool_stats& chunk_stats() const noexcept {
+        return _chunks.stats();
+    }
+
+private:
+    struct chunk final : ss::deleter::impl {
+        chunk()
+          : ss::deleter::impl(ss::deleter()) {}
+
+        static void* operator new(size_t size) {
+            vassert(size == sizeof(chunk), "unexpected chunk size {}", size);
+            return _local._chunks.allocate();
+        }
+        static void operator delete(void* p) noexcept {
+            _local._chunks.deallocate(p);
+        }
+
+        char data[chunk_size];
+    };
+
+    constexpr io_pool() noexcept = default;
+
+    io_free_list<sizeof(io_fragment)> _fragments{default_max_cached_fragments};
+    io_free_list<sizeof(chunk)> _chunks{default_max_cached_chunks};
+
+    static thread_local io_pool _local;
+};
+
+inline thread_local io_pool io_pool::_local;
+
+} // namespace details
@@ -10,6 +10,7 @@
 #include "bytes/iobuf.h"
 
 #include "bytes/details/io_allocation_size.h"
+#include "bytes/details/io_pool.h"
 #include "vassert.h"
 
 #include <seastar/core/bitops.hh>
@@ -21,6 +22,15 @@
 #include <iostream>
 #include <limits>
 
+void* details::io_fragment::operator new(size_t size) {
+    vassert(size == sizeof(io_fragment), "unexpected fragment size {}", size);
+    return io_pool::local().allocate_fragment();
+}
+
+void details::io_fragment::operator delete(void* p) noexcept {
+    io_pool::local().deallocate_fragment(p);
+}
+
 std::ostream& operator<<(std::ostream& o, const iobuf& io) {
     return o << "{bytes=" << io.size_bytes()
              << ", fragments=" << std::distance(io.cbegin(), io.cend()) << "}";
@@ -15,6 +15,7 @@
 #include "bytes/details/io_fragment.h"
 #include "bytes/details/io_iterator_consumer.h"
 #include "bytes/details/io_placeholder.h"
+#include "bytes/details/io_pool.h"
 #include "bytes/details/out_of_range.h"
 #include "likely.h"
 #include "oncore.h"
@@ -58,6 +59,9 @@ class iobuf {
     // -----------------------
     //
     // 48 bytes total
+    //
+    // Fragments and the first chunk of an iobuf are recycled by the per shard
+    // details::io_pool.
 
 public:
     using fragment = details::io_fragment;
@@ -238,7 +242,11 @@ inline void iobuf::create_new_fragment(size_t sz) {
     oncore_debug_verify(_verify_shard);
     auto chunk_max = std::max(sz, last_allocation_size());
     auto asz = details::io_allocation_size::next_allocation_size(chunk_max);
-    auto f = new fragment(ss::temporary_buffer<char>(asz), fragment::empty{});
+    // the smallest chunks make up most small messages and are recycled
+    auto buf = asz == details::io_pool::chunk_size
+                 ? details::io_pool::local().allocate_chunk()
+                 : ss::temporary_buffer<char>(asz);
+    auto f = new fragment(std::move(buf), fragment::empty{});
     append_take_ownership(f);
 }
 inline iobuf::placeholder iobuf::reserve(size_t sz) {
@@ -0,0 +1,83 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/details/io_pool.h"
+#include "bytes/iobuf.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <array>
+
+// The benchmarks return the number of records, so the reported allocations
+// are per produced record. The no_pool variants disable caching of the iobuf
+// memory, which is how every fragment was allocated before the pool.
+
+namespace {
+
+constexpr size_t records = 1000;
+constexpr std::array<char, 16> key{};
+constexpr std::array<char, 100> value{};
+
+struct no_pool {
+    no_pool() { details::io_pool::local().set_max_cached(0, 0); }
+    ~no_pool() {
+        details::io_pool::local().set_max_cached(
+          details::io_pool::default_max_cached_fragments,
+          details::io_pool::default_max_cached_chunks);
+    }
+};
+
+/// Records are parsed into small iobufs and then appended to a batch
+size_t produce_records() {
+    perf_tests::start_measuring_time();
+    iobuf batch;
+    for (size_t i = 0; i < records; ++i) {
+        iobuf k;
+        k.append(key.data(), key.size());
+        iobuf v;
+        v.append(value.data(), value.size());
+        batch.append(std::move(k));
+        batch.append(std::move(v));
+    }
+    perf_tests::do_not_optimize(batch);
+    perf_tests::stop_measuring_time();
+    return records;
+}
+
+/// Every record of the request is kept as a slice sharing the request buffer
+size_t share_records() {
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < records; ++i) {
+        iobuf request;
+        request.append(key.data(), key.size());
+        request.append(value.data(), value.size());
+        auto k = request.share(0, key.size());
+        auto v = request.share(key.size(), value.size());
+        perf_tests::do_not_optimize(k);
+        perf_tests::do_not_optimize(v);
+    }
+    perf_tests::stop_measuring_time();
+    return records;
+}
+
+} // namespace
+
+PERF_TEST(iobuf_pool, produce_records) { return produce_records(); }
+
+PERF_TEST(iobuf_no_pool, produce_records) {
+    no_pool np;
+    return produce_records();
+}
+
+PERF_TEST(iobuf_pool, share_records) { return share_records(); }
+
+PERF_TEST(iobuf_no_pool, share_records) {
+    no_pool np;
+    return share_records();
+}
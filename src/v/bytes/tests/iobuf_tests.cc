@@ -9,6 +9,7 @@
 
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "bytes/details/io_pool.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_istreambuf.h"
 #include "bytes/iobuf_ostreambuf.h"
@@ -672,3 +673,43 @@ SEASTAR_THREAD_TEST_CASE(iobuf_is_zero_test) {
     zero.append(zeros.data(), zeros.size());
     BOOST_REQUIRE_EQUAL(is_zero(zero), true);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_pool_recycles_small_fragments) {
+    auto& pool = details::io_pool::local();
+    pool.set_max_cached(16, 16);
+    {
+        iobuf buf;
+        buf.append("a", 1);
+    }
+
+    const auto fragments = pool.fragment_stats();
+    const auto chunks = pool.chunk_stats();
+    {
+        iobuf buf;
+        buf.append("a", 1);
+        BOOST_REQUIRE_EQUAL(
+          buf.begin()->capacity(), details::io_pool::chunk_size);
+    }
+    BOOST_REQUIRE_EQUAL(
+      pool.fragment_stats().allocations, fragments.allocations);
+    BOOST_REQUIRE_EQUAL(pool.fragment_stats().reuses, fragments.reuses + 1);
+    BOOST_REQUIRE_EQUAL(pool.chunk_stats().allocations, chunks.allocations);
+    BOOST_REQUIRE_EQUAL(pool.chunk_stats().reuses, chunks.reuses + 1);
+
+    // a shared chunk outlives the iobuf it was allocated for
+    iobuf shared;
+    {
+        iobuf buf;
+        buf.append("redpanda", 8);
+        shared = buf.share(0, 3);
+    }
+    {
+        iobuf buf;
+        buf.append("zzzzzzzz", 8);
+    }
+    BOOST_REQUIRE(shared == std::string_view("red"));
+
+    pool.set_max_cached(
+      details::io_pool::default_max_cached_fragments,
+      details::io_pool::default_max_cached_chunks);
+}
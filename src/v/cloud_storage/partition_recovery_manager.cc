@@ -43,6 +43,7 @@
 #include <seastar/core/smp.hh>
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
 #include <absl/container/btree_map.h>
@@ -78,7 +79,12 @@ private:
 partition_recovery_manager::partition_recovery_manager(
   s3::bucket_name bucket, ss::sharded<remote>& remote)
   : _bucket(std::move(bucket))
-  , _remote(remote) {}
+  , _remote(remote)
+  , _max_concurrent_downloads(std::max<int16_t>(
+      config::shard_local_cfg()
+        .cloud_storage_max_concurrent_recovery_downloads(),
+      1))
+  , _download_units(_max_concurrent_downloads) {}
 
 partition_recovery_manager::~partition_recovery_manager() {
     vassert(_gate.is_closed(), "S3 downloader is not stopped properly");
@@ -87,6 +93,7 @@ partition_recovery_manager::~partition_recovery_manager() {
 ss::future<> partition_recovery_manager::stop() {
     vlog(cst_log.debug, "Stopping partition_recovery_manager");
     _as.request_abort();
+    _download_units.broken();
     return _gate.close();
 }
 
@@ -115,8 +122,17 @@ ss::future<log_recovery_result> partition_recovery_manager::download_log(
       _bucket,
       _gate,
       _root,
-      _as);
-    co_return co_await downloader.download_log();
+      _as,
+      _download_units,
+      _max_concurrent_downloads,
+      _probe);
+    _probe.partition_started();
+    auto deferred = ss::defer([this] { _probe.partition_finished(); });
+    auto result = co_await downloader.download_log();
+    if (result.completed) {
+        _probe.partition_recovered();
+    }
+    co_return result;
 }
 
 partition_downloader::partition_downloader(
@@ -127,7 +143,10 @@ partition_downloader::partition_downloader(
   s3::bucket_name bucket,
   ss::gate& gate_root,
   retry_chain_node& parent,
-  storage::opt_abort_source_t as)
+  storage::opt_abort_source_t as,
+  ss::semaphore& download_units,
+  size_t max_concurrency,
+  recovery_probe& probe)
   : _ntpc(ntpc)
   , _bucket(std::move(bucket))
   , _remote(remote)
@@ -139,7 +158,10 @@ partition_downloader::partition_downloader(
       cst_log,
       _rtcnode,
       ssx::sformat("[{}, rev: {}]", ntpc.ntp().path(), ntpc.get_revision()))
-  , _as(as) {}
+  , _as(as)
+  , _download_units(download_units)
+  , _max_concurrency(max_concurrency)
+  , _probe(probe) {}
 
 ss::future<log_recovery_result> partition_downloader::download_log() {
     vlog(_ctxlog.debug, "Check conditions for S3 recovery for {}", _ntpc);
@@ -170,6 +192,8 @@ ss::future<log_recovery_result> partition_downloader::download_log() {
         throw;
     } catch (const ss::gate_closed_exception&) {
         throw;
+    } catch (const ss::broken_semaphore&) {
+        throw;
     } catch (...) {
         // We can get here if the parttion manifest is missing (or some
         // other failure is preventing us from recovering the partition). In
@@ -392,7 +416,6 @@ partition_downloader::download_log_with_capped_size(
       start_offset,
       start_delta);
 
-    std::vector<offset_range> dloffsets;
     download_part dlpart{
       .part_prefix = std::filesystem::path(prefix.string() + "_part"),
       .dest_prefix = prefix,
@@ -402,30 +425,7 @@ partition_downloader::download_log_with_capped_size(
         .max_offset = model::offset::min(),
       }};
 
-    co_await ss::max_concurrent_for_each(
-      staged_downloads,
-      max_concurrency,
-      [this, _dlpart{&dlpart}, _dloffsets{&dloffsets}](
-        const segment& s) -> ss::future<> {
-          auto& dloffsets{*_dloffsets};
-          auto& dlpart{*_dlpart};
-          retry_chain_node fib(&_rtcnode);
-          retry_chain_logger dllog(cst_log, fib);
-          vlog(
-            dllog.debug,
-            "Starting download, base-offset: {}, term: {}, size: {}, fs "
-            "prefix: {}, "
-            "destination: {}",
-            s.manifest_key.base_offset,
-            s.manifest_key.term,
-            s.meta.size_bytes,
-            dlpart.part_prefix,
-            dlpart.dest_prefix);
-          auto offsets = co_await download_segment_file(s, dlpart);
-          if (offsets) {
-              dloffsets.push_back(offsets.value());
-          }
-      });
+    auto dloffsets = co_await download_segments(staged_downloads, dlpart);
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     if (dlpart.num_files == 0) {
         // The segments didn't have data batches
@@ -487,7 +487,6 @@ partition_downloader::download_log_with_capped_time(
       "start_delta: {}",
       start_offset,
       start_delta);
-    std::vector<offset_range> dloffsets;
     download_part dlpart = {
       .part_prefix = std::filesystem::path(prefix.string() + "_part"),
       .dest_prefix = prefix,
@@ -497,36 +496,68 @@ partition_downloader::download_log_with_capped_time(
         .max_offset = model::offset::min(),
       }};
 
+    auto dloffsets = co_await download_segments(staged_downloads, dlpart);
+    update_downloaded_offsets(std::move(dloffsets), dlpart);
+    if (dlpart.num_files == 0) {
+        // The segments didn't have data batches
+        vlog(_ctxlog.debug, "Log segments didn't have data batches");
+        dlpart.range.min_offset = model::offset{0};
+        dlpart.range.max_offset = model::offset{0};
+    }
+    co_return dlpart;
+}
+
+ss::future<std::vector<partition_downloader::offset_range>>
+partition_downloader::download_segments(
+  const std::deque<segment>& staged_downloads, const download_part& part) {
+    std::vector<offset_range> dloffsets;
+    size_t num_started = 0;
+    _probe.segments_scheduled(staged_downloads.size());
+    auto deferred = ss::defer([this, &staged_downloads, &num_started] {
+        // Segments are not started if one of the downloads has failed
+        // with an exception or the shard is shutting down
+        _probe.segments_cancelled(staged_downloads.size() - num_started);
+    });
     co_await ss::max_concurrent_for_each(
       staged_downloads,
-      max_concurrency,
-      [this, _dlpart{&dlpart}, _dloffsets{&dloffsets}](
-        const segment& s) -> ss::future<> {
-          auto& dlpart{*_dlpart};
+      _max_concurrency,
+      [this,
+       _part{&part},
+       _dloffsets{&dloffsets},
+       _num_started{&num_started}](const segment& s) -> ss::future<> {
+          const auto& part{*_part};
           auto& dloffsets{*_dloffsets};
+          auto& num_started{*_num_started};
+          auto units = co_await ss::get_units(_download_units, 1);
+          ++num_started;
+          _probe.segment_started();
           retry_chain_node fib(&_rtcnode);
           retry_chain_logger dllog(cst_log, fib);
           vlog(
             dllog.debug,
-            "Starting download, base_offset: {}, term: {}, fs prefix: {}, "
-            "dest: {}",
+            "Starting download, base-offset: {}, term: {}, size: {}, fs "
+            "prefix: {}, "
+            "destination: {}",
             s.manifest_key.base_offset,
             s.manifest_key.term,
-            dlpart.part_prefix,
-            dlpart.dest_prefix);
-          auto offsets = co_await download_segment_file(s, dlpart);
+            s.meta.size_bytes,
+            part.part_prefix,
+            part.dest_prefix);
+          std::optional<offset_range> offsets;
+          try {
+              offsets = co_await download_segment_file(s, part);
+          } catch (...) {
+              _probe.segment_failed();
+              throw;
+          }
           if (offsets) {
+              _probe.segment_downloaded(s.meta.size_bytes);
               dloffsets.push_back(offsets.value());
+          } else {
+              _probe.segment_failed();
           }
       });
-    update_downloaded_offsets(std::move(dloffsets), dlpart);
-    if (dlpart.num_files == 0) {
-        // The segments didn't have data batches
-        vlog(_ctxlog.debug, "Log segments didn't have data batches");
-        dlpart.range.min_offset = model::offset{0};
-        dlpart.range.max_offset = model::offset{0};
-    }
-    co_return dlpart;
+    co_return dloffsets;
 }
 
 ss::future<partition_manifest>
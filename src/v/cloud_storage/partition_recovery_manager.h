@@ -11,6 +11,7 @@
 #pragma once
 
 #include "cloud_storage/offset_translation_layer.h"
+#include "cloud_storage/recovery_probe.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/types.h"
@@ -24,9 +25,11 @@
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/semaphore.hh>
 #include <seastar/core/sharded.hh>
 
 #include <compare>
+#include <deque>
 #include <iterator>
 #include <vector>
 
@@ -45,7 +48,14 @@ struct log_recovery_result {
 };
 
 /// Data recovery provider is used to download topic segments from S3 (or
-/// compatible storage) during topic re-creation process
+/// compatible storage) during topic re-creation process.
+///
+/// All partitions recovered on a shard share a single budget of concurrent
+/// segment downloads ('cloud_storage_max_concurrent_recovery_downloads').
+/// A partition is allowed to use the whole budget if other partitions are
+/// not competing for it, so restoring a single large partition and restoring
+/// thousands of small ones are both limited by the budget and not by the
+/// per-segment latency.
 class partition_recovery_manager {
 public:
     partition_recovery_manager(
@@ -76,20 +86,27 @@ public:
       model::initial_revision_id remote_revsion,
       int32_t remote_partition_count);
 
+    const recovery_probe& probe() const { return _probe; }
+
 private:
     s3::bucket_name _bucket;
     ss::sharded<remote>& _remote;
     ss::gate _gate;
     retry_chain_node _root;
     ss::abort_source _as;
+    size_t _max_concurrent_downloads;
+    ss::semaphore _download_units;
+    recovery_probe _probe;
 };
 
 /// Topic downloader is used to download topic segments from S3 (or compatible
 /// storage) during topic re-creation
 class partition_downloader {
-    static constexpr size_t max_concurrency = 1;
-
 public:
+    /// \param download_units is a semaphore shared by all downloaders
+    ///        on the shard, every segment download holds one unit
+    /// \param max_concurrency is a max number of segments downloaded
+    ///        concurrently by this downloader
     partition_downloader(
       const storage::ntp_config& ntpc,
       remote* remote,
@@ -98,7 +115,10 @@ public:
       s3::bucket_name bucket,
       ss::gate& gate_root,
       retry_chain_node& parent,
-      storage::opt_abort_source_t as);
+      storage::opt_abort_source_t as,
+      ss::semaphore& download_units,
+      size_t max_concurrency,
+      recovery_probe& probe);
 
     partition_downloader(const partition_downloader&) = delete;
     partition_downloader(partition_downloader&&) = delete;
@@ -171,6 +191,14 @@ private:
     ss::future<std::optional<offset_range>>
     download_segment_file(const segment& segm, const download_part& part);
 
+    /// Download all staged segments concurrently
+    ///
+    /// Every download has to acquire a unit from the shared semaphore
+    /// first. Offset ranges of the segments which were downloaded
+    /// successfully are returned.
+    ss::future<std::vector<offset_range>> download_segments(
+      const std::deque<segment>& staged_downloads, const download_part& part);
+
     using offset_map_t = absl::btree_map<model::offset, segment>;
 
     ss::future<offset_map_t> build_offset_map(const recovery_material& mat);
@@ -202,6 +230,9 @@ private:
     retry_chain_node _rtcnode;
     retry_chain_logger _ctxlog;
     storage::opt_abort_source_t _as;
+    ss::semaphore& _download_units;
+    size_t _max_concurrency;
+    recovery_probe& _probe;
 };
 
 } // namespace cloud_storage
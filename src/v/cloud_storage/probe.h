@@ -75,6 +75,22 @@ public:
         return _cnt_tx_manifest_downloads;
     }
 
+    /// Register segment index upload
+    void segment_index_upload() { _cnt_segment_index_uploads++; }
+
+    /// Get segment index uploads
+    uint64_t get_segment_index_uploads() const {
+        return _cnt_segment_index_uploads;
+    }
+
+    /// Register segment index download
+    void segment_index_download() { _cnt_segment_index_downloads++; }
+
+    /// Get segment index downloads
+    uint64_t get_segment_index_downloads() const {
+        return _cnt_segment_index_downloads;
+    }
+
     /// Register backof invocation during manifest upload
     void manifest_upload_backoff() { _cnt_manifest_upload_backoff++; }
 
@@ -186,6 +202,10 @@ private:
     uint64_t _cnt_tx_manifest_uploads{0};
     /// Number of tx-range manifest downloads
     uint64_t _cnt_tx_manifest_downloads{0};
+    /// Number of segment index uploads
+    uint64_t _cnt_segment_index_uploads{0};
+    /// Number of segment index downloads
+    uint64_t _cnt_segment_index_downloads{0};
 
     ss::metrics::metric_groups _metrics;
     ss::metrics::metric_groups _public_metrics;
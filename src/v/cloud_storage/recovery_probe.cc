@@ -0,0 +1,63 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/recovery_probe.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace cloud_storage {
+
+recovery_probe::recovery_probe() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cloud_storage:recovery"),
+      {
+        sm::make_counter(
+          "partitions_recovered",
+          [this] { return _num_partitions_recovered; },
+          sm::description("Total number of partitions recovered.")),
+        sm::make_counter(
+          "segments_downloaded",
+          [this] { return _num_segments_downloaded; },
+          sm::description("Total number of segments downloaded.")),
+        sm::make_counter(
+          "segments_failed",
+          [this] { return _num_segments_failed; },
+          sm::description("Total number of failed segment downloads.")),
+        sm::make_counter(
+          "bytes_downloaded",
+          [this] { return _num_bytes_downloaded; },
+          sm::description(
+            "Total number of bytes downloaded from the cloud storage.")),
+
+        sm::make_gauge(
+          "partitions_in_progress",
+          [this] { return _cur_partitions_in_progress; },
+          sm::description("Current number of partitions being recovered.")),
+        sm::make_gauge(
+          "segments_pending",
+          [this] { return _cur_segments_pending; },
+          sm::description(
+            "Current number of segments waiting for a download slot.")),
+        sm::make_gauge(
+          "segments_in_progress",
+          [this] { return _cur_segments_in_progress; },
+          sm::description("Current number of segments being downloaded.")),
+      });
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "model/fundamental.h"
+
+#include <seastar/core/metrics_registration.hh>
+
+#include <algorithm>
+
+namespace cloud_storage {
+
+/// Tracks progress of the topic recovery on a shard
+class recovery_probe {
+public:
+    recovery_probe();
+
+    void partition_started() { ++_cur_partitions_in_progress; }
+    void partition_finished() { --_cur_partitions_in_progress; }
+    void partition_recovered() { ++_num_partitions_recovered; }
+
+    void segments_scheduled(size_t n) { _cur_segments_pending += n; }
+    void segments_cancelled(size_t n) { _cur_segments_pending -= n; }
+    void segment_started() {
+        --_cur_segments_pending;
+        ++_cur_segments_in_progress;
+        _max_segments_in_progress = std::max(
+          _max_segments_in_progress, _cur_segments_in_progress);
+    }
+    void segment_downloaded(uint64_t size_bytes) {
+        --_cur_segments_in_progress;
+        ++_num_segments_downloaded;
+        _num_bytes_downloaded += size_bytes;
+    }
+    void segment_failed() {
+        --_cur_segments_in_progress;
+        ++_num_segments_failed;
+    }
+
+    /// Number of segment downloads which are holding download units
+    int64_t segments_in_progress() const { return _cur_segments_in_progress; }
+    /// Largest number of concurrent segment downloads seen on the shard
+    int64_t max_segments_in_progress() const {
+        return _max_segments_in_progress;
+    }
+
+private:
+    uint64_t _num_partitions_recovered = 0;
+    uint64_t _num_segments_downloaded = 0;
+    uint64_t _num_segments_failed = 0;
+    uint64_t _num_bytes_downloaded = 0;
+
+    int64_t _cur_partitions_in_progress = 0;
+    int64_t _cur_segments_pending = 0;
+    int64_t _cur_segments_in_progress = 0;
+    int64_t _max_segments_in_progress = 0;
+
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace cloud_storage
@@ -277,6 +277,9 @@ ss::future<download_result> remote::do_download_manifest(
             case manifest_type::tx_range:
                 _probe.txrange_manifest_download();
                 break;
+            case manifest_type::segment_index:
+                _probe.segment_index_download();
+                break;
             }
             co_return download_result::success;
         } catch (...) {
@@ -362,6 +365,9 @@ ss::future<upload_result> remote::upload_manifest(
             case manifest_type::tx_range:
                 _probe.txrange_manifest_upload();
                 break;
+            case manifest_type::segment_index:
+                _probe.segment_index_upload();
+                break;
             }
             _probe.register_upload_size(size);
             co_return upload_result::success;
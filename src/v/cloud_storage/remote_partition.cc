@@ -13,6 +13,7 @@
 #include "cloud_storage/logger.h"
 #include "cloud_storage/offset_translation_layer.h"
 #include "cloud_storage/remote_segment.h"
+#include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
@@ -1019,6 +1020,12 @@ ss::future<> remote_partition::erase() {
                   _bucket, s3::object_key(tx_range_manifest_path), local_rtc)) {
                 co_return;
             };
+
+            auto index_path = generate_remote_index_path(path);
+            if (co_await tolerant_delete_object(
+                  _bucket, s3::object_key(index_path), local_rtc)) {
+                co_return;
+            };
         }
 
         // Erase the partition manifest
@@ -261,10 +261,58 @@ remote_segment::maybe_get_offsets(kafka::offset kafka_offset) {
     return pos;
 }
 
+ss::future<bool> remote_segment::do_hydrate_index() {
+    if (_index_not_found) {
+        co_return false;
+    }
+    retry_chain_node local_rtc(
+      cache_hydration_timeout, cache_hydration_backoff, &_rtc);
+
+    segment_index_manifest ix(
+      _path,
+      offset_index(
+        get_base_rp_offset(),
+        get_base_kafka_offset(),
+        0,
+        remote_segment_sampling_step_bytes));
+
+    auto res = co_await _api.maybe_download_manifest(
+      _bucket, ix.get_manifest_path(), ix, local_rtc);
+
+    if (res != download_result::success) {
+        // Segments uploaded by older versions don't have an index, in this
+        // case it will be built while the segment is hydrated.
+        _index_not_found = res == download_result::notfound;
+        vlog(
+          _ctxlog.debug,
+          "segment index {} is not available ({}), it will be built from "
+          "the segment data",
+          ix.get_manifest_path(),
+          res);
+        co_return false;
+    }
+
+    auto [stream, size] = ix.serialize();
+    co_await _cache.put(ix.get_manifest_path(), stream)
+      .finally([&s = stream]() mutable { return s.close(); });
+
+    _index = std::move(ix).get_index();
+    co_return true;
+}
+
 ss::future<> remote_segment::do_hydrate_segment() {
-    auto callback = [this](
+    bool has_index = _index.has_value() || co_await do_hydrate_index();
+
+    auto callback = [this, has_index](
                       uint64_t size_bytes,
                       ss::input_stream<char> s) -> ss::future<uint64_t> {
+        if (has_index) {
+            // The index was uploaded alongside the segment, no need to parse
+            // the segment to build it.
+            co_await _cache.put(_path, s).finally(
+              [&s]() mutable { return s.close(); });
+            co_return size_bytes;
+        }
         offset_index tmpidx(
           get_base_rp_offset(),
           get_base_kafka_offset(),
@@ -143,6 +143,10 @@ private:
     /// Actually hydrate the segment. The method downloads the segment file
     /// to the cache dir and updates the segment index.
     ss::future<> do_hydrate_segment();
+    /// Hydrate segment index uploaded alongside the segment. The method
+    /// downloads the index to the cache dir and materializes it. Returns
+    /// false if the index is not available in the bucket.
+    ss::future<bool> do_hydrate_index();
     /// Hydrate tx manifest. Method downloads the manifest file to the cache
     /// dir.
     ss::future<> do_hydrate_txrange();
@@ -179,6 +183,9 @@ private:
 
     ss::file _data_file;
     std::optional<offset_index> _index;
+    /// Set if the bucket doesn't have the index of the segment, no need
+    /// to look for it again when the segment is re-hydrated
+    bool _index_not_found{false};
 
     using tx_range_vec = fragmented_vector<model::tx_range>;
     std::optional<tx_range_vec> _tx_range;
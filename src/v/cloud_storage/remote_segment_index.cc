@@ -10,11 +10,15 @@
 
 #include "cloud_storage/remote_segment_index.h"
 
+#include "bytes/iobuf.h"
 #include "model/record_batch_types.h"
 #include "serde/envelope.h"
 #include "serde/serde.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/iostream.hh>
+
 namespace cloud_storage {
 
 offset_index::offset_index(
@@ -194,7 +198,7 @@ struct offset_index_header
     iobuf file_index;
 };
 
-iobuf offset_index::to_iobuf() {
+iobuf offset_index::to_iobuf() const {
     offset_index_header hdr{
       .min_file_pos_step = _min_file_pos_step,
       .num_elements = _pos,
@@ -264,6 +268,37 @@ offset_index::_find_under(deltafor_decoder<int64_t> decoder, int64_t offset) {
     return candidate;
 }
 
+remote_manifest_path
+generate_remote_index_path(const remote_segment_path& path) {
+    return remote_manifest_path(fmt::format("{}.index", path().native()));
+}
+
+segment_index_manifest::segment_index_manifest(
+  remote_segment_path spath, offset_index ix)
+  : _path(std::move(spath))
+  , _index(std::move(ix)) {}
+
+ss::future<> segment_index_manifest::update(ss::input_stream<char> is) {
+    iobuf result;
+    auto os = make_iobuf_ref_output_stream(result);
+    co_await ss::copy(is, os).finally([&is, &os]() mutable {
+        return is.close().finally([&os]() mutable { return os.close(); });
+    });
+    _index.from_iobuf(std::move(result));
+}
+
+serialized_json_stream segment_index_manifest::serialize() const {
+    auto serialized = _index.to_iobuf();
+    size_t size_bytes = serialized.size_bytes();
+    return {
+      .stream = make_iobuf_input_stream(std::move(serialized)),
+      .size_bytes = size_bytes};
+}
+
+remote_manifest_path segment_index_manifest::get_manifest_path() const {
+    return generate_remote_index_path(_path);
+}
+
 remote_segment_index_builder::remote_segment_index_builder(
   offset_index& ix, model::offset_delta initial_delta, size_t sampling_step)
   : _ix(ix)
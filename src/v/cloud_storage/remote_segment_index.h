@@ -12,6 +12,8 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
+#include "cloud_storage/base_manifest.h"
+#include "cloud_storage/types.h"
 #include "model/fundamental.h"
 #include "seastarx.h"
 #include "storage/parser.h"
@@ -79,7 +81,7 @@ public:
     std::optional<find_result> find_kaf_offset(kafka::offset upper_bound);
 
     /// Serialize offset_index
-    iobuf to_iobuf();
+    iobuf to_iobuf() const;
 
     /// Deserialize offset_index
     void from_iobuf(iobuf in);
@@ -148,6 +150,43 @@ private:
     int64_t _min_file_pos_step;
 };
 
+/// Segment index path in S3
+remote_manifest_path
+generate_remote_index_path(const remote_segment_path& path);
+
+/// Offset index of the segment stored in S3 alongside the segment
+///
+/// The index is built by the archiver when the segment is uploaded
+/// (with '.index' suffix added to the segment name). The readers can
+/// download it instead of parsing the whole segment after hydration.
+/// The index is optional, if it's not available the reader should
+/// build it from the segment data.
+class segment_index_manifest final : public base_manifest {
+public:
+    segment_index_manifest(remote_segment_path spath, offset_index ix);
+
+    /// Update index from input_stream (remote set)
+    ss::future<> update(ss::input_stream<char> is) override;
+
+    /// Serialize index object
+    ///
+    /// \return asynchronous input_stream with the serialized index
+    serialized_json_stream serialize() const override;
+
+    /// Index object name in S3
+    remote_manifest_path get_manifest_path() const override;
+
+    manifest_type get_manifest_type() const override {
+        return manifest_type::segment_index;
+    };
+
+    offset_index&& get_index() && { return std::move(_index); }
+
+private:
+    remote_segment_path _path;
+    offset_index _index;
+};
+
 class remote_segment_index_builder : public storage::batch_consumer {
 public:
     using consume_result = storage::batch_consumer::consume_result;
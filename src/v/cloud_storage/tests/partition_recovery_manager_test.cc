@@ -0,0 +1,176 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/partition_recovery_manager.h"
+#include "cloud_storage/remote.h"
+#include "cloud_storage/tests/cloud_storage_fixture.h"
+#include "cloud_storage/tests/common_def.h"
+#include "cloud_storage/tests/s3_imposter.h"
+#include "cloud_storage/types.h"
+#include "config/configuration.h"
+#include "model/metadata.h"
+#include "model/tests/random_batch.h"
+#include "storage/ntp_config.h"
+#include "storage/segment_appender_utils.h"
+#include "test_utils/fixture.h"
+#include "tristate.h"
+
+#include <seastar/core/loop.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/util/defer.hh>
+
+#include <boost/range/irange.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+#include <limits>
+#include <vector>
+
+using namespace cloud_storage;
+
+static constexpr model::cloud_credentials_source config_file{
+  model::cloud_credentials_source::config_file};
+
+struct recovery_segment {
+    ss::sstring bytes;
+    model::offset base_offset;
+    model::offset last_offset;
+};
+
+static recovery_segment
+make_recovery_segment(model::offset base, int num_batches) {
+    auto batches = model::test::make_random_batches(base, num_batches, false);
+    iobuf body;
+    for (auto&& batch : batches) {
+        body.append(storage::disk_header_to_iobuf(batch.header()));
+        body.append(iobuf_deep_copy(batch.data()));
+    }
+    auto size = body.size_bytes();
+    iobuf_parser parser(std::move(body));
+    return recovery_segment{
+      .bytes = parser.read_string(size),
+      .base_offset = batches.front().base_offset(),
+      .last_offset = batches.back().last_offset(),
+    };
+}
+
+/// Add the manifest and the segments of one partition to the expectations,
+/// returns the last offset of the partition
+static model::offset add_partition_expectations(
+  const model::ntp& ntp,
+  int num_segments,
+  std::vector<cloud_storage_fixture::expectation>& expectations) {
+    partition_manifest manifest(ntp, manifest_revision);
+    model::offset base{0};
+    for (int i = 0; i < num_segments; i++) {
+        auto s = make_recovery_segment(base, 2);
+        partition_manifest::segment_meta meta{
+          .is_compacted = false,
+          .size_bytes = s.bytes.size(),
+          .base_offset = s.base_offset,
+          .committed_offset = s.last_offset,
+          .base_timestamp = {},
+          .max_timestamp = {},
+          .delta_offset = model::offset_delta(0),
+          .ntp_revision = manifest.get_revision_id(),
+        };
+        auto sname = segment_name(
+          fmt::format("{}-1-v1.log", s.base_offset()));
+        manifest.add(sname, meta);
+        auto url = manifest.generate_segment_path(
+          *parse_segment_name(sname), meta);
+        expectations.push_back(cloud_storage_fixture::expectation{
+          .url = "/" + url().string(), .body = s.bytes});
+        base = s.last_offset + model::offset(1);
+    }
+    std::stringstream ostr;
+    manifest.serialize(ostr);
+    expectations.push_back(cloud_storage_fixture::expectation{
+      .url = "/" + manifest.get_manifest_path()().string(),
+      .body = ss::sstring(ostr.str())});
+    return base - model::offset(1);
+}
+
+static storage::ntp_config
+make_recovery_ntp_config(const model::ntp& ntp, const ss::sstring& base_dir) {
+    auto overrides = std::make_unique<storage::ntp_config::default_overrides>();
+    // Size bound retention doesn't depend on segment timestamps
+    overrides->cleanup_policy_bitflags
+      = model::cleanup_policy_bitflags::deletion;
+    overrides->retention_bytes = tristate<size_t>(
+      std::numeric_limits<size_t>::max());
+    overrides->recovery_enabled = storage::topic_recovery_enabled::yes;
+    return storage::ntp_config(
+      ntp, base_dir, std::move(overrides), model::revision_id(1));
+}
+
+/// Partitions restored at the same time on a shard share the budget set by
+/// 'cloud_storage_max_concurrent_recovery_downloads', every partition alone
+/// would download that many segments concurrently
+FIXTURE_TEST(
+  test_recovery_downloads_bounded_across_partitions, cloud_storage_fixture) {
+    constexpr int num_partitions = 4;
+    constexpr int num_segments = 8;
+    constexpr int16_t max_downloads = 2;
+
+    config::shard_local_cfg()
+      .cloud_storage_max_concurrent_recovery_downloads.set_value(
+        max_downloads);
+    auto reset_config = ss::defer([] {
+        config::shard_local_cfg()
+          .cloud_storage_max_concurrent_recovery_downloads.reset();
+    });
+
+    std::vector<cloud_storage_fixture::expectation> expectations;
+    std::vector<storage::ntp_config> ntp_configs;
+    std::vector<model::offset> last_offsets;
+    for (int i = 0; i < num_partitions; i++) {
+        model::ntp ntp(
+          manifest_namespace, manifest_topic, model::partition_id(i));
+        last_offsets.push_back(
+          add_partition_expectations(ntp, num_segments, expectations));
+        ntp_configs.push_back(make_recovery_ntp_config(
+          ntp, tmp_directory.get_path().string()));
+    }
+    set_expectations_and_listen(expectations);
+
+    ss::sharded<remote> api;
+    api.start(s3_connection_limit(10), get_configuration(), config_file)
+      .get();
+    auto stop_api = ss::defer([&api] { api.stop().get(); });
+    api.invoke_on_all([](remote& r) { return r.start(); }).get();
+
+    partition_recovery_manager manager(s3::bucket_name("bucket"), api);
+    auto stop_manager = ss::defer([&manager] { manager.stop().get(); });
+
+    std::vector<log_recovery_result> results(num_partitions);
+    ss::parallel_for_each(
+      boost::irange(0, num_partitions),
+      [&](int i) {
+          return manager
+            .download_log(ntp_configs[i], manifest_revision, num_partitions)
+            .then([&results, i](log_recovery_result r) {
+                results[i] = std::move(r);
+            });
+      })
+      .get();
+
+    for (int i = 0; i < num_partitions; i++) {
+        BOOST_REQUIRE(results[i].completed);
+        BOOST_REQUIRE_EQUAL(results[i].min_kafka_offset, model::offset(0));
+        BOOST_REQUIRE_EQUAL(results[i].max_kafka_offset, last_offsets[i]);
+    }
+    BOOST_REQUIRE_EQUAL(manager.probe().segments_in_progress(), 0);
+    BOOST_REQUIRE_GT(manager.probe().max_segments_in_progress(), 0);
+    BOOST_REQUIRE_LE(
+      manager.probe().max_segments_in_progress(), max_downloads);
+}
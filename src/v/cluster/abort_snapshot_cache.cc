@@ -0,0 +1,102 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/abort_snapshot_cache.h"
+
+#include <seastar/core/future-util.hh>
+
+namespace cluster {
+
+abort_snapshot_cache& abort_snapshot_cache::local() {
+    static thread_local abort_snapshot_cache cache;
+    return cache;
+}
+
+ss::future<abort_snapshot_cache::index_ptr> abort_snapshot_cache::get(
+  owner_id owner, model::offset first, model::offset last, loader_t loader) {
+    key_t key{owner, first, last};
+    if (auto it = _entries.find(key); it != _entries.end()) {
+        _lru.splice(_lru.end(), _lru, it->second);
+        return it->second->snapshot.get_future();
+    }
+
+    const auto generation = _next_generation++;
+    ss::shared_future<index_ptr> snapshot(ss::futurize_invoke(loader));
+    auto lru_it = _lru.insert(
+      _lru.end(),
+      entry{.key = key, .generation = generation, .snapshot = snapshot});
+    _entries.emplace(key, lru_it);
+
+    return snapshot.get_future().then_wrapped(
+      [this, key, generation](ss::future<index_ptr> f) {
+          auto it = _entries.find(key);
+          const bool cached = it != _entries.end()
+                              && it->second->generation == generation;
+          if (f.failed()) {
+              // don't cache failures, the next fetch retries the load
+              if (cached) {
+                  erase(it->second);
+              }
+              return ss::make_exception_future<index_ptr>(f.get_exception());
+          }
+          auto snapshot = f.get0();
+          if (cached && it->second->size_bytes == 0) {
+              on_loaded(it->second, snapshot);
+          }
+          return ss::make_ready_future<index_ptr>(std::move(snapshot));
+      });
+}
+
+void abort_snapshot_cache::on_loaded(
+  lru_t::iterator it, const index_ptr& snapshot) {
+    it->size_bytes = sizeof(entry) + (snapshot ? snapshot->size_bytes() : 0);
+    _size_bytes += it->size_bytes;
+    evict_over_budget();
+}
+
+void abort_snapshot_cache::evict_over_budget() {
+    // snapshots being loaded don't use any memory yet, they are kept
+    auto it = _lru.begin();
+    while (_size_bytes > _max_bytes && it != _lru.end()) {
+        auto next = std::next(it);
+        if (it->size_bytes > 0) {
+            erase(it);
+        }
+        it = next;
+    }
+}
+
+void abort_snapshot_cache::evict(
+  owner_id owner, model::offset first, model::offset last) {
+    if (auto it = _entries.find(key_t{owner, first, last});
+        it != _entries.end()) {
+        erase(it->second);
+    }
+}
+
+void abort_snapshot_cache::evict(owner_id owner) {
+    auto it = _lru.begin();
+    while (it != _lru.end()) {
+        auto next = std::next(it);
+        if (std::get<0>(it->key) == owner) {
+            erase(it);
+        }
+        it = next;
+    }
+}
+
+void abort_snapshot_cache::erase(lru_t::iterator it) {
+    _size_bytes -= it->size_bytes;
+    _entries.erase(it->key);
+    _lru.erase(it);
+}
+
+} // namespace cluster
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "cluster/offset_interval_index.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <cstdint>
+#include <list>
+#include <tuple>
+
+namespace cluster {
+
+/**
+ * \brief Shard wide LRU cache of the abort snapshots loaded by rm_stm.
+ *
+ * Fetches of read_committed consumers reading old offsets load the aborted
+ * transactions of the offloaded abort indexes. The loaded snapshots of all
+ * the partitions of a shard share a single memory budget: the least recently
+ * used snapshots are evicted once the memory used by the loaded ones exceeds
+ * it. Concurrent loads of the same snapshot share one read, failed loads are
+ * not cached.
+ */
+class abort_snapshot_cache {
+public:
+    using index_ptr
+      = ss::lw_shared_ptr<const offset_interval_index<model::tx_range>>;
+    /// Loads the snapshot, nullptr if it doesn't exist
+    using loader_t = ss::noncopyable_function<ss::future<index_ptr>()>;
+    /// Identifies the snapshots of one rm_stm instance
+    using owner_id = uint64_t;
+
+    static constexpr size_t default_max_bytes = 16_MiB;
+
+    explicit abort_snapshot_cache(size_t max_bytes = default_max_bytes)
+      : _max_bytes(max_bytes) {}
+
+    /// Instance shared by the partitions of the current shard
+    static abort_snapshot_cache& local();
+
+    owner_id register_owner() { return _next_owner++; }
+
+    /// Snapshot of the abort index [first, last] of the owner, loaded with
+    /// the loader if it isn't cached
+    ss::future<index_ptr>
+    get(owner_id, model::offset first, model::offset last, loader_t);
+
+    void evict(owner_id, model::offset first, model::offset last);
+    /// Evicts all the snapshots of the owner
+    void evict(owner_id);
+
+    size_t size_bytes() const { return _size_bytes; }
+    size_t size() const { return _entries.size(); }
+
+private:
+    using key_t = std::tuple<owner_id, model::offset, model::offset>;
+
+    struct entry {
+        key_t key;
+        uint64_t generation;
+        ss::shared_future<index_ptr> snapshot;
+        // zero while the snapshot is being loaded
+        size_t size_bytes{0};
+    };
+    using lru_t = std::list<entry>;
+
+    void on_loaded(lru_t::iterator, const index_ptr&);
+    void erase(lru_t::iterator);
+    void evict_over_budget();
+
+    size_t _max_bytes;
+    size_t _size_bytes{0};
+    owner_id _next_owner{0};
+    uint64_t _next_generation{0};
+    // the least recently used entry is at the front
+    lru_t _lru;
+    absl::flat_hash_map<key_t, lru_t::iterator> _entries;
+};
+
+} // namespace cluster
@@ -257,6 +257,10 @@ controller_api::get_reconciliation_state(
       });
 }
 
+ss::future<> controller_api::wait_for_bootstrap() {
+    return _backend.invoke_on_all(&controller_backend::wait_for_bootstrap);
+}
+
 // high level APIs
 ss::future<std::error_code> controller_api::wait_for_topic(
   model::topic_namespace_view tp_ns, model::timeout_clock::time_point timeout) {
@@ -65,6 +65,10 @@ public:
     ss::future<std::error_code> wait_for_topic(
       model::topic_namespace_view, model::timeout_clock::time_point);
 
+    /// Waits until the partitions hosted by the node before the restart are
+    /// bootstrapped on all shards
+    ss::future<> wait_for_bootstrap();
+
 private:
     ss::future<result<bool>> are_ntps_ready(
       absl::node_hash_map<model::node_id, std::vector<model::ntp>>,
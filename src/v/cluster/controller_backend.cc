@@ -25,11 +25,17 @@
 #include "config/node_config.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
+#include "model/namespace.h"
 #include "outcome.h"
 #include "prometheus/prometheus_sanitize.h"
+#include "raft/consensus.h"
+#include "raft/consensus_utils.h"
 #include "raft/group_configuration.h"
 #include "raft/types.h"
+#include "reflection/adl.h"
 #include "ssx/future-util.h"
+#include "storage/api.h"
+#include "storage/kvstore.h"
 #include "vassert.h"
 
 #include <seastar/core/abort_source.hh>
@@ -38,6 +44,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/util/later.hh>
 
@@ -298,27 +305,153 @@ ss::future<> controller_backend::start() {
     });
 }
 
+namespace {
+bool is_internal_ntp(const model::ntp& ntp) {
+    return ntp.ns == model::kafka_internal_namespace
+           || model::topic_namespace_view(ntp)
+                == model::kafka_consumer_offsets_nt;
+}
+
+/**
+ * Raft persists the vote of the last term it took part in. A node that voted
+ * for itself was the leader of the group, or was trying to become one, before
+ * it restarted.
+ */
+bool voted_for_self(
+  storage::kvstore& kvs, raft::group_id group, model::node_id self) {
+    auto value = kvs.get(
+      storage::kvstore::key_space::consensus,
+      raft::details::serialize_group_key(
+        group, raft::metadata_key::voted_for));
+    if (!value) {
+        return false;
+    }
+    try {
+        auto cfg = reflection::adl<raft::consensus::voted_for_configuration>{}
+                     .from(std::move(*value));
+        return cfg.voted_for.id() == self;
+    } catch (...) {
+        // state written by an old version, priority is only a hint
+        return false;
+    }
+}
+} // namespace
+
+ss::future<> controller_backend::wait_for_bootstrap() {
+    return _bootstrap_done.get_shared_future();
+}
+
 ss::future<> controller_backend::bootstrap_controller_backend() {
     if (!_topics.local().has_pending_changes()) {
         vlog(clusterlog.trace, "no pending changes, skipping bootstrap");
-        return ss::now();
+        _bootstrap_done.set_value();
+        co_return;
     }
 
-    return fetch_deltas().then([this] {
-        return ss::with_semaphore(
-          _topics_sem, 1, [this] { return do_bootstrap(); });
-    });
-}
+    co_await fetch_deltas();
+    auto units = co_await ss::get_units(_topics_sem, 1);
+
+    /**
+     * Partitions of internal topics (consumer groups, transactions, id
+     * allocator) are needed by the node to serve any request, they are
+     * recovered first. The rest may be recovered while the node is already
+     * starting the remaining services, partitions this node led before the
+     * restart first as their clients wait for an election until they are
+     * back. Semaphore units are held until all partitions are bootstrapped
+     * so that no delta is reconciled before the bootstrap of its partition.
+     */
+    std::vector<model::ntp> internal;
+    std::vector<model::ntp> led;
+    std::vector<model::ntp> other;
+    auto& kvs = _storage.local().kvs();
+    for (const auto& [ntp, deltas] : _topic_deltas) {
+        if (is_internal_ntp(ntp)) {
+            internal.push_back(ntp);
+        } else if (
+          !deltas.empty()
+          && voted_for_self(kvs, deltas.back().new_assignment.group, _self)) {
+            led.push_back(ntp);
+        } else {
+            other.push_back(ntp);
+        }
+    }
+    co_await do_bootstrap(std::move(internal));
+
+    if (!config::shard_local_cfg().controller_backend_background_bootstrap()) {
+        co_await do_bootstrap(std::move(led));
+        co_await do_bootstrap(std::move(other));
+        _bootstrap_done.set_value();
+        co_return;
+    }
 
-ss::future<> controller_backend::do_bootstrap() {
-    return ss::parallel_for_each(
-      _topic_deltas.begin(),
-      _topic_deltas.end(),
-      [this](underlying_t::value_type& ntp_deltas) {
-          return bootstrap_ntp(ntp_deltas.first, ntp_deltas.second);
+    ssx::spawn_with_gate(
+      _gate,
+      [this,
+       led = std::move(led),
+       other = std::move(other),
+       units = std::move(units)]() mutable {
+          return do_bootstrap(std::move(led))
+            .then([this, other = std::move(other)]() mutable {
+                return do_bootstrap(std::move(other));
+            })
+            .then_wrapped([this](ss::future<> f) {
+                if (f.failed()) {
+                    auto e = f.get_exception();
+                    vlog(
+                      clusterlog.warn,
+                      "error bootstrapping partitions in background - {}",
+                      e);
+                    _bootstrap_done.set_exception(e);
+                } else {
+                    _bootstrap_done.set_value();
+                }
+            })
+            .finally([units = std::move(units)] {});
       });
 }
 
+ss::future<> controller_backend::do_bootstrap(std::vector<model::ntp> ntps) {
+    if (ntps.empty()) {
+        co_return;
+    }
+    const auto start = ss::lowres_clock::now();
+    const auto total = ntps.size();
+    while (true) {
+        std::vector<model::ntp> failed;
+        co_await ss::parallel_for_each(
+          ntps, [this, &failed](const model::ntp& ntp) {
+              auto it = _topic_deltas.find(ntp);
+              if (it == _topic_deltas.end()) {
+                  return ss::now();
+              }
+              return bootstrap_ntp(it->first, it->second)
+                .handle_exception(
+                  [&failed, &ntp](const std::exception_ptr& e) {
+                      vlog(
+                        clusterlog.warn,
+                        "[{}] error bootstrapping partition, retrying - {}",
+                        ntp,
+                        e);
+                      failed.push_back(ntp);
+                  });
+          });
+        if (failed.empty()) {
+            break;
+        }
+        // bootstrap is idempotent, partitions that were already created are
+        // left as they are
+        co_await ss::sleep_abortable(_housekeeping_timer_interval, _as.local());
+        ntps = std::move(failed);
+    }
+    vlog(
+      clusterlog.info,
+      "bootstrapped {} partitions in {} ms",
+      total,
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        ss::lowres_clock::now() - start)
+        .count());
+}
+
 std::vector<topic_table::delta> calculate_bootstrap_deltas(
   model::node_id self, const std::vector<topic_table::delta>& deltas) {
     std::vector<topic_table::delta> result_delta;
@@ -1102,6 +1235,8 @@ controller_backend::create_partition_from_remote_shard(
               previous_shard,
               ss::this_shard_id(),
               _storage);
+            co_await storage::log_manager::move_persistent_state(
+              ntp, previous_shard, ss::this_shard_id(), _storage);
         }
 
         auto ec = co_await create_partition(
@@ -1426,21 +1561,70 @@ ss::future<> controller_backend::add_to_shard_table(
       ntp,
       shard,
       revision);
-    return _shard_table.invoke_on_all(
-      [ntp = std::move(ntp), raft_group, shard, revision](
-        shard_table& s) mutable {
-          s.update(ntp, raft_group, shard, revision);
-      });
+    return update_shard_table(shard_table_update{
+      .ntp = std::move(ntp),
+      .group = raft_group,
+      .shard = shard,
+      .revision = revision,
+    });
 }
 
 ss::future<> controller_backend::remove_from_shard_table(
   model::ntp ntp, raft::group_id raft_group, model::revision_id revision) {
     // update shard_table: broadcast
+    return update_shard_table(shard_table_update{
+      .ntp = std::move(ntp),
+      .group = raft_group,
+      .shard = std::nullopt,
+      .revision = revision,
+    });
+}
 
-    return _shard_table.invoke_on_all(
-      [ntp = std::move(ntp), raft_group, revision](shard_table& s) mutable {
-          s.erase(ntp, raft_group, revision);
-      });
+ss::future<>
+controller_backend::update_shard_table(shard_table_update update) {
+    if (_gate.is_closed()) {
+        return ss::make_exception_future<>(ss::gate_closed_exception());
+    }
+    if (!_shard_table_batch) {
+        _shard_table_batch = std::make_unique<shard_table_batch>();
+    }
+    _shard_table_batch->updates.push_back(std::move(update));
+    auto f = _shard_table_batch->done.get_shared_future();
+    if (!_shard_table_flush_running) {
+        _shard_table_flush_running = true;
+        ssx::spawn_with_gate(_gate, [this] {
+            return flush_shard_table_updates().finally(
+              [this] { _shard_table_flush_running = false; });
+        });
+    }
+    return f;
+}
+
+ss::future<> controller_backend::flush_shard_table_updates() {
+    while (_shard_table_batch) {
+        auto batch = std::exchange(_shard_table_batch, nullptr);
+        vlog(
+          clusterlog.trace,
+          "applying {} shard table updates",
+          batch->updates.size());
+        try {
+            // updates are only read on the other cores, every core copies the
+            // ntps it stores
+            co_await _shard_table.invoke_on_all(
+              [&updates = batch->updates](shard_table& s) {
+                  for (const auto& u : updates) {
+                      if (u.shard) {
+                          s.update(u.ntp, u.group, *u.shard, u.revision);
+                      } else {
+                          s.erase(u.ntp, u.group, u.revision);
+                      }
+                  }
+              });
+            batch->done.set_value();
+        } catch (...) {
+            batch->done.set_exception(std::current_exception());
+        }
+    }
 }
 
 ss::future<std::error_code> controller_backend::create_partition(
@@ -1565,10 +1749,7 @@ ss::future<> controller_backend::delete_partition(
 
     auto group_id = part->group();
 
-    return _shard_table
-      .invoke_on_all([ntp, group_id, rev](shard_table& st) mutable {
-          st.erase(ntp, group_id, rev);
-      })
+    return remove_from_shard_table(ntp, group_id, rev)
       .then([this, ntp, rev] {
           return _partition_leaders_table.invoke_on_all(
             [ntp, rev](partition_leaders_table& leaders) {
@@ -22,6 +22,7 @@
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/sharded.hh>
 
 #include <absl/container/node_hash_map.h>
@@ -233,6 +234,11 @@ public:
 
     std::vector<topic_table::delta> list_ntp_deltas(const model::ntp&) const;
 
+    /// Resolves once all the partitions hosted by this shard before the
+    /// restart are bootstrapped, including the ones recovered in the
+    /// background
+    ss::future<> wait_for_bootstrap();
+
 private:
     struct cross_shard_move_request {
         cross_shard_move_request(model::revision_id, raft::group_configuration);
@@ -294,6 +300,28 @@ private:
       model::ntp, raft::group_id, ss::shard_id, model::revision_id);
     ss::future<>
       remove_from_shard_table(model::ntp, raft::group_id, model::revision_id);
+
+    /**
+     * Shard table is replicated on all cores, every update of a single entry
+     * is a broadcast to all of them. When many partitions are created at once
+     * (topic creation, node startup) updates are coalesced, all the updates
+     * requested while a broadcast is in flight are sent with the next one.
+     */
+    struct shard_table_update {
+        model::ntp ntp;
+        raft::group_id group;
+        // std::nullopt removes the entry
+        std::optional<ss::shard_id> shard;
+        model::revision_id revision;
+    };
+
+    struct shard_table_batch {
+        std::vector<shard_table_update> updates;
+        ss::shared_promise<> done;
+    };
+
+    ss::future<> update_shard_table(shard_table_update);
+    ss::future<> flush_shard_table_updates();
     ss::future<> delete_partition(
       model::ntp, model::revision_id, partition_removal_mode mode);
     template<typename Func>
@@ -322,7 +350,7 @@ private:
     ss::future<std::error_code>
       dispatch_update_finished(model::ntp, partition_assignment);
 
-    ss::future<> do_bootstrap();
+    ss::future<> do_bootstrap(std::vector<model::ntp>);
     ss::future<> bootstrap_ntp(const model::ntp&, deltas_t&);
 
     ss::future<std::error_code>
@@ -374,6 +402,11 @@ private:
      * first created on current node before cross core move series
      */
     absl::node_hash_map<model::ntp, model::revision_id> _bootstrap_revisions;
+
+    ss::shared_promise<> _bootstrap_done;
+
+    std::unique_ptr<shard_table_batch> _shard_table_batch;
+    bool _shard_table_flush_running{false};
     ss::metrics::metric_groups _metrics;
 };
 
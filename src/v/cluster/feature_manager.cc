@@ -81,12 +81,12 @@ feature_manager::start(std::vector<model::node_id>&& cluster_founder_nodes) {
     _health_notify_handle = _hm_backend.local().register_node_callback(
       [this](
         node_health_report const& report,
-        std::optional<std::reference_wrapper<const node_health_report>>
-          old_report) {
+        std::optional<std::reference_wrapper<const node::local_state>>
+          old_state) {
           if (
-            !old_report
+            !old_state
             || report.local_state.logical_version
-                 != old_report.value().get().local_state.logical_version) {
+                 != old_state.value().get().logical_version) {
               update_node_version(
                 report.id, report.local_state.logical_version);
           }
@@ -44,7 +44,9 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <bit>
 #include <iterator>
+#include <limits>
 
 namespace cluster {
 
@@ -76,6 +78,8 @@ health_monitor_backend::health_monitor_backend(
       std::move(storage_min_bytes),
       storage_node_api,
       storage_api) {
+    _sent_position.session = random_generators::get_int<uint64_t>(
+      1, std::numeric_limits<uint64_t>::max());
     _leadership_notification_handle
       = _raft_manager.local().register_leadership_notification(
         [this](
@@ -368,6 +372,7 @@ health_monitor_backend::dispatch_refresh_cluster_health_request(
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
     _reports.clear();
+    _report_positions.clear();
     for (auto& n_report : reply.value().report->node_reports) {
         const auto id = n_report.id;
 
@@ -484,46 +489,28 @@ health_monitor_backend::maybe_refresh_cluster_health(
     co_return errc::success;
 }
 
-ss::future<result<node_health_report>>
-health_monitor_backend::collect_remote_node_health(model::node_id id) {
-    const auto timeout = model::timeout_clock::now() + max_metadata_age();
-    return _connections.local()
-      .with_node_client<controller_client_protocol>(
-        _raft0->self().id(),
-        ss::this_shard_id(),
-        id,
-        max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
-            return client.collect_node_health_report(
-              get_node_health_request{.filter = node_report_filter{}},
-              rpc::client_opts(timeout));
-        })
-      .then(&rpc::get_ctx_data<get_node_health_reply>)
-      .then([this, id](result<get_node_health_reply> reply) {
-          return process_node_reply(id, std::move(reply));
-      });
-}
-
-result<node_health_report>
-map_reply_result(result<get_node_health_reply> reply) {
+template<typename Reply>
+auto map_reply_result(result<Reply> reply) {
+    using report_t = typename decltype(Reply::report)::value_type;
     if (!reply) {
-        return result<node_health_report>(reply.error());
+        return result<report_t>(reply.error());
     }
     if (!reply.value().report.has_value()) {
-        return result<node_health_report>(reply.value().error);
+        return result<report_t>(reply.value().error);
     }
-    return result<node_health_report>(std::move(*reply.value().report));
+    return result<report_t>(std::move(*reply.value().report));
 }
 
-result<node_health_report> health_monitor_backend::process_node_reply(
-  model::node_id id, result<get_node_health_reply> reply) {
+template<typename Reply>
+auto health_monitor_backend::process_node_reply(
+  model::node_id id, result<Reply> reply) {
     auto it = _last_replies.find(id);
     if (it == _last_replies.end()) {
         auto [inserted, _] = _last_replies.emplace(id, reply_status{});
         it = inserted;
     }
 
-    auto res = map_reply_result(reply);
+    auto res = map_reply_result(std::move(reply));
     if (!res) {
         vlog(
           clusterlog.trace,
@@ -541,7 +528,7 @@ result<node_health_report> health_monitor_backend::process_node_reply(
               id,
               res.error().message());
         }
-        return result<node_health_report>(reply.error());
+        return res;
     }
 
     // TODO serialize storage_space_alert, instead of recomputing here.
@@ -560,6 +547,55 @@ result<node_health_report> health_monitor_backend::process_node_reply(
     return res;
 }
 
+ss::future<result<node_health_report_delta>>
+health_monitor_backend::collect_remote_node_health(model::node_id id) {
+    const auto timeout = model::timeout_clock::now() + max_metadata_age();
+    if (!_feature_table.local().is_active(
+          features::feature::incremental_health_reports)) {
+        // nodes running older versions only send full reports
+        return _connections.local()
+          .with_node_client<controller_client_protocol>(
+            _raft0->self().id(),
+            ss::this_shard_id(),
+            id,
+            max_metadata_age(),
+            [timeout](controller_client_protocol client) mutable {
+                return client.collect_node_health_report(
+                  get_node_health_request{.filter = node_report_filter{}},
+                  rpc::client_opts(timeout));
+            })
+          .then(&rpc::get_ctx_data<get_node_health_reply>)
+          .then([this, id](result<get_node_health_reply> reply) {
+              auto res = process_node_reply(id, std::move(reply));
+              if (!res) {
+                  return result<node_health_report_delta>(res.error());
+              }
+              return result<node_health_report_delta>(
+                node_health_report_delta::full(std::move(res.value())));
+          });
+    }
+
+    health_report_position base;
+    if (auto it = _report_positions.find(id); it != _report_positions.end()) {
+        base = it->second;
+    }
+    return _connections.local()
+      .with_node_client<controller_client_protocol>(
+        _raft0->self().id(),
+        ss::this_shard_id(),
+        id,
+        max_metadata_age(),
+        [timeout, base](controller_client_protocol client) mutable {
+            return client.collect_node_health_report_delta(
+              get_node_health_delta_request{.base = base},
+              rpc::client_opts(timeout));
+        })
+      .then(&rpc::get_ctx_data<get_node_health_delta_reply>)
+      .then([this, id](result<get_node_health_delta_reply> reply) {
+          return process_node_reply(id, std::move(reply));
+      });
+}
+
 ss::future<std::error_code> health_monitor_backend::collect_cluster_health() {
     /**
      * We are collecting cluster health on raft 0 leader only
@@ -568,48 +604,81 @@ ss::future<std::error_code> health_monitor_backend::collect_cluster_health() {
     // collect all reports
     auto ids = _members.local().all_broker_ids();
     auto reports = co_await ssx::async_transform(
-      ids.begin(), ids.end(), [this](model::node_id id) {
+      ids.begin(),
+      ids.end(),
+      [this](
+        model::node_id id) -> ss::future<result<node_health_report_delta>> {
           if (id == _raft0->self().id()) {
-              return collect_current_node_health(node_report_filter{});
+              return collect_current_node_health(node_report_filter{})
+                .then([](result<node_health_report> r) {
+                    if (!r) {
+                        return result<node_health_report_delta>(r.error());
+                    }
+                    return result<node_health_report_delta>(
+                      node_health_report_delta::full(std::move(r.value())));
+                });
           }
           return collect_remote_node_health(id);
       });
 
     auto old_reports = std::exchange(_reports, {});
+    auto old_positions = std::exchange(_report_positions, {});
 
     // update nodes reports and cache cluster-level disk health
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
     for (auto& r : reports) {
-        if (r) {
-            const auto id = r.value().id;
-            vlog(
-              clusterlog.debug,
-              "collected node {} health report: {}",
-              id,
-              r.value());
-
-            std::optional<std::reference_wrapper<const node_health_report>>
-              old_report;
-            if (auto old_i = old_reports.find(id); old_i != old_reports.end()) {
+        if (!r) {
+            continue;
+        }
+        auto& delta = r.value();
+        const auto id = delta.id;
+        vlog(
+          clusterlog.debug, "collected node {} health report: {}", id, delta);
+
+        auto old_i = old_reports.find(id);
+        if (!delta.is_full()) {
+            auto pos_i = old_positions.find(id);
+            if (
+              old_i == old_reports.end() || pos_i == old_positions.end()
+              || pos_i->second != delta.base) {
+                // the node will be asked for a full report next time
                 vlog(
-                  clusterlog.debug,
-                  "(previous node report from {}: {})",
+                  clusterlog.info,
+                  "ignoring health report from {} based on unknown position {}",
                   id,
-                  old_i->second);
-                old_report = old_i->second;
-            } else {
-                vlog(clusterlog.debug, "(initial node report from {})", id);
+                  delta.base);
+                continue;
             }
+        }
 
-            for (auto& cb : _node_callbacks) {
-                cb.second(r.value(), old_report);
-            }
-            cluster_disk_health = storage::max_severity(
-              r.value().local_state.storage_space_alert, cluster_disk_health);
+        // the previous report is updated in place
+        node_health_report report;
+        std::optional<node::local_state> old_state;
+        if (old_i != old_reports.end()) {
+            old_state = old_i->second.local_state;
+            report = std::move(old_i->second);
+        } else {
+            vlog(clusterlog.debug, "(initial node report from {})", id);
+        }
+        const auto position = delta.position;
+        apply_node_health_delta(report, std::move(delta));
 
-            _reports.emplace(id, std::move(r.value()));
+        std::optional<std::reference_wrapper<const node::local_state>>
+          old_local_state;
+        if (old_state) {
+            old_local_state = *old_state;
         }
+        for (auto& cb : _node_callbacks) {
+            cb.second(report, old_local_state);
+        }
+        cluster_disk_health = storage::max_severity(
+          report.local_state.storage_space_alert, cluster_disk_health);
+
+        if (position.is_valid()) {
+            _report_positions.emplace(id, position);
+        }
+        _reports.emplace(id, std::move(report));
     }
     _reports_disk_health = cluster_disk_health;
     _last_refresh = ss::lowres_clock::now();
@@ -638,6 +707,76 @@ health_monitor_backend::collect_current_node_health(node_report_filter filter) {
 
     co_return ret;
 }
+
+ss::future<result<node_health_report_delta>>
+health_monitor_backend::collect_current_node_health_delta(
+  health_report_position base) {
+    auto report = co_await collect_current_node_health(node_report_filter{});
+    if (!report) {
+        co_return report.error();
+    }
+    co_return make_node_report_delta(base, std::move(report.value()));
+}
+
+node_health_report_delta health_monitor_backend::make_node_report_delta(
+  health_report_position base, node_health_report report) {
+    // the difference can only be computed from the last report that was sent
+    const bool full = !base.is_valid() || base != _sent_position;
+
+    node_health_report_delta delta{
+      .id = report.id,
+      .local_state = std::move(report.local_state),
+      .drain_status = std::move(report.drain_status),
+    };
+    if (!full) {
+        delta.base = base;
+    }
+
+    sent_topics_t sent;
+    sent.reserve(report.topics.size());
+    for (auto& t : report.topics) {
+        auto prev = full ? _sent_topics.end() : _sent_topics.find(t.tp_ns);
+        auto& partitions = sent[t.tp_ns];
+        partitions.reserve(t.partitions.size());
+
+        topic_status_delta td{.tp_ns = std::move(t.tp_ns)};
+        for (auto& p : t.partitions) {
+            bool changed = true;
+            if (prev != _sent_topics.end()) {
+                auto it = prev->second.find(p.id);
+                changed = it == prev->second.end() || it->second != p;
+            }
+            if (changed) {
+                td.updated.push_back(p);
+            }
+            partitions.emplace(p.id, p);
+        }
+        if (prev != _sent_topics.end()) {
+            for (const auto& [id, _] : prev->second) {
+                if (!partitions.contains(id)) {
+                    td.removed.push_back(id);
+                }
+            }
+        }
+        if (full || !td.updated.empty() || !td.removed.empty()) {
+            delta.topics.push_back(std::move(td));
+        }
+    }
+
+    if (!full) {
+        for (const auto& [tp_ns, _] : _sent_topics) {
+            if (!sent.contains(tp_ns)) {
+                delta.removed_topics.push_back(tp_ns);
+            }
+        }
+    }
+
+    _sent_topics = std::move(sent);
+    ++_sent_position.seq;
+    delta.position = _sent_position;
+    return delta;
+}
+
 namespace {
 
 struct ntp_leader {
@@ -650,8 +789,35 @@ struct ntp_report {
     model::ntp ntp;
     ntp_leader leader;
     size_t size_bytes;
+    partition_load load;
 };
 
+/*
+ * rates are rounded down to their most significant bits so that partitions
+ * whose load barely changed don't have to be a part of every incremental
+ * health report
+ */
+uint64_t quantize_rate(uint64_t rate) {
+    static constexpr int significant_bits = 4;
+    auto width = std::bit_width(rate);
+    if (width <= significant_bits) {
+        return rate;
+    }
+    auto shift = width - significant_bits;
+    return (rate >> shift) << shift;
+}
+
+partition_load leader_load(partition& p) {
+    if (!p.is_elected_leader()) {
+        return {};
+    }
+    auto load = p.probe().load();
+    return partition_load{
+      .bytes_rate = quantize_rate(load.bytes_rate),
+      .requests_rate = quantize_rate(load.requests_rate),
+    };
+}
+
 partition_status to_partition_status(const ntp_report& ntpr) {
     return partition_status{
       .id = ntpr.ntp.tp.partition,
@@ -659,6 +825,8 @@ partition_status to_partition_status(const ntp_report& ntpr) {
       .leader_id = ntpr.leader.leader_id,
       .revision_id = ntpr.leader.revision_id,
       .size_bytes = ntpr.size_bytes,
+      .bytes_rate = ntpr.load.bytes_rate,
+      .requests_rate = ntpr.load.requests_rate,
     };
 }
 
@@ -681,6 +849,7 @@ std::vector<ntp_report> collect_shard_local_reports(
                   .revision_id = p.second->get_revision_id(),
                 },
                 .size_bytes = p.second->size_bytes(),
+                .load = leader_load(*p.second),
               };
           });
     } else {
@@ -694,6 +863,7 @@ std::vector<ntp_report> collect_shard_local_reports(
                   .revision_id = partition->get_revision_id(),
                 },
                 .size_bytes = partition->size_bytes(),
+                .load = leader_load(*partition),
                 });
             }
         }
@@ -22,6 +22,7 @@
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
 
 #include <chrono>
@@ -29,9 +30,11 @@
 #include <vector>
 namespace cluster {
 
+/// Called with the new node report and the local state from the previous
+/// report of the node, if there was one
 using health_node_cb_t = ss::noncopyable_function<void(
   node_health_report const&,
-  std::optional<std::reference_wrapper<const node_health_report>>)>;
+  std::optional<std::reference_wrapper<const node::local_state>>)>;
 
 /**
  * Health monitor backend is responsible for collecting cluster health status
@@ -41,6 +44,12 @@ using health_node_cb_t = ss::noncopyable_function<void(
  * controller partition leader. When any other node is requesting a cluster
  * report it either uses locally cached state or asks controller leader for
  * new report.
+ *
+ * Nodes report their health incrementally. Every report a node sends is
+ * identified by a position, and the controller leader asks for the difference
+ * from the last report it received. A node that can't produce such a
+ * difference, because it restarted or reported to another leader in the
+ * meantime, replies with a full report.
  */
 class health_monitor_backend {
 public:
@@ -72,6 +81,9 @@ public:
     ss::future<result<node_health_report>>
       collect_current_node_health(node_report_filter);
 
+    ss::future<result<node_health_report_delta>>
+      collect_current_node_health_delta(health_report_position);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -114,9 +126,16 @@ private:
     using last_reply_cache_t
       = absl::node_hash_map<model::node_id, reply_status>;
 
+    using position_cache_t
+      = absl::flat_hash_map<model::node_id, health_report_position>;
+
+    using sent_topics_t = absl::node_hash_map<
+      model::topic_namespace,
+      absl::flat_hash_map<model::partition_id, partition_status>>;
+
     void tick();
     ss::future<std::error_code> collect_cluster_health();
-    ss::future<result<node_health_report>>
+    ss::future<result<node_health_report_delta>>
       collect_remote_node_health(model::node_id);
     ss::future<std::error_code> maybe_refresh_cluster_health(
       force_refresh, model::timeout_clock::time_point);
@@ -134,8 +153,11 @@ private:
 
     void refresh_nodes_status();
 
-    result<node_health_report>
-      process_node_reply(model::node_id, result<get_node_health_reply>);
+    template<typename Reply>
+    auto process_node_reply(model::node_id, result<Reply>);
+
+    node_health_report_delta
+      make_node_report_delta(health_report_position, node_health_report);
 
     std::chrono::milliseconds max_metadata_age();
     void abort_current_refresh();
@@ -161,6 +183,12 @@ private:
     storage::disk_space_alert _reports_disk_health
       = storage::disk_space_alert::ok;
     last_reply_cache_t _last_replies;
+    // positions of the cached reports
+    position_cache_t _report_positions;
+
+    // position and content of the last report sent by this node
+    health_report_position _sent_position;
+    sent_topics_t _sent_topics;
 
     ss::gate _gate;
     mutex _refresh_mutex;
@@ -64,6 +64,14 @@ health_monitor_frontend::collect_node_health(node_report_filter f) {
       });
 }
 
+ss::future<result<node_health_report_delta>>
+health_monitor_frontend::collect_node_health_delta(
+  health_report_position base) {
+    return dispatch_to_backend([base](health_monitor_backend& be) {
+        return be.collect_current_node_health_delta(base);
+    });
+}
+
 // Return status of single node
 ss::future<result<std::vector<node_state>>>
 health_monitor_frontend::get_nodes_status(
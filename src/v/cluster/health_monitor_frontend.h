@@ -58,6 +58,11 @@ public:
     ss::future<result<node_health_report>>
       collect_node_health(node_report_filter);
 
+    // Collects current node health report as a difference to the report that
+    // was sent at the given position
+    ss::future<result<node_health_report_delta>>
+      collect_node_health_delta(health_report_position);
+
     // Return status of all nodes
     ss::future<result<std::vector<node_state>>>
       get_nodes_status(model::timeout_clock::time_point);
@@ -16,8 +16,11 @@
 #include "model/adl_serde.h"
 #include "utils/to_string.h"
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <chrono>
 
 namespace cluster {
@@ -86,12 +89,15 @@ std::ostream& operator<<(std::ostream& o, const cluster_health_report& r) {
 std::ostream& operator<<(std::ostream& o, const partition_status& ps) {
     fmt::print(
       o,
-      "{{id: {}, term: {}, leader_id: {}, revision_id: {}, size_bytes: {}}}",
+      "{{id: {}, term: {}, leader_id: {}, revision_id: {}, size_bytes: {}, "
+      "bytes_rate: {}, requests_rate: {}}}",
       ps.id,
       ps.term,
       ps.leader_id,
       ps.revision_id,
-      ps.size_bytes);
+      ps.size_bytes,
+      ps.bytes_rate,
+      ps.requests_rate);
     return o;
 }
 
@@ -100,6 +106,177 @@ std::ostream& operator<<(std::ostream& o, const topic_status& tl) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const health_report_position& p) {
+    fmt::print(o, "{{session: {}, seq: {}}}", p.session, p.seq);
+    return o;
+}
+
+void partition_status_columns::push_back(const partition_status& ps) {
+    ids.push_back(ps.id);
+    terms.push_back(ps.term);
+    leaders.push_back(ps.leader_id.value_or(model::node_id{-1}));
+    revisions.push_back(ps.revision_id);
+    sizes.push_back(ps.size_bytes);
+    bytes_rates.push_back(ps.bytes_rate);
+    requests_rates.push_back(ps.requests_rate);
+}
+
+partition_status partition_status_columns::get(size_t i) const {
+    std::optional<model::node_id> leader_id;
+    if (leaders[i] >= model::node_id{0}) {
+        leader_id = leaders[i];
+    }
+    return partition_status{
+      .id = ids[i],
+      .term = terms[i],
+      .leader_id = leader_id,
+      .revision_id = revisions[i],
+      .size_bytes = sizes[i],
+      .bytes_rate = i < bytes_rates.size() ? bytes_rates[i] : 0,
+      .requests_rate = i < requests_rates.size() ? requests_rates[i] : 0,
+    };
+}
+
+std::ostream&
+operator<<(std::ostream& o, const partition_status_columns& c) {
+    fmt::print(
+      o,
+      "{{ids: {}, terms: {}, leaders: {}, revisions: {}, sizes: {}, "
+      "bytes_rates: {}, requests_rates: {}}}",
+      c.ids,
+      c.terms,
+      c.leaders,
+      c.revisions,
+      c.sizes,
+      c.bytes_rates,
+      c.requests_rates);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const topic_status_delta& d) {
+    fmt::print(
+      o,
+      "{{topic: {}, updated: {}, removed: {}}}",
+      d.tp_ns,
+      d.updated,
+      d.removed);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const node_health_report_delta& d) {
+    fmt::print(
+      o,
+      "{{id: {}, base: {}, position: {}, disks: {}, redpanda_version: {}, "
+      "uptime: {}, logical_version: {}, drain_status: {}, topics: {}, "
+      "removed_topics: {}}}",
+      d.id,
+      d.base,
+      d.position,
+      d.local_state.disks,
+      d.local_state.redpanda_version,
+      d.local_state.uptime,
+      d.local_state.logical_version,
+      d.drain_status,
+      d.topics,
+      d.removed_topics);
+    return o;
+}
+
+node_health_report_delta
+node_health_report_delta::full(node_health_report report) {
+    node_health_report_delta delta{
+      .id = report.id,
+      .local_state = std::move(report.local_state),
+      .drain_status = std::move(report.drain_status),
+    };
+    delta.topics.reserve(report.topics.size());
+    for (auto& t : report.topics) {
+        topic_status_delta td{.tp_ns = std::move(t.tp_ns)};
+        for (const auto& p : t.partitions) {
+            td.updated.push_back(p);
+        }
+        delta.topics.push_back(std::move(td));
+    }
+    return delta;
+}
+
+namespace {
+bool partition_id_less(const partition_status& ps, model::partition_id id) {
+    return ps.id < id;
+}
+
+void apply_topic_delta(topic_status& topic, const topic_status_delta& delta) {
+    auto& partitions = topic.partitions;
+    for (auto id : delta.removed) {
+        auto it = std::lower_bound(
+          partitions.begin(), partitions.end(), id, partition_id_less);
+        if (it != partitions.end() && it->id == id) {
+            partitions.erase(it);
+        }
+    }
+    for (size_t i = 0; i < delta.updated.size(); ++i) {
+        auto ps = delta.updated.get(i);
+        auto it = std::lower_bound(
+          partitions.begin(), partitions.end(), ps.id, partition_id_less);
+        if (it != partitions.end() && it->id == ps.id) {
+            *it = ps;
+        } else {
+            partitions.insert(it, ps);
+        }
+    }
+}
+} // namespace
+
+void apply_node_health_delta(
+  node_health_report& report, node_health_report_delta delta) {
+    report.id = delta.id;
+    report.local_state = std::move(delta.local_state);
+    report.drain_status = std::move(delta.drain_status);
+
+    if (delta.is_full()) {
+        report.topics.clear();
+        report.topics.reserve(delta.topics.size());
+        for (auto& td : delta.topics) {
+            topic_status topic{.tp_ns = std::move(td.tp_ns)};
+            topic.partitions.reserve(td.updated.size());
+            for (size_t i = 0; i < td.updated.size(); ++i) {
+                topic.partitions.push_back(td.updated.get(i));
+            }
+            std::sort(
+              topic.partitions.begin(),
+              topic.partitions.end(),
+              [](const partition_status& a, const partition_status& b) {
+                  return a.id < b.id;
+              });
+            report.topics.push_back(std::move(topic));
+        }
+        return;
+    }
+
+    absl::flat_hash_map<model::topic_namespace, size_t> index;
+    index.reserve(report.topics.size());
+    for (size_t i = 0; i < report.topics.size(); ++i) {
+        index.emplace(report.topics[i].tp_ns, i);
+    }
+
+    for (const auto& td : delta.topics) {
+        auto [it, inserted] = index.try_emplace(
+          td.tp_ns, report.topics.size());
+        if (inserted) {
+            report.topics.push_back(topic_status{.tp_ns = td.tp_ns});
+        }
+        apply_topic_delta(report.topics[it->second], td);
+    }
+
+    if (!delta.removed_topics.empty()) {
+        absl::flat_hash_set<model::topic_namespace> removed(
+          delta.removed_topics.begin(), delta.removed_topics.end());
+        std::erase_if(report.topics, [&removed](const topic_status& t) {
+            return removed.contains(t.tp_ns);
+        });
+    }
+}
+
 std::ostream& operator<<(std::ostream& o, const node_report_filter& s) {
     fmt::print(
       o,
@@ -149,6 +326,18 @@ std::ostream& operator<<(std::ostream& o, const get_node_health_reply& r) {
     return o;
 }
 
+std::ostream&
+operator<<(std::ostream& o, const get_node_health_delta_request& r) {
+    fmt::print(o, "{{base: {}}}", r.base);
+    return o;
+}
+
+std::ostream&
+operator<<(std::ostream& o, const get_node_health_delta_reply& r) {
+    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const get_cluster_health_request& r) {
     fmt::print(
       o,
@@ -52,7 +52,9 @@ struct node_state : serde::envelope<node_state, serde::version<0>> {
     auto serde_fields() { return std::tie(id, membership_state, is_alive); }
 };
 
-struct partition_status : serde::envelope<partition_status, serde::version<0>> {
+struct partition_status
+  : serde::
+      envelope<partition_status, serde::version<1>, serde::compat_version<0>> {
     /**
      * We increase a version here 'backward' since incorrect assertion would
      * cause older redpanda versions to crash.
@@ -76,9 +78,20 @@ struct partition_status : serde::envelope<partition_status, serde::version<0>> {
     std::optional<model::node_id> leader_id;
     model::revision_id revision_id;
     size_t size_bytes;
+    // produce and fetch traffic per second, reported by the leader only. not
+    // a part of the adl encoding.
+    uint64_t bytes_rate{0};
+    uint64_t requests_rate{0};
 
     auto serde_fields() {
-        return std::tie(id, term, leader_id, revision_id, size_bytes);
+        return std::tie(
+          id,
+          term,
+          leader_id,
+          revision_id,
+          size_bytes,
+          bytes_rate,
+          requests_rate);
     }
 
     friend std::ostream& operator<<(std::ostream&, const partition_status&);
@@ -154,6 +167,137 @@ struct node_health_report
     }
 };
 
+/**
+ * Position of a node in the sequence of health reports it sent. The session is
+ * chosen randomly every time the node starts, so that positions are never
+ * reused across restarts.
+ */
+struct health_report_position
+  : serde::envelope<health_report_position, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    uint64_t session{0};
+    uint64_t seq{0};
+
+    bool is_valid() const { return session != 0; }
+
+    auto serde_fields() { return std::tie(session, seq); }
+
+    friend std::ostream&
+    operator<<(std::ostream&, const health_report_position&);
+
+    friend bool
+    operator==(const health_report_position&, const health_report_position&)
+      = default;
+};
+
+/**
+ * Partition statuses of a topic stored column by column. Every column is
+ * encoded as a plain vector which avoids the per partition envelope headers of
+ * a row oriented topic_status.
+ */
+struct partition_status_columns
+  : serde::envelope<
+      partition_status_columns,
+      serde::version<1>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    std::vector<model::partition_id> ids;
+    std::vector<model::term_id> terms;
+    // node id -1 stands for a partition without a leader
+    std::vector<model::node_id> leaders;
+    std::vector<model::revision_id> revisions;
+    std::vector<uint64_t> sizes;
+    // empty when decoded from version 0
+    std::vector<uint64_t> bytes_rates;
+    std::vector<uint64_t> requests_rates;
+
+    void push_back(const partition_status&);
+    partition_status get(size_t) const;
+    size_t size() const { return ids.size(); }
+    bool empty() const { return ids.empty(); }
+
+    auto serde_fields() {
+        return std::tie(
+          ids, terms, leaders, revisions, sizes, bytes_rates, requests_rates);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream&, const partition_status_columns&);
+
+    friend bool operator==(
+      const partition_status_columns&, const partition_status_columns&)
+      = default;
+};
+
+struct topic_status_delta
+  : serde::envelope<topic_status_delta, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    model::topic_namespace tp_ns;
+    // partitions that are new or changed since the base report
+    partition_status_columns updated;
+    // partitions that are no longer hosted by the node
+    std::vector<model::partition_id> removed;
+
+    auto serde_fields() { return std::tie(tp_ns, updated, removed); }
+
+    friend std::ostream& operator<<(std::ostream&, const topic_status_delta&);
+
+    friend bool
+    operator==(const topic_status_delta&, const topic_status_delta&)
+      = default;
+};
+
+/**
+ * Difference between the node health report at `position` and the one at
+ * `base`. A delta without a valid base is a full report, it contains all the
+ * partitions of the node.
+ */
+struct node_health_report_delta
+  : serde::envelope<node_health_report_delta, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    model::node_id id;
+    health_report_position base;
+    health_report_position position;
+    node::local_state local_state;
+    std::optional<drain_manager::drain_status> drain_status;
+    std::vector<topic_status_delta> topics;
+    std::vector<model::topic_namespace> removed_topics;
+
+    bool is_full() const { return !base.is_valid(); }
+
+    /// Full delta with the content of a node health report
+    static node_health_report_delta full(node_health_report);
+
+    auto serde_fields() {
+        return std::tie(
+          id,
+          base,
+          position,
+          local_state,
+          drain_status,
+          topics,
+          removed_topics);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream&, const node_health_report_delta&);
+
+    friend bool
+    operator==(const node_health_report_delta&, const node_health_report_delta&)
+      = default;
+};
+
+/**
+ * Applies the delta to the report it is based on. A full delta replaces the
+ * whole content of the report. Partitions of the report topics are kept sorted
+ * by id.
+ */
+void apply_node_health_delta(node_health_report&, node_health_report_delta);
+
 struct cluster_health_report
   : serde::envelope<cluster_health_report, serde::version<0>> {
     static constexpr int8_t current_version = 0;
@@ -297,6 +441,42 @@ struct get_node_health_reply
     auto serde_fields() { return std::tie(error, report); }
 };
 
+struct get_node_health_delta_request
+  : serde::envelope<get_node_health_delta_request, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    // position of the last report received from the node, the reply is a full
+    // report when it doesn't match the last report the node sent
+    health_report_position base;
+
+    auto serde_fields() { return std::tie(base); }
+
+    friend std::ostream&
+    operator<<(std::ostream&, const get_node_health_delta_request&);
+
+    friend bool operator==(
+      const get_node_health_delta_request&,
+      const get_node_health_delta_request&)
+      = default;
+};
+
+struct get_node_health_delta_reply
+  : serde::envelope<get_node_health_delta_reply, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    errc error = cluster::errc::success;
+    std::optional<node_health_report_delta> report;
+
+    auto serde_fields() { return std::tie(error, report); }
+
+    friend std::ostream&
+    operator<<(std::ostream&, const get_node_health_delta_reply&);
+
+    friend bool operator==(
+      const get_node_health_delta_reply&, const get_node_health_delta_reply&)
+      = default;
+};
+
 struct get_cluster_health_request
   : serde::envelope<get_cluster_health_request, serde::version<0>> {
     static constexpr int8_t initial_version = 0;
@@ -156,6 +156,15 @@ public:
     void reset_leaders();
     cluster::partition_leaders_table::leaders_info_t get_leaders() const;
 
+    /// Notifications of the changes of the topic metadata served by the
+    /// cache, i.e. topic table deltas and partition leadership changes
+    notification_id_type
+      register_topic_delta_notification(topic_table::delta_cb_t);
+    void unregister_topic_delta_notification(notification_id_type);
+    notification_id_type register_leadership_change_notification(
+      partition_leaders_table::leader_change_cb_t);
+    void unregister_leadership_change_notification(notification_id_type);
+
     model::compression get_default_compression() const;
     model::cleanup_policy_bitflags get_default_cleanup_policy_bitflags() const;
     model::compaction_strategy get_default_compaction_strategy() const;
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "model/fundamental.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace cluster {
+
+/**
+ * \brief Index of offset intervals answering which of them intersect a given
+ * offset range.
+ *
+ * T is any type with `first` and `last` offsets (e.g. aborted transactions
+ * or the abort indexes of rm_stm). The intervals are kept sorted by the first
+ * offset, with a segment tree of the max last offset on top of them, so an
+ * intersection query costs O(log n + k): only the subtrees containing an
+ * interval that ends at or after the start of the queried range are visited.
+ *
+ * The intervals added since the tree was built are kept in a small unsorted
+ * buffer that is scanned linearly by the queries and merged into the sorted
+ * part once it reaches merge_threshold entries.
+ */
+template<typename T>
+class offset_interval_index {
+public:
+    static constexpr size_t merge_threshold = 256;
+
+    offset_interval_index() = default;
+    explicit offset_interval_index(std::vector<T> intervals)
+      : _sorted(std::move(intervals)) {
+        sort_and_build();
+    }
+
+    size_t size() const { return _sorted.size() + _recent.size(); }
+    bool empty() const { return size() == 0; }
+
+    /// Memory used by the intervals and the tree
+    size_t size_bytes() const {
+        return (_sorted.capacity() + _recent.capacity()) * sizeof(T)
+               + _max_last.capacity() * sizeof(model::offset);
+    }
+
+    void add(T interval) {
+        _recent.push_back(std::move(interval));
+        if (_recent.size() >= merge_threshold) {
+            merge_recent();
+        }
+    }
+
+    template<typename It>
+    void insert(It begin, It end) {
+        _recent.insert(_recent.end(), begin, end);
+        if (_recent.size() >= merge_threshold) {
+            merge_recent();
+        }
+    }
+
+    void clear() {
+        _sorted.clear();
+        _recent.clear();
+        _max_last.clear();
+        _leaves = 0;
+    }
+
+    /// Calls f for every interval intersecting [from, to]
+    template<typename Func>
+    void for_each_intersecting(
+      model::offset from, model::offset to, Func&& f) const {
+        auto end = std::upper_bound(
+          _sorted.begin(),
+          _sorted.end(),
+          to,
+          [](model::offset o, const T& interval) {
+              return o < interval.first;
+          });
+        size_t candidates = std::distance(_sorted.begin(), end);
+        if (candidates > 0) {
+            visit(1, 0, _leaves, candidates, from, f);
+        }
+        for (const auto& interval : _recent) {
+            if (interval.last >= from && interval.first <= to) {
+                f(interval);
+            }
+        }
+    }
+
+    /// Calls f for every interval, in no particular order
+    template<typename Func>
+    void for_each(Func&& f) const {
+        std::for_each(_sorted.begin(), _sorted.end(), f);
+        std::for_each(_recent.begin(), _recent.end(), f);
+    }
+
+    /// Removes the intervals matching the predicate
+    template<typename Pred>
+    void remove_if(Pred&& pred) {
+        merge_recent();
+        auto it = std::remove_if(_sorted.begin(), _sorted.end(), pred);
+        if (it != _sorted.end()) {
+            _sorted.erase(it, _sorted.end());
+            build();
+        }
+    }
+
+    /// Intervals sorted by the first offset
+    const std::vector<T>& sorted() {
+        merge_recent();
+        return _sorted;
+    }
+
+private:
+    template<typename Func>
+    void visit(
+      size_t node,
+      size_t lo,
+      size_t hi,
+      size_t candidates,
+      model::offset from,
+      Func& f) const {
+        if (lo >= candidates || _max_last[node] < from) {
+            return;
+        }
+        if (hi - lo == 1) {
+            f(_sorted[lo]);
+            return;
+        }
+        auto mid = lo + (hi - lo) / 2;
+        visit(2 * node, lo, mid, candidates, from, f);
+        visit(2 * node + 1, mid, hi, candidates, from, f);
+    }
+
+    void merge_recent() {
+        if (_recent.empty()) {
+            return;
+        }
+        auto by_first = [](const T& a, const T& b) {
+            return a.first < b.first;
+        };
+        std::sort(_recent.begin(), _recent.end(), by_first);
+        auto mid = _sorted.size();
+        _sorted.insert(
+          _sorted.end(),
+          std::make_move_iterator(_recent.begin()),
+          std::make_move_iterator(_recent.end()));
+        _recent.clear();
+        std::inplace_merge(
+          _sorted.begin(), _sorted.begin() + mid, _sorted.end(), by_first);
+        build();
+    }
+
+    void sort_and_build() {
+        std::sort(_sorted.begin(), _sorted.end(), [](const T& a, const T& b) {
+            return a.first < b.first;
+        });
+        build();
+    }
+
+    void build() {
+        _leaves = 1;
+        while (_leaves < _sorted.size()) {
+            _leaves *= 2;
+        }
+        _max_last.assign(2 * _leaves, model::offset::min());
+        for (size_t i = 0; i < _sorted.size(); ++i) {
+            _max_last[_leaves + i] = _sorted[i].last;
+        }
+        for (size_t node = _leaves - 1; node > 0; --node) {
+            _max_last[node] = std::max(
+              _max_last[2 * node], _max_last[2 * node + 1]);
+        }
+    }
+
+    std::vector<T> _sorted;
+    std::vector<T> _recent;
+    // segment tree of the max last offset, the root is at 1 and the leaves
+    // for the sorted intervals start at _leaves
+    std::vector<model::offset> _max_last;
+    size_t _leaves{0};
+};
+
+} // namespace cluster
@@ -43,7 +43,8 @@ partition_balancer_backend::partition_balancer_backend(
   config::binding<unsigned>&& max_disk_usage_percent,
   config::binding<unsigned>&& storage_space_alert_free_threshold_percent,
   config::binding<std::chrono::milliseconds>&& tick_interval,
-  config::binding<size_t>&& movement_batch_size_bytes)
+  config::binding<size_t>&& movement_batch_size_bytes,
+  config::binding<std::optional<uint32_t>>&& core_imbalance_percent)
   : _raft0(std::move(raft0))
   , _controller_stm(controller_stm.local())
   , _topic_table(topic_table.local())
@@ -58,6 +59,7 @@ partition_balancer_backend::partition_balancer_backend(
       std::move(storage_space_alert_free_threshold_percent))
   , _tick_interval(std::move(tick_interval))
   , _movement_batch_size_bytes(std::move(movement_batch_size_bytes))
+  , _core_imbalance_percent(std::move(core_imbalance_percent))
   , _timer([this] { tick(); }) {}
 
 void partition_balancer_backend::start() {
@@ -152,6 +154,10 @@ ss::future<> partition_balancer_backend::do_tick() {
     double soft_max_disk_usage_ratio = _max_disk_usage_percent() / 100.0;
     double hard_max_disk_usage_ratio
       = (100 - _storage_space_alert_free_threshold_percent()) / 100.0;
+    std::optional<double> core_load_imbalance_ratio;
+    if (auto percent = _core_imbalance_percent(); percent) {
+        core_load_imbalance_ratio = *percent / 100.0;
+    }
     auto plan_data
       = partition_balancer_planner(
           planner_config{
@@ -159,6 +165,7 @@ ss::future<> partition_balancer_backend::do_tick() {
             .hard_max_disk_usage_ratio = hard_max_disk_usage_ratio,
             .movement_disk_size_batch = _movement_batch_size_bytes(),
             .node_availability_timeout_sec = _availability_timeout(),
+            .core_load_imbalance_ratio = core_load_imbalance_ratio,
           },
           _topic_table,
           _members_table,
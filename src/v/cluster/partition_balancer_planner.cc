@@ -16,6 +16,7 @@
 #include "cluster/scheduling/constraints.h"
 #include "cluster/scheduling/types.h"
 
+#include <numeric>
 #include <optional>
 
 namespace cluster {
@@ -148,9 +149,16 @@ void partition_balancer_planner::init_ntp_sizes_from_health_report(
     for (const auto& node_report : health_report.node_reports) {
         for (const auto& tp_ns : node_report.topics) {
             for (const auto& partition : tp_ns.partitions) {
-                rrs.ntp_sizes[model::ntp(
-                  tp_ns.tp_ns.ns, tp_ns.tp_ns.tp, partition.id)]
-                  = partition.size_bytes;
+                model::ntp ntp(tp_ns.tp_ns.ns, tp_ns.tp_ns.tp, partition.id);
+                if (partition.leader_id == node_report.id) {
+                    rrs.ntp_loads[ntp] = {
+                      .leader = node_report.id,
+                      .load = static_cast<double>(partition.bytes_rate)
+                              + static_cast<double>(partition.requests_rate)
+                                  * request_cost_bytes,
+                    };
+                }
+                rrs.ntp_sizes[std::move(ntp)] = partition.size_bytes;
             }
         }
     }
@@ -525,6 +533,162 @@ void partition_balancer_planner::get_full_node_reassignments(
     }
 }
 
+/*
+ * Function is trying to even out the load of the cores of every node by moving
+ * partition replicas between the cores of the same node. Such a move doesn't
+ * copy any data, the partition is stopped on the source core and started from
+ * the same log on the target one.
+ *
+ * Load of a leader replica is the throughput of its partition plus a fixed
+ * cost, followers only weigh the fixed cost, so that without any traffic the
+ * number of replicas per core is balanced. A
+ * replica is moved from the most loaded core of the node to the least loaded
+ * one only if it reduces the difference of their loads by a margin, the
+ * reported loads are noisy and the replicas would bounce between the cores
+ * otherwise.
+ */
+void partition_balancer_planner::get_core_imbalance_reassignments(
+  plan_data& result, reallocation_request_state& rrs) {
+    static constexpr size_t max_moves_per_node = 8;
+    static constexpr double improvement_margin = 0.1;
+
+    struct core_replica {
+        model::ntp ntp;
+        const partition_assignment* assignment;
+        double load;
+    };
+    struct node_cores {
+        std::vector<double> loads;
+        std::vector<std::vector<core_replica>> replicas;
+    };
+
+    absl::flat_hash_map<model::node_id, node_cores> nodes;
+    for (const auto& [id, node] :
+         _partition_allocator.state().allocation_nodes()) {
+        if (
+          !node->is_active() || rrs.all_unavailable_nodes.contains(id)
+          || rrs.decommissioning_nodes.contains(id)) {
+            continue;
+        }
+        auto& cores = nodes[id];
+        cores.loads.resize(node->cpus());
+        cores.replicas.resize(node->cpus());
+        // the partition slots reserved on the core are not available for
+        // the partitions, count them as idle replicas
+        for (ss::shard_id core = 0; core < node->cpus(); ++core) {
+            cores.loads[core] = node->reserved_partitions(core)
+                                * idle_group_load;
+        }
+    }
+
+    for (const auto& t : _topic_table.topics_map()) {
+        for (const auto& a : t.second.get_assignments()) {
+            model::ntp ntp(t.first.ns, t.first.tp, a.id);
+            auto leader_load = rrs.ntp_loads.find(ntp);
+            for (const auto& r : a.replicas) {
+                auto it = nodes.find(r.node_id);
+                if (it == nodes.end() || r.shard >= it->second.loads.size()) {
+                    continue;
+                }
+                // the traffic of the clients is served by the leader, the
+                // followers weigh as much as idle replicas
+                auto load = idle_group_load;
+                if (
+                  leader_load != rrs.ntp_loads.end()
+                  && leader_load->second.leader == r.node_id) {
+                    load += leader_load->second.load;
+                }
+                it->second.loads[r.shard] += load;
+                it->second.replicas[r.shard].push_back(
+                  core_replica{.ntp = ntp, .assignment = &a, .load = load});
+            }
+        }
+    }
+
+    for (auto& [id, cores] : nodes) {
+        auto& loads = cores.loads;
+        if (loads.size() < 2) {
+            continue;
+        }
+        double total = std::accumulate(loads.begin(), loads.end(), 0.0);
+        double max_load = total / loads.size()
+                          * (1 + *_config.core_load_imbalance_ratio);
+
+        for (size_t moves = 0; moves < max_moves_per_node; ++moves) {
+            size_t from = std::distance(
+              loads.begin(), std::max_element(loads.begin(), loads.end()));
+            size_t to = std::distance(
+              loads.begin(), std::min_element(loads.begin(), loads.end()));
+            if (loads[from] <= max_load) {
+                break;
+            }
+
+            // moving a replica of load w changes the sum of squared core
+            // loads by 2w(w - diff), pick the one with the largest decrease
+            auto diff = loads[from] - loads[to];
+            auto& candidates = cores.replicas[from];
+            std::optional<size_t> best;
+            double best_decrease = 0;
+            for (size_t i = 0; i < candidates.size(); ++i) {
+                const auto& c = candidates[i];
+                if (
+                  rrs.moving_partitions.contains(c.ntp)
+                  || diff <= c.load * (1 + improvement_margin)) {
+                    continue;
+                }
+                auto decrease = c.load * (diff - c.load);
+                if (decrease > best_decrease) {
+                    best_decrease = decrease;
+                    best = i;
+                }
+            }
+            if (!best) {
+                break;
+            }
+
+            auto replica = std::move(candidates[*best]);
+            std::swap(candidates[*best], candidates.back());
+            candidates.pop_back();
+
+            auto units = _partition_allocator.reallocate_replica_shard(
+              *replica.assignment,
+              model::broker_shard{.node_id = id, .shard = ss::shard_id(from)},
+              ss::shard_id(to),
+              get_allocation_domain(replica.ntp));
+            if (!units) {
+                vlog(
+                  clusterlog.debug,
+                  "unable to move replica of {} from core {} to {} on node "
+                  "{}: {}",
+                  replica.ntp,
+                  from,
+                  to,
+                  id,
+                  units.error().message());
+                result.failed_reassignments_count += 1;
+                break;
+            }
+
+            vlog(
+              clusterlog.debug,
+              "node {}: moving {} from core {} (load: {:.0f}) to core {} "
+              "(load: {:.0f})",
+              id,
+              replica.ntp,
+              from,
+              loads[from],
+              to,
+              loads[to]);
+            loads[from] -= replica.load;
+            loads[to] += replica.load;
+            rrs.moving_partitions.insert(replica.ntp);
+            result.reassignments.emplace_back(ntp_reassignments{
+              .ntp = std::move(replica.ntp),
+              .allocation_units = std::move(units.value())});
+        }
+    }
+}
+
 /*
  * Cancel movement if new assignments contains unavailble node
  * and previous replica set doesn't contain this node
@@ -596,10 +760,11 @@ partition_balancer_planner::plan_reassignments(
         return result;
     }
 
+    init_ntp_sizes_from_health_report(health_report, rrs);
+
     if (
       !_topic_table.has_updates_in_progress()
       && !result.violations.is_empty()) {
-        init_ntp_sizes_from_health_report(health_report, rrs);
         get_unavailable_nodes_reassignments(result, rrs);
         get_full_node_reassignments(result, rrs);
         if (!result.reassignments.empty()) {
@@ -609,6 +774,15 @@ partition_balancer_planner::plan_reassignments(
         return result;
     }
 
+    // partitions are moved between the cores of a node only when there is
+    // nothing to move between the nodes
+    if (_config.core_load_imbalance_ratio) {
+        get_core_imbalance_reassignments(result, rrs);
+        if (!result.reassignments.empty()) {
+            result.status = status::movement_planned;
+        }
+    }
+
     return result;
 }
 
@@ -34,6 +34,10 @@ struct planner_config {
     // Size of partitions that can be planned to move in one request
     size_t movement_disk_size_batch;
     std::chrono::seconds node_availability_timeout_sec;
+    // If the load of a core exceeds the average load of the cores of its node
+    // by more than this ratio planner will move partitions to the other cores
+    // of the node. Unset disables moving partitions between cores.
+    std::optional<double> core_load_imbalance_ratio;
 };
 
 class partition_balancer_planner {
@@ -73,6 +77,13 @@ private:
         absl::flat_hash_map<model::node_id, node_disk_space> node_disk_reports;
 
         absl::flat_hash_map<model::ntp, size_t> ntp_sizes;
+        // Throughput of the partitions as reported by their leaders, only the
+        // leader replica serves the clients
+        struct leader_load {
+            model::node_id leader;
+            double load;
+        };
+        absl::flat_hash_map<model::ntp, leader_load> ntp_loads;
 
         // Partitions that are planned to move in current planner request
         absl::flat_hash_set<model::ntp> moving_partitions;
@@ -99,6 +110,9 @@ private:
 
     void get_full_node_reassignments(plan_data&, reallocation_request_state&);
 
+    void get_core_imbalance_reassignments(
+      plan_data&, reallocation_request_state&);
+
     void init_per_node_state(
       const cluster_health_report&,
       const std::vector<raft::follower_metrics>&,
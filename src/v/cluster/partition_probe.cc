@@ -24,6 +24,29 @@ replicated_partition_probe::replicated_partition_probe(
   : _partition(p)
   , _public_metrics(ssx::metrics::public_metrics_handle) {}
 
+partition_load replicated_partition_probe::load() {
+    static constexpr auto min_sample_interval = std::chrono::seconds(1);
+
+    auto now = ss::lowres_clock::now();
+    if (now - _last_sample < min_sample_interval) {
+        return _load;
+    }
+    auto elapsed = std::chrono::duration<double>(now - _last_sample).count();
+    auto rate = [elapsed](uint64_t delta) {
+        return static_cast<uint64_t>(static_cast<double>(delta) / elapsed);
+    };
+    auto bytes = _bytes_produced + _bytes_fetched;
+    // the rates are smoothed so that a single burst of traffic doesn't make
+    // the partition look hot
+    _load.bytes_rate = (_load.bytes_rate + rate(bytes - _sampled_bytes)) / 2;
+    _load.requests_rate
+      = (_load.requests_rate + rate(_requests - _sampled_requests)) / 2;
+    _sampled_bytes = bytes;
+    _sampled_requests = _requests;
+    _last_sample = now;
+    return _load;
+}
+
 void replicated_partition_probe::setup_metrics(const model::ntp& ntp) {
     setup_internal_metrics(ntp);
     setup_public_metrics(ntp);
@@ -223,6 +246,7 @@ partition_probe make_materialized_partition_probe() {
         void add_records_produced(uint64_t) final {}
         void add_bytes_fetched(uint64_t) final {}
         void add_bytes_produced(uint64_t) final {}
+        partition_load load() final { return {}; }
     };
     return partition_probe(std::make_unique<impl>());
 }
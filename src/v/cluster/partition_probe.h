@@ -12,6 +12,7 @@
 #pragma once
 #include "model/fundamental.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/metrics_registration.hh>
 #include <seastar/core/shared_ptr.hh>
 
@@ -21,6 +22,12 @@ namespace cluster {
 
 class partition;
 
+/// Produce and fetch traffic of a partition, per second
+struct partition_load {
+    uint64_t bytes_rate{0};
+    uint64_t requests_rate{0};
+};
+
 class partition_probe {
 public:
     struct impl {
@@ -29,6 +36,7 @@ public:
         virtual void add_bytes_produced(uint64_t) = 0;
         virtual void add_bytes_fetched(uint64_t) = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
+        virtual partition_load load() = 0;
         virtual ~impl() noexcept = default;
     };
 
@@ -54,6 +62,9 @@ public:
         return _impl->add_bytes_fetched(bytes);
     }
 
+    /// Traffic averaged over the intervals between the calls
+    partition_load load() { return _impl->load(); }
+
 private:
     std::unique_ptr<impl> _impl;
 };
@@ -65,8 +76,15 @@ public:
 
     void add_records_fetched(uint64_t cnt) final { _records_fetched += cnt; }
     void add_records_produced(uint64_t cnt) final { _records_produced += cnt; }
-    void add_bytes_fetched(uint64_t cnt) final { _bytes_fetched += cnt; }
-    void add_bytes_produced(uint64_t cnt) final { _bytes_produced += cnt; }
+    void add_bytes_fetched(uint64_t cnt) final {
+        _bytes_fetched += cnt;
+        ++_requests;
+    }
+    void add_bytes_produced(uint64_t cnt) final {
+        _bytes_produced += cnt;
+        ++_requests;
+    }
+    partition_load load() final;
 
 private:
     void setup_public_metrics(const model::ntp&);
@@ -78,6 +96,12 @@ private:
     uint64_t _records_fetched{0};
     uint64_t _bytes_produced{0};
     uint64_t _bytes_fetched{0};
+    uint64_t _requests{0};
+    // totals at the last load sample
+    ss::lowres_clock::time_point _last_sample{ss::lowres_clock::now()};
+    uint64_t _sampled_bytes{0};
+    uint64_t _sampled_requests{0};
+    partition_load _load;
     ss::metrics::metric_groups _metrics;
     ss::metrics::metric_groups _public_metrics;
 };
@@ -0,0 +1,580 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/producer_state_table.h"
+
+#include "bytes/iobuf_parser.h"
+#include "cluster/logger.h"
+#include "hashing/crc32c.h"
+#include "reflection/adl.h"
+#include "ssx/future-util.h"
+#include "utils/directory_walker.h"
+#include "vassert.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+
+#include <optional>
+#include <regex>
+
+namespace cluster {
+
+static ss::sstring spill_file_name(int64_t generation) {
+    return fmt::format("seqs.spill.{}", generation);
+}
+
+namespace {
+
+/// Groups the entries sorted by the producer identity into the blocks of the
+/// on-disk table
+class block_writer {
+public:
+    block_writer(
+      ss::output_stream<char>& out,
+      uint64_t position,
+      model::timestamp::type expire_before)
+      : _out(out)
+      , _position(position)
+      , _expire_before(expire_before) {}
+
+    ss::future<> append(seq_entry entry) {
+        if (entry.last_write_timestamp <= _expire_before) {
+            return ss::now();
+        }
+        _block.push_back(std::move(entry));
+        if (_block.size() < producer_state_table::block_size) {
+            return ss::now();
+        }
+        return flush();
+    }
+
+    ss::future<> flush() {
+        if (_block.empty()) {
+            return ss::now();
+        }
+        producer_state_table::spill_block block{
+          .first = _block.front().pid,
+          .last = _block.back().pid,
+          .position = _position};
+        iobuf buf;
+        reflection::serialize(buf, std::exchange(_block, {}));
+        crc::crc32c crc;
+        crc_extend_iobuf(crc, buf);
+        block.size = buf.size_bytes();
+        block.crc = crc.value();
+        _position += block.size;
+        _blocks.push_back(block);
+        return write_iobuf_to_output_stream(std::move(buf), _out);
+    }
+
+    std::vector<producer_state_table::spill_block> release() && {
+        return std::move(_blocks);
+    }
+
+private:
+    ss::output_stream<char>& _out;
+    uint64_t _position;
+    model::timestamp::type _expire_before;
+    std::vector<seq_entry> _block;
+    std::vector<producer_state_table::spill_block> _blocks;
+};
+
+} // namespace
+
+producer_state_table::producer_state_table(
+  std::filesystem::path dir, size_t max_in_memory)
+  : _dir(std::move(dir))
+  , _max_in_memory(max_in_memory)
+  , _spill_mgr("seqs.spill", _dir, ss::default_priority_class()) {}
+
+const producer_state_table::spill_block*
+producer_state_table::segment::find_block(model::producer_identity pid) const {
+    auto it = std::partition_point(
+      blocks.begin(), blocks.end(), [pid](const spill_block& block) {
+          return block.last < pid;
+      });
+    if (it == blocks.end() || pid < it->first) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+ss::future<producer_state_table::pin>
+producer_state_table::prefetch(model::producer_identity pid) {
+    // pinning right away so a concurrent spill doesn't take the entry away
+    // between loading and using it
+    ++_pinned[pid];
+    pin p(this, pid);
+
+    while (true) {
+        if (auto n = find_node(pid); n) {
+            touch(*n);
+            co_return std::move(p);
+        }
+        auto seg = _segment;
+        if (!seg) {
+            co_return std::move(p);
+        }
+        auto block = seg->find_block(pid);
+        if (!block) {
+            co_return std::move(p);
+        }
+        auto entries = co_await read_block(seg, *block);
+        if (seg != _segment || find_node(pid)) {
+            // the table changed while reading, the entry may have been
+            // updated or spilled again
+            continue;
+        }
+        auto it = std::lower_bound(
+          entries.begin(),
+          entries.end(),
+          pid,
+          [](const seq_entry& entry, model::producer_identity pid) {
+              return entry.pid < pid;
+          });
+        if (it != entries.end() && it->pid == pid) {
+            auto& n = emplace_node(pid);
+            n.entry = std::move(*it);
+            n.dirty = false;
+        }
+        co_return std::move(p);
+    }
+}
+
+const seq_entry*
+producer_state_table::find(model::producer_identity pid) const {
+    if (auto it = _entries.find(pid); it != _entries.end()) {
+        return it->second.tombstone ? nullptr : &it->second.entry;
+    }
+    if (auto it = _spilling.find(pid); it != _spilling.end()) {
+        return it->second.tombstone ? nullptr : &it->second.entry;
+    }
+    return nullptr;
+}
+
+seq_entry* producer_state_table::find_for_update(model::producer_identity pid) {
+    auto n = find_node(pid);
+    if (!n || n->tombstone) {
+        return nullptr;
+    }
+    n->dirty = true;
+    touch(*n);
+    return &n->entry;
+}
+
+std::pair<seq_entry&, bool>
+producer_state_table::try_emplace(model::producer_identity pid) {
+    auto n = find_node(pid);
+    if (n && !n->tombstone) {
+        n->dirty = true;
+        touch(*n);
+        return {n->entry, false};
+    }
+    if (n) {
+        n->tombstone = false;
+        --_tombstones;
+    } else {
+        n = &emplace_node(pid);
+    }
+    n->dirty = true;
+    return {n->entry, true};
+}
+
+seq_entry& producer_state_table::reset(model::producer_identity pid) {
+    auto [entry, inserted] = try_emplace(pid);
+    if (!inserted) {
+        entry = seq_entry{};
+        entry.pid = pid;
+    }
+    return entry;
+}
+
+void producer_state_table::erase(model::producer_identity pid) {
+    auto it = _entries.find(pid);
+    if (it == _entries.end()) {
+        if (!may_be_on_disk(pid)) {
+            return;
+        }
+        emplace_node(pid);
+        it = _entries.find(pid);
+    }
+    erase(it);
+}
+
+void producer_state_table::erase(entries_t::iterator it) {
+    auto pid = it->first;
+    auto& n = it->second;
+    if (!may_be_on_disk(pid)) {
+        if (n.tombstone) {
+            --_tombstones;
+        }
+        _entries.erase(it);
+        return;
+    }
+    if (!n.tombstone) {
+        n.tombstone = true;
+        ++_tombstones;
+    }
+    n.entry = seq_entry{};
+    n.entry.pid = pid;
+    n.dirty = true;
+    touch(n);
+}
+
+producer_state_table::node&
+producer_state_table::emplace_node(model::producer_identity pid) {
+    auto [it, inserted] = _entries.try_emplace(pid);
+    auto& n = it->second;
+    if (inserted) {
+        n.entry.pid = pid;
+    }
+    touch(n);
+    return n;
+}
+
+producer_state_table::node*
+producer_state_table::find_node(model::producer_identity pid) {
+    if (auto it = _entries.find(pid); it != _entries.end()) {
+        return &it->second;
+    }
+    auto it = _spilling.find(pid);
+    if (it == _spilling.end()) {
+        return nullptr;
+    }
+    // the entry is being spilled, its in-memory copy takes precedence over
+    // the one written to disk
+    auto& n = emplace_node(pid);
+    n.entry = it->second.entry.copy();
+    n.tombstone = it->second.tombstone;
+    if (n.tombstone) {
+        ++_tombstones;
+    }
+    n.dirty = true;
+    return &n;
+}
+
+void producer_state_table::touch(node& n) {
+    n.hook.unlink();
+    _lru.push_back(n);
+}
+
+void producer_state_table::unpin(model::producer_identity pid) noexcept {
+    auto it = _pinned.find(pid);
+    if (it != _pinned.end() && --it->second == 0) {
+        _pinned.erase(it);
+    }
+}
+
+bool producer_state_table::may_be_on_disk(model::producer_identity pid) const {
+    return _spilling.contains(pid) || (_segment && _segment->find_block(pid));
+}
+
+ss::future<> producer_state_table::spill(
+  ss::noncopyable_function<bool(model::producer_identity)> is_pinned,
+  model::timestamp::type expire_before) {
+    vassert(_spilling.empty(), "concurrent spill of the producer state table");
+
+    const auto low_watermark = _max_in_memory / 2;
+    for (auto it = _lru.begin();
+         it != _lru.end() && _entries.size() > low_watermark;) {
+        auto& n = *it;
+        ++it;
+        auto pid = n.entry.pid;
+        if (_pinned.contains(pid) || is_pinned(pid)) {
+            continue;
+        }
+        // clean entries are already in the on-disk table
+        if (n.dirty) {
+            _spilling.emplace(
+              pid,
+              spilled_entry{
+                .entry = std::move(n.entry), .tombstone = n.tombstone});
+        }
+        if (n.tombstone) {
+            --_tombstones;
+        }
+        _entries.erase(pid);
+    }
+    if (_spilling.empty()) {
+        co_return;
+    }
+
+    auto epoch = _epoch;
+    std::exception_ptr ex;
+    try {
+        co_await write_spilled(expire_before);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    if (ex) {
+        if (epoch == _epoch) {
+            restore_spilled();
+        }
+        _spilling.clear();
+        std::rethrow_exception(ex);
+    }
+    _spilling.clear();
+}
+
+void producer_state_table::restore_spilled() {
+    for (auto& [pid, spilled] : _spilling) {
+        if (_entries.contains(pid)) {
+            continue;
+        }
+        auto& n = emplace_node(pid);
+        n.entry = std::move(spilled.entry);
+        n.tombstone = spilled.tombstone;
+        if (n.tombstone) {
+            ++_tombstones;
+        }
+        n.dirty = true;
+    }
+}
+
+ss::future<>
+producer_state_table::write_spilled(model::timestamp::type expire_before) {
+    std::vector<spilled_entry> spilled;
+    spilled.reserve(_spilling.size());
+    for (const auto& [_, e] : _spilling) {
+        spilled.push_back(
+          spilled_entry{.entry = e.entry.copy(), .tombstone = e.tombstone});
+    }
+    std::sort(
+      spilled.begin(),
+      spilled.end(),
+      [](const spilled_entry& a, const spilled_entry& b) {
+          return a.entry.pid < b.entry.pid;
+      });
+
+    auto epoch = _epoch;
+    auto old = _segment;
+    std::optional<ss::gate::holder> old_holder;
+    if (old) {
+        old_holder.emplace(old->reads);
+    }
+
+    auto generation = _next_generation++;
+    auto writer = co_await _spill_mgr.start_snapshot(
+      spill_file_name(generation));
+    std::vector<spill_block> blocks;
+    std::exception_ptr ex;
+    try {
+        iobuf meta;
+        reflection::serialize(meta, spill_version, generation);
+        uint64_t position = storage::snapshot_header::ondisk_size
+                            + meta.size_bytes();
+        co_await writer.write_metadata(std::move(meta));
+
+        // merging the previous generation with the spilled entries, the
+        // spilled ones are newer
+        block_writer out(writer.output(), position, expire_before);
+        auto it = spilled.begin();
+        if (old) {
+            for (const auto& block : old->blocks) {
+                auto entries = co_await read_block(old, block);
+                for (auto& entry : entries) {
+                    while (it != spilled.end() && it->entry.pid < entry.pid) {
+                        if (!it->tombstone) {
+                            co_await out.append(std::move(it->entry));
+                        }
+                        ++it;
+                    }
+                    if (it != spilled.end() && it->entry.pid == entry.pid) {
+                        if (!it->tombstone) {
+                            co_await out.append(std::move(it->entry));
+                        }
+                        ++it;
+                        continue;
+                    }
+                    co_await out.append(std::move(entry));
+                }
+            }
+        }
+        for (; it != spilled.end(); ++it) {
+            if (!it->tombstone) {
+                co_await out.append(std::move(it->entry));
+            }
+        }
+        co_await out.flush();
+        blocks = std::move(out).release();
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    try {
+        co_await writer.close();
+    } catch (...) {
+        if (!ex) {
+            ex = std::current_exception();
+        }
+    }
+    if (ex) {
+        co_await _spill_mgr.remove_partial_snapshots();
+        std::rethrow_exception(ex);
+    }
+    co_await _spill_mgr.finish_snapshot(writer);
+    _generations.push_back(generation);
+
+    if (epoch != _epoch) {
+        // the table was cleared while writing, the file is removed with the
+        // other unreferenced generations
+        co_return;
+    }
+    vlog(
+      clusterlog.debug,
+      "spilled {} producers to {}, {} blocks",
+      spilled.size(),
+      spill_file_name(generation),
+      blocks.size());
+    co_await open_segment(generation, std::move(blocks));
+}
+
+ss::future<std::vector<seq_entry>> producer_state_table::read_block(
+  ss::lw_shared_ptr<segment> seg, spill_block block) {
+    auto holder = seg->reads.hold();
+    auto buf = co_await seg->file.dma_read_exactly<char>(
+      block.position, block.size, ss::default_priority_class());
+    if (buf.size() != block.size) {
+        throw std::runtime_error(fmt::format(
+          "Short read of a block of {} at {}: {} != {}",
+          spill_file_name(seg->generation),
+          block.position,
+          buf.size(),
+          block.size));
+    }
+    crc::crc32c crc;
+    crc.extend(buf.get(), buf.size());
+    if (crc.value() != block.crc) {
+        throw std::runtime_error(fmt::format(
+          "Corrupt block of {} at {}: crc {} != {}",
+          spill_file_name(seg->generation),
+          block.position,
+          crc.value(),
+          block.crc));
+    }
+    iobuf data;
+    data.append(std::move(buf));
+    iobuf_parser parser(std::move(data));
+    co_return reflection::adl<std::vector<seq_entry>>{}.from(parser);
+}
+
+ss::future<> producer_state_table::open_segment(
+  int64_t generation, std::vector<spill_block> blocks) {
+    auto file = co_await ss::open_file_dma(
+      _spill_mgr.snapshot_path(spill_file_name(generation)).string(),
+      ss::open_flags::ro);
+    auto seg = ss::make_lw_shared<segment>();
+    seg->generation = generation;
+    seg->blocks = std::move(blocks);
+    seg->file = std::move(file);
+    if (auto old = std::exchange(_segment, seg); old) {
+        retire(std::move(old));
+    }
+}
+
+void producer_state_table::retire(ss::lw_shared_ptr<segment> seg) {
+    ssx::spawn_with_gate(_gate, [seg] {
+        return seg->reads.close().then([seg] { return seg->file.close(); });
+    });
+}
+
+producer_state_table::spill_state
+producer_state_table::get_spill_state() const {
+    spill_state state;
+    if (_segment) {
+        state.generation = _segment->generation;
+        state.blocks = _segment->blocks;
+    }
+    for (const auto& [pid, n] : _entries) {
+        if (n.tombstone) {
+            state.erased.push_back(pid);
+        }
+    }
+    return state;
+}
+
+ss::future<> producer_state_table::apply_spill_state(spill_state state) {
+    if (state.generation >= 0) {
+        _next_generation = std::max(_next_generation, state.generation + 1);
+        _generations.push_back(state.generation);
+        co_await open_segment(state.generation, std::move(state.blocks));
+    }
+    for (auto pid : state.erased) {
+        erase(pid);
+    }
+}
+
+ss::future<>
+producer_state_table::remove_unreferenced(std::vector<int64_t> referenced) {
+    if (_segment) {
+        referenced.push_back(_segment->generation);
+    }
+    std::vector<int64_t> unreferenced;
+    std::erase_if(_generations, [&referenced, &unreferenced](int64_t g) {
+        if (std::find(referenced.begin(), referenced.end(), g)
+            != referenced.end()) {
+            return false;
+        }
+        unreferenced.push_back(g);
+        return true;
+    });
+    for (auto g : unreferenced) {
+        co_await _spill_mgr.remove_snapshot(spill_file_name(g));
+    }
+}
+
+ss::future<> producer_state_table::remove_unused_files() {
+    co_await _spill_mgr.remove_partial_snapshots();
+
+    std::regex re(R"(^seqs\.spill\.(\d+)$)");
+    std::vector<ss::sstring> unused;
+    co_await directory_walker::walk(
+      _dir.string(), [this, &re, &unused](ss::directory_entry ent) {
+          if (!ent.type || *ent.type != ss::directory_entry_type::regular) {
+              return ss::now();
+          }
+          std::cmatch match;
+          if (std::regex_match(ent.name.c_str(), match, re)) {
+              auto generation = std::stoll(match[1].str());
+              if (!_segment || _segment->generation != generation) {
+                  unused.push_back(ent.name);
+              }
+          }
+          return ss::now();
+      });
+    for (const auto& name : unused) {
+        co_await _spill_mgr.remove_snapshot(name);
+    }
+}
+
+ss::future<> producer_state_table::remove_persistent_state() {
+    clear();
+    auto generations = std::exchange(_generations, {});
+    for (auto g : generations) {
+        co_await _spill_mgr.remove_snapshot(spill_file_name(g));
+    }
+    co_await _spill_mgr.remove_partial_snapshots();
+}
+
+void producer_state_table::clear() {
+    _lru.clear();
+    _entries.clear();
+    _tombstones = 0;
+    _spilling.clear();
+    ++_epoch;
+    if (_segment) {
+        retire(std::exchange(_segment, nullptr));
+    }
+}
+
+ss::future<> producer_state_table::stop() {
+    clear();
+    return _gate.close();
+}
+
+} // namespace cluster
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "model/timestamp.h"
+#include "seastarx.h"
+#include "storage/snapshot.h"
+#include "utils/intrusive_list_helpers.h"
+
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/file.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
+
+#include <filesystem>
+#include <vector>
+
+namespace cluster {
+
+struct seq_cache_entry {
+    int32_t seq{-1};
+    kafka::offset offset;
+};
+
+struct seq_entry {
+    static const int seq_cache_size = 5;
+    model::producer_identity pid;
+    int32_t seq{-1};
+    kafka::offset last_offset{-1};
+    ss::circular_buffer<seq_cache_entry> seq_cache;
+    model::timestamp::type last_write_timestamp;
+
+    seq_entry copy() const {
+        seq_entry ret;
+        ret.pid = pid;
+        ret.seq = seq;
+        ret.last_offset = last_offset;
+        ret.seq_cache.reserve(seq_cache.size());
+        std::copy(
+          seq_cache.cbegin(),
+          seq_cache.cend(),
+          std::back_inserter(ret.seq_cache));
+        ret.last_write_timestamp = last_write_timestamp;
+        return ret;
+    }
+
+    void update(int32_t new_seq, kafka::offset new_offset) {
+        if (new_seq < seq) {
+            return;
+        }
+
+        if (seq == new_seq) {
+            last_offset = new_offset;
+            return;
+        }
+
+        if (seq >= 0 && last_offset >= kafka::offset{0}) {
+            auto entry = seq_cache_entry{.seq = seq, .offset = last_offset};
+            seq_cache.push_back(entry);
+            while (seq_cache.size() >= seq_entry::seq_cache_size) {
+                seq_cache.pop_front();
+            }
+        }
+
+        seq = new_seq;
+        last_offset = new_offset;
+    }
+};
+
+/**
+ * \brief The seq entries of the idempotent producers of a partition with a
+ * bounded in-memory working set.
+ *
+ * The entries are kept in memory in the order of their last use. Once there
+ * are more than max_in_memory of them spill() moves the least recently used
+ * ones, down to a half of the limit, into an on-disk table sorted by the
+ * producer identity. Every spill writes a new generation of the table: the
+ * previous one merged with the spilled entries, minus the expired ones. Only
+ * the index of its blocks is kept in memory and the entries are read back on
+ * demand by prefetch().
+ *
+ * The in-memory entries shadow the on-disk ones. Erasing an entry which may
+ * be on disk leaves a tombstone until the next spill, so that a stale entry
+ * is never read back: the idempotency checks rely on a missing entry meaning
+ * an unknown producer.
+ *
+ * Lookups don't touch the disk, a producer has to be prefetched before its
+ * entry is accessed. The returned pin keeps the entry in memory.
+ */
+class producer_state_table {
+public:
+    static constexpr int8_t spill_version = 0;
+    /// Number of entries in a block of the on-disk table
+    static constexpr size_t block_size = 256;
+
+    struct spill_block {
+        model::producer_identity first;
+        model::producer_identity last;
+        uint64_t position;
+        uint32_t size;
+        uint32_t crc;
+    };
+
+    /// The on-disk part of the table, a part of the rm_stm snapshot
+    struct spill_state {
+        int64_t generation{-1};
+        std::vector<spill_block> blocks;
+        /// erased producers which may still be in the on-disk table
+        std::vector<model::producer_identity> erased;
+    };
+
+    /// Keeps a prefetched entry in memory
+    class pin {
+    public:
+        pin() = default;
+        pin(producer_state_table* table, model::producer_identity pid)
+          : _table(table)
+          , _pid(pid) {}
+        pin(const pin&) = delete;
+        pin& operator=(const pin&) = delete;
+        pin(pin&& o) noexcept
+          : _table(std::exchange(o._table, nullptr))
+          , _pid(o._pid) {}
+        pin& operator=(pin&& o) noexcept {
+            if (this != &o) {
+                release();
+                _table = std::exchange(o._table, nullptr);
+                _pid = o._pid;
+            }
+            return *this;
+        }
+        ~pin() noexcept { release(); }
+
+    private:
+        void release() noexcept {
+            if (_table) {
+                _table->unpin(_pid);
+                _table = nullptr;
+            }
+        }
+
+        producer_state_table* _table{nullptr};
+        model::producer_identity _pid;
+    };
+
+    producer_state_table(std::filesystem::path dir, size_t max_in_memory);
+    producer_state_table(const producer_state_table&) = delete;
+    producer_state_table& operator=(const producer_state_table&) = delete;
+    producer_state_table(producer_state_table&&) = delete;
+    producer_state_table& operator=(producer_state_table&&) = delete;
+    ~producer_state_table() noexcept = default;
+
+    /// Loads the entry of the producer from disk unless it's in memory
+    ss::future<pin> prefetch(model::producer_identity);
+
+    /// The in-memory entry, nullptr if the producer is unknown or isn't
+    /// prefetched
+    const seq_entry* find(model::producer_identity) const;
+    seq_entry* find_for_update(model::producer_identity);
+    /// The entry of the producer and whether it was created
+    std::pair<seq_entry&, bool> try_emplace(model::producer_identity);
+    /// Replaces the entry of the producer with an empty one
+    seq_entry& reset(model::producer_identity);
+    void erase(model::producer_identity);
+
+    template<typename Pred>
+    void remove_if(Pred&& pred) {
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            auto current = it++;
+            if (!current->second.tombstone && pred(current->second.entry)) {
+                erase(current);
+            }
+        }
+    }
+
+    /// Calls f for every in-memory entry
+    template<typename Func>
+    void for_each(Func&& f) const {
+        for (const auto& [_, n] : _entries) {
+            if (!n.tombstone) {
+                f(n.entry);
+            }
+        }
+    }
+
+    /// Calls f for every in-memory entry which isn't on disk
+    template<typename Func>
+    void for_each_dirty(Func&& f) const {
+        for (const auto& [_, n] : _entries) {
+            if (!n.tombstone && n.dirty) {
+                f(n.entry);
+            }
+        }
+    }
+
+    /// Number of the in-memory entries
+    size_t size() const { return _entries.size() - _tombstones; }
+    bool needs_spill() const { return _entries.size() > _max_in_memory; }
+
+    /// Moves the least recently used entries which aren't pinned to disk
+    /// and drops the on-disk entries written before expire_before.
+    ss::future<> spill(
+      ss::noncopyable_function<bool(model::producer_identity)> is_pinned,
+      model::timestamp::type expire_before);
+
+    spill_state get_spill_state() const;
+    /// Restores the on-disk part of the table from a snapshot
+    ss::future<> apply_spill_state(spill_state);
+
+    /// Removes the files of the generations other than the current one which
+    /// aren't referenced by a snapshot
+    ss::future<> remove_unreferenced(std::vector<int64_t> referenced);
+    /// Removes the spill files which aren't a part of the table
+    ss::future<> remove_unused_files();
+    ss::future<> remove_persistent_state();
+
+    void clear();
+    ss::future<> stop();
+
+private:
+    struct node {
+        seq_entry entry;
+        // the entry isn't in the on-disk table
+        bool dirty{true};
+        bool tombstone{false};
+        intrusive_list_hook hook;
+    };
+    using entries_t = absl::node_hash_map<model::producer_identity, node>;
+
+    struct spilled_entry {
+        seq_entry entry;
+        bool tombstone{false};
+    };
+
+    struct segment {
+        int64_t generation;
+        std::vector<spill_block> blocks;
+        ss::file file;
+        ss::gate reads;
+
+        const spill_block* find_block(model::producer_identity) const;
+    };
+
+    node& emplace_node(model::producer_identity);
+    node* find_node(model::producer_identity);
+    void erase(entries_t::iterator);
+    void touch(node&);
+    void unpin(model::producer_identity) noexcept;
+    bool may_be_on_disk(model::producer_identity) const;
+
+    ss::future<std::vector<seq_entry>>
+      read_block(ss::lw_shared_ptr<segment>, spill_block);
+    ss::future<> write_spilled(model::timestamp::type expire_before);
+    void restore_spilled();
+    ss::future<> open_segment(int64_t, std::vector<spill_block>);
+    void retire(ss::lw_shared_ptr<segment>);
+
+    std::filesystem::path _dir;
+    size_t _max_in_memory;
+    storage::snapshot_manager _spill_mgr;
+    entries_t _entries;
+    // the least recently used entry is at the front
+    intrusive_list<node, &node::hook> _lru;
+    size_t _tombstones{0};
+    absl::flat_hash_map<model::producer_identity, uint32_t> _pinned;
+    // entries being written to disk by spill(), readable until it finishes
+    absl::flat_hash_map<model::producer_identity, spilled_entry> _spilling;
+    ss::lw_shared_ptr<segment> _segment;
+    int64_t _next_generation{0};
+    // generations of the on-disk table with a file
+    std::vector<int64_t> _generations;
+    // changes when the table is cleared
+    uint64_t _epoch{0};
+    ss::gate _gate;
+};
+
+} // namespace cluster
@@ -19,12 +19,15 @@
 #include "cluster/tx_helpers.h"
 #include "config/configuration.h"
 #include "errc.h"
+#include "features/feature_table.h"
 #include "rpc/connection_cache.h"
 #include "types.h"
 #include "vformat.h"
 
 #include <seastar/core/coroutine.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <algorithm>
 
 namespace cluster {
@@ -747,4 +750,252 @@ ss::future<abort_tx_reply> rm_partition_frontend::do_abort_tx(
       });
 }
 
+namespace {
+
+ss::future<tx_errc> write_tx_marker(
+  cluster::partition_manager& mgr,
+  const tx_markers_request& request,
+  const tx_marker_partition& rm) {
+    auto partition = mgr.get(rm.ntp);
+    if (!partition) {
+        return ss::make_ready_future<tx_errc>(tx_errc::partition_not_found);
+    }
+
+    auto stm = partition->rm_stm();
+
+    if (!stm) {
+        vlog(txlog.warn, "can't get tx stm of the {}' partition", rm.ntp);
+        return ss::make_ready_future<tx_errc>(tx_errc::stm_not_found);
+    }
+
+    switch (request.type) {
+    case tx_marker_type::prepare:
+        return stm->prepare_tx(
+          rm.etag, request.tm, request.pid, request.tx_seq, request.timeout);
+    case tx_marker_type::commit:
+        return stm->commit_tx(request.pid, request.tx_seq, request.timeout);
+    case tx_marker_type::abort:
+        return stm->abort_tx(request.pid, request.tx_seq, request.timeout);
+    }
+    __builtin_unreachable();
+}
+
+ss::future<std::vector<tx_errc>> write_tx_markers_on_shard(
+  cluster::partition_manager& mgr, tx_markers_request request) {
+    // the markers are replicated concurrently so the partitions of the
+    // shard make progress (and flush) together instead of one by one
+    std::vector<ss::future<tx_errc>> fs;
+    fs.reserve(request.partitions.size());
+    for (const auto& rm : request.partitions) {
+        fs.push_back(write_tx_marker(mgr, request, rm));
+    }
+    co_return co_await ss::when_all_succeed(fs.begin(), fs.end());
+}
+
+tx_markers_request make_tx_markers_request(
+  const tx_markers_request& base,
+  const std::vector<tx_marker_partition>& partitions,
+  const std::vector<size_t>& indexes) {
+    tx_markers_request request;
+    request.type = base.type;
+    request.tm = base.tm;
+    request.pid = base.pid;
+    request.tx_seq = base.tx_seq;
+    request.timeout = base.timeout;
+    request.partitions.reserve(indexes.size());
+    for (auto i : indexes) {
+        request.partitions.push_back(partitions[i]);
+    }
+    return request;
+}
+
+void scatter_tx_results(
+  std::vector<tx_errc>& results,
+  const std::vector<size_t>& indexes,
+  const std::vector<tx_errc>& replies) {
+    for (size_t i = 0; i < indexes.size(); ++i) {
+        results[indexes[i]] = i < replies.size()
+                                ? replies[i]
+                                : tx_errc::unknown_server_error;
+    }
+}
+
+} // namespace
+
+ss::future<std::vector<tx_errc>> rm_partition_frontend::write_tx_markers(
+  tx_marker_type type,
+  model::partition_id tm,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  std::vector<tx_marker_partition> partitions,
+  model::timeout_clock::duration timeout) {
+    if (!_controller->get_feature_table().local().is_active(
+          features::feature::tx_batched_markers)) {
+        co_return co_await write_tx_markers_one_by_one(
+          type, tm, pid, tx_seq, std::move(partitions), timeout);
+    }
+
+    std::vector<tx_errc> results(partitions.size(), tx_errc::none);
+    absl::flat_hash_map<model::node_id, std::vector<size_t>> by_leader;
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        const auto& ntp = partitions[i].ntp;
+        auto nt = model::topic_namespace_view(ntp);
+        if (!_metadata_cache.local().contains(nt, ntp.tp.partition)) {
+            results[i] = tx_errc::partition_not_exists;
+            continue;
+        }
+        auto leader = _leaders.local().get_leader(ntp);
+        if (!leader) {
+            vlog(txlog.warn, "can't find a leader for {}", ntp);
+            results[i] = tx_errc::leader_not_found;
+            continue;
+        }
+        by_leader[*leader].push_back(i);
+    }
+
+    tx_markers_request base;
+    base.type = type;
+    base.tm = tm;
+    base.pid = pid;
+    base.tx_seq = tx_seq;
+    base.timeout = timeout;
+
+    auto self = _controller->self();
+    std::vector<ss::future<>> fs;
+    fs.reserve(by_leader.size());
+    for (const auto& [leader, indexes] : by_leader) {
+        auto request = make_tx_markers_request(base, partitions, indexes);
+        if (leader != self) {
+            vlog(
+              txlog.trace,
+              "dispatching name:tx_markers, type:{}, pid:{}, tx_seq:{}, "
+              "partitions:{}, from:{}, to:{}",
+              type,
+              pid,
+              tx_seq,
+              indexes.size(),
+              self,
+              leader);
+        }
+        auto f = leader == self
+                   ? write_tx_markers_locally(std::move(request))
+                   : dispatch_tx_markers(leader, std::move(request));
+        fs.push_back(
+          f.then([&results, &indexes = indexes](tx_markers_reply reply) {
+              scatter_tx_results(results, indexes, reply.results);
+          }));
+    }
+    co_await ss::when_all_succeed(fs.begin(), fs.end());
+    co_return results;
+}
+
+ss::future<std::vector<tx_errc>>
+rm_partition_frontend::write_tx_markers_one_by_one(
+  tx_marker_type type,
+  model::partition_id tm,
+  model::producer_identity pid,
+  model::tx_seq tx_seq,
+  std::vector<tx_marker_partition> partitions,
+  model::timeout_clock::duration timeout) {
+    std::vector<ss::future<tx_errc>> fs;
+    fs.reserve(partitions.size());
+    for (auto& rm : partitions) {
+        switch (type) {
+        case tx_marker_type::prepare:
+            fs.push_back(
+              prepare_tx(rm.ntp, rm.etag, tm, pid, tx_seq, timeout)
+                .then([](prepare_tx_reply r) { return r.ec; }));
+            break;
+        case tx_marker_type::commit:
+            fs.push_back(commit_tx(rm.ntp, pid, tx_seq, timeout)
+                           .then([](commit_tx_reply r) { return r.ec; }));
+            break;
+        case tx_marker_type::abort:
+            fs.push_back(abort_tx(rm.ntp, pid, tx_seq, timeout)
+                           .then([](abort_tx_reply r) { return r.ec; }));
+            break;
+        }
+    }
+    co_return co_await ss::when_all_succeed(fs.begin(), fs.end());
+}
+
+ss::future<tx_markers_reply> rm_partition_frontend::dispatch_tx_markers(
+  model::node_id leader, tx_markers_request request) {
+    auto timeout = request.timeout;
+    auto size = request.partitions.size();
+    return _connection_cache.local()
+      .with_node_client<cluster::tx_gateway_client_protocol>(
+        _controller->self(),
+        ss::this_shard_id(),
+        leader,
+        timeout,
+        [request = std::move(request),
+         timeout](tx_gateway_client_protocol cp) mutable {
+            return cp.write_tx_markers(
+              std::move(request),
+              rpc::client_opts(model::timeout_clock::now() + timeout));
+        })
+      .then(&rpc::get_ctx_data<tx_markers_reply>)
+      .then([size](result<tx_markers_reply> r) {
+          if (r.has_error()) {
+              vlog(
+                txlog.warn, "got error {} on remote tx markers", r.error());
+              tx_markers_reply reply;
+              reply.results.assign(size, tx_errc::timeout);
+              return reply;
+          }
+
+          return r.value();
+      });
+}
+
+ss::future<tx_markers_reply>
+rm_partition_frontend::write_tx_markers_locally(tx_markers_request request) {
+    vlog(txlog.trace, "processing name:tx_markers, {}", request);
+    tx_markers_reply reply;
+    reply.results.assign(request.partitions.size(), tx_errc::none);
+
+    absl::flat_hash_map<ss::shard_id, std::vector<size_t>> by_shard;
+    for (size_t i = 0; i < request.partitions.size(); ++i) {
+        const auto& ntp = request.partitions[i].ntp;
+        if (!is_leader_of(ntp)) {
+            reply.results[i] = tx_errc::leader_not_found;
+            continue;
+        }
+        auto shard = _shard_table.local().shard_for(ntp);
+        if (!shard) {
+            reply.results[i] = tx_errc::shard_not_found;
+            continue;
+        }
+        by_shard[*shard].push_back(i);
+    }
+
+    std::vector<ss::future<>> fs;
+    fs.reserve(by_shard.size());
+    for (const auto& [shard, indexes] : by_shard) {
+        fs.push_back(
+          _partition_manager
+            .invoke_on(
+              shard,
+              _ssg,
+              [shard_request = make_tx_markers_request(
+                 request, request.partitions, indexes)](
+                cluster::partition_manager& mgr) mutable {
+                  return write_tx_markers_on_shard(
+                    mgr, std::move(shard_request));
+              })
+            .then([&reply, &indexes = indexes](std::vector<tx_errc> results) {
+                scatter_tx_results(reply.results, indexes, results);
+            }));
+    }
+    co_await ss::when_all_succeed(fs.begin(), fs.end());
+    vlog(
+      txlog.trace,
+      "sending name:tx_markers, pid:{}, tx_seq:{}, {}",
+      request.pid,
+      request.tx_seq,
+      reply);
+    co_return reply;
+}
+
 } // namespace cluster
@@ -55,6 +55,17 @@ public:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    /// Writes the markers of a transaction to its partitions. The markers
+    /// are grouped by the partitions' leaders: every other node gets a
+    /// single rpc and every local shard a single cross shard call. The
+    /// results are in the order of the partitions.
+    ss::future<std::vector<tx_errc>> write_tx_markers(
+      tx_marker_type,
+      model::partition_id,
+      model::producer_identity,
+      model::tx_seq,
+      std::vector<tx_marker_partition>,
+      model::timeout_clock::duration);
     ss::future<> stop() {
         _as.request_abort();
         return ss::make_ready_future<>();
@@ -146,6 +157,17 @@ private:
       model::tx_seq,
       model::timeout_clock::duration);
 
+    ss::future<std::vector<tx_errc>> write_tx_markers_one_by_one(
+      tx_marker_type,
+      model::partition_id,
+      model::producer_identity,
+      model::tx_seq,
+      std::vector<tx_marker_partition>,
+      model::timeout_clock::duration);
+    ss::future<tx_markers_reply>
+      dispatch_tx_markers(model::node_id, tx_markers_request);
+    ss::future<tx_markers_reply> write_tx_markers_locally(tx_markers_request);
+
     friend tx_gateway;
 };
 } // namespace cluster
@@ -222,12 +222,27 @@ struct tx_snapshot_v1 {
     std::vector<seq_entry_v1> seqs;
 };
 
+struct tx_snapshot_v2 {
+    static constexpr uint8_t version = 2;
+
+    std::vector<model::producer_identity> fenced;
+    std::vector<rm_stm::tx_range> ongoing;
+    std::vector<rm_stm::prepare_marker> prepared;
+    std::vector<rm_stm::tx_range> aborted;
+    std::vector<rm_stm::abort_index> abort_indexes;
+    model::offset offset;
+    std::vector<rm_stm::seq_entry> seqs;
+};
+
 rm_stm::rm_stm(
   ss::logger& logger,
   raft::consensus* c,
   ss::sharded<cluster::tx_gateway_frontend>& tx_gateway_frontend,
   ss::sharded<features::feature_table>& feature_table)
   : persisted_stm("tx.snapshot", logger, c)
+  , _log_state(
+      std::filesystem::path(c->log_config().work_directory()),
+      config::shard_local_cfg().seq_table_max_in_memory.value())
   , _oldest_session(model::timestamp::now())
   , _sync_timeout(config::shard_local_cfg().rm_sync_timeout_ms.value())
   , _tx_timeout_delay(config::shard_local_cfg().tx_timeout_delay_ms.value())
@@ -852,12 +867,15 @@ ss::future<result<kafka_result>> rm_stm::do_replicate(
 
 ss::future<> rm_stm::stop() {
     auto_abort_timer.cancel();
-    return raft::state_machine::stop();
+    abort_snapshot_cache::local().evict(_abort_snapshot_owner);
+    return raft::state_machine::stop().then(
+      [this] { return _log_state.seq_table.stop(); });
 }
 
 ss::future<> rm_stm::start() {
     _translator = _c->get_offset_translator_state();
-    return persisted_stm::start();
+    return persisted_stm::start().then(
+      [this] { return _log_state.seq_table.remove_unused_files(); });
 }
 
 rm_stm::transaction_info::status_t
@@ -946,7 +964,7 @@ rm_stm::do_mark_expired(model::producer_identity pid) {
 }
 
 bool rm_stm::check_seq(model::batch_identity bid) {
-    auto& seq = _log_state.seq_table[bid.pid];
+    auto& seq = _log_state.seq_table.try_emplace(bid.pid).first;
     auto last_write_timestamp = model::timestamp::now().value();
 
     if (!is_sequence(seq.seq, bid.first_seq)) {
@@ -966,13 +984,13 @@ bool rm_stm::check_seq(model::batch_identity bid) {
 std::optional<kafka::offset>
 rm_stm::known_seq(model::batch_identity bid) const {
     auto pid_seq = _log_state.seq_table.find(bid.pid);
-    if (pid_seq == _log_state.seq_table.end()) {
+    if (!pid_seq) {
         return std::nullopt;
     }
-    if (pid_seq->second.seq == bid.last_seq) {
-        return pid_seq->second.last_offset;
+    if (pid_seq->seq == bid.last_seq) {
+        return pid_seq->last_offset;
     }
-    for (auto& entry : pid_seq->second.seq_cache) {
+    for (auto& entry : pid_seq->seq_cache) {
         if (entry.seq == bid.last_seq) {
             return entry.offset;
         }
@@ -982,24 +1000,21 @@ rm_stm::known_seq(model::batch_identity bid) const {
 
 std::optional<int32_t> rm_stm::tail_seq(model::producer_identity pid) const {
     auto pid_seq = _log_state.seq_table.find(pid);
-    if (pid_seq == _log_state.seq_table.end()) {
+    if (!pid_seq) {
         return std::nullopt;
     }
-    return pid_seq->second.seq;
+    return pid_seq->seq;
 }
 
 void rm_stm::set_seq(model::batch_identity bid, kafka::offset last_offset) {
-    auto pid_seq = _log_state.seq_table.find(bid.pid);
-    if (pid_seq != _log_state.seq_table.end()) {
-        if (pid_seq->second.seq == bid.last_seq) {
-            pid_seq->second.last_offset = last_offset;
-        }
+    auto pid_seq = _log_state.seq_table.find_for_update(bid.pid);
+    if (pid_seq && pid_seq->seq == bid.last_seq) {
+        pid_seq->last_offset = last_offset;
     }
 }
 
 void rm_stm::reset_seq(model::batch_identity bid) {
-    _log_state.seq_table.erase(bid.pid);
-    auto& seq = _log_state.seq_table[bid.pid];
+    auto& seq = _log_state.seq_table.reset(bid.pid);
     seq.seq = bid.last_seq;
     seq.last_offset = kafka::offset{-1};
     seq.pid = bid.pid;
@@ -1014,6 +1029,10 @@ rm_stm::replicate_tx(model::batch_identity bid, model::record_batch_reader br) {
         co_return errc::generic_tx_error;
     }
 
+    // loading the seq entry of an idle producer spilled to disk, the pin
+    // keeps it in memory until the request is done
+    auto seq_pin = co_await _log_state.seq_table.prefetch(bid.pid);
+
     if (!co_await sync(_sync_timeout)) {
         co_return errc::not_leader;
     }
@@ -1134,6 +1153,8 @@ ss::future<result<kafka_result>> rm_stm::replicate_seq(
   ss::lw_shared_ptr<available_promise<>> enqueued) {
     using ret_t = result<kafka_result>;
 
+    auto seq_pin = co_await _log_state.seq_table.prefetch(bid.pid);
+
     if (!co_await sync(_sync_timeout)) {
         // it's ok not to set enqueued on early return because
         // the safety check in replicate_in_stages sets it automatically
@@ -1321,14 +1342,12 @@ ss::future<result<kafka_result>> rm_stm::replicate_seq(
             // apply will do it for us
             break;
         }
-        auto [seq_it, inserted] = _log_state.seq_table.try_emplace(bid.pid);
+        auto [seq, inserted] = _log_state.seq_table.try_emplace(bid.pid);
         if (inserted) {
-            seq_it->second.pid = bid.pid;
-            seq_it->second.seq = front->last_seq;
-            seq_it->second.last_offset = front->r.value().last_offset;
+            seq.seq = front->last_seq;
+            seq.last_offset = front->r.value().last_offset;
         } else {
-            seq_it->second.update(
-              front->last_seq, front->r.value().last_offset);
+            seq.update(front->last_seq, front->r.value().last_offset);
         }
         session->cache.pop_front();
     }
@@ -1389,22 +1408,6 @@ model::offset rm_stm::last_stable_offset() {
     return model::next_offset(last_visible_index);
 }
 
-static void filter_intersecting(
-  std::vector<rm_stm::tx_range>& target,
-  const std::vector<rm_stm::tx_range>& source,
-  model::offset from,
-  model::offset to) {
-    for (auto& range : source) {
-        if (range.last < from) {
-            continue;
-        }
-        if (range.first > to) {
-            continue;
-        }
-        target.push_back(range);
-    }
-}
-
 ss::future<std::vector<rm_stm::tx_range>>
 rm_stm::aborted_transactions(model::offset from, model::offset to) {
     return _state_lock.hold_read_lock().then(
@@ -1420,33 +1423,47 @@ rm_stm::do_aborted_transactions(model::offset from, model::offset to) {
     if (!_is_tx_enabled) {
         co_return result;
     }
+    auto collect = [&result](const tx_range& range) {
+        result.push_back(range);
+    };
+
     std::vector<abort_index> intersecting_idxes;
-    for (const auto& idx : _log_state.abort_indexes) {
-        if (idx.last < from) {
-            continue;
-        }
-        if (idx.first > to) {
-            continue;
-        }
-        if (_log_state.last_abort_snapshot.match(idx)) {
-            auto opt = _log_state.last_abort_snapshot;
-            filter_intersecting(result, opt.aborted, from, to);
-        } else {
-            intersecting_idxes.push_back(idx);
-        }
-    }
+    _log_state.abort_indexes.for_each_intersecting(
+      from, to, [&intersecting_idxes](const abort_index& idx) {
+          intersecting_idxes.push_back(idx);
+      });
 
-    filter_intersecting(result, _log_state.aborted, from, to);
+    _log_state.aborted.for_each_intersecting(from, to, collect);
 
     for (const auto& idx : intersecting_idxes) {
-        auto opt = co_await load_abort_snapshot(idx);
-        if (opt) {
-            filter_intersecting(result, opt->aborted, from, to);
+        auto aborted = co_await get_abort_snapshot(idx);
+        if (aborted) {
+            aborted->for_each_intersecting(from, to, collect);
         }
     }
     co_return result;
 }
 
+ss::future<rm_stm::aborted_index_ptr>
+rm_stm::get_abort_snapshot(abort_index idx) {
+    return abort_snapshot_cache::local().get(
+      _abort_snapshot_owner, idx.first, idx.last, [this, idx] {
+          return load_abort_snapshot(idx).then(
+            [](std::optional<abort_snapshot> snapshot) -> aborted_index_ptr {
+                if (!snapshot) {
+                    return nullptr;
+                }
+                return ss::make_lw_shared<offset_interval_index<tx_range>>(
+                  std::move(snapshot->aborted));
+            });
+      });
+}
+
+void rm_stm::evict_abort_snapshot(abort_index idx) {
+    abort_snapshot_cache::local().evict(
+      _abort_snapshot_owner, idx.first, idx.last);
+}
+
 void rm_stm::compact_snapshot() {
     auto cutoff_timestamp = model::timestamp::now().value()
                             - _transactional_id_expiration.count();
@@ -1464,11 +1481,9 @@ void rm_stm::compact_snapshot() {
 
     std::vector<model::timestamp::type> lw_tss;
     lw_tss.reserve(_log_state.seq_table.size());
-    for (auto it = _log_state.seq_table.cbegin();
-         it != _log_state.seq_table.cend();
-         it++) {
-        lw_tss.push_back(it->second.last_write_timestamp);
-    }
+    _log_state.seq_table.for_each([&lw_tss](const seq_entry& entry) {
+        lw_tss.push_back(entry.last_write_timestamp);
+    });
     std::sort(lw_tss.begin(), lw_tss.end());
     auto pivot = lw_tss[lw_tss.size() - 1 - _seq_table_min_size];
 
@@ -1478,20 +1493,17 @@ void rm_stm::compact_snapshot() {
 
     auto next_oldest_session = model::timestamp::now();
     auto size = _log_state.seq_table.size();
-    for (auto it = _log_state.seq_table.cbegin();
-         it != _log_state.seq_table.cend();) {
+    _log_state.seq_table.remove_if([&](const seq_entry& entry) {
         if (
           size > _seq_table_min_size
-          && it->second.last_write_timestamp <= cutoff_timestamp) {
+          && entry.last_write_timestamp <= cutoff_timestamp) {
             size--;
-            _log_state.seq_table.erase(it++);
-        } else {
-            next_oldest_session = std::min(
-              next_oldest_session,
-              model::timestamp(it->second.last_write_timestamp));
-            ++it;
+            return true;
         }
-    }
+        next_oldest_session = std::min(
+          next_oldest_session, model::timestamp(entry.last_write_timestamp));
+        return false;
+    });
     _oldest_session = next_oldest_session;
 }
 
@@ -1763,6 +1775,10 @@ ss::future<> rm_stm::apply(model::record_batch b) {
         if (hdr.attrs.is_control()) {
             co_await apply_control(bid.pid, parse_control_batch(b));
         } else {
+            producer_state_table::pin seq_pin;
+            if (bid.has_idempotent()) {
+                seq_pin = co_await _log_state.seq_table.prefetch(bid.pid);
+            }
             apply_data(bid, last_offset);
         }
     }
@@ -1770,6 +1786,11 @@ ss::future<> rm_stm::apply(model::record_batch b) {
     _insync_offset = last_offset;
 
     compact_snapshot();
+    if (
+      _log_state.seq_table.needs_spill() && !_is_seq_spill_requested
+      && active_snapshot_version() == tx_snapshot::version) {
+        ssx::spawn_with_gate(_gate, [this] { return spill_seq_table(); });
+    }
     if (_is_autoabort_enabled && !_is_autoabort_active) {
         abort_old_txes();
     }
@@ -1793,7 +1814,7 @@ ss::future<> rm_stm::apply_control(
         auto offset_it = _log_state.ongoing_map.find(pid);
         if (offset_it != _log_state.ongoing_map.end()) {
             // make a list
-            _log_state.aborted.push_back(offset_it->second);
+            _log_state.aborted.add(offset_it->second);
             _log_state.ongoing_set.erase(offset_it->second.first);
             _log_state.ongoing_map.erase(pid);
         }
@@ -1832,18 +1853,38 @@ ss::future<> rm_stm::reduce_aborted_list() {
       [this] { _is_abort_idx_reduction_requested = false; });
 }
 
+ss::future<> rm_stm::spill_seq_table() {
+    if (_is_seq_spill_requested) {
+        return ss::now();
+    }
+    if (!_log_state.seq_table.needs_spill()) {
+        return ss::now();
+    }
+    // the snapshot spills the idle producers
+    _is_seq_spill_requested = true;
+    return make_snapshot().finally(
+      [this] { _is_seq_spill_requested = false; });
+}
+
+bool rm_stm::is_seq_pinned(model::producer_identity pid) const {
+    // the entries of the producers with requests in flight or an ongoing
+    // transaction are about to be used
+    return _inflight_requests.contains(pid)
+           || _log_state.ongoing_map.contains(pid)
+           || _mem_state.inflight.contains(pid);
+}
+
 void rm_stm::apply_data(model::batch_identity bid, model::offset last_offset) {
     if (bid.has_idempotent()) {
-        auto [seq_it, inserted] = _log_state.seq_table.try_emplace(bid.pid);
+        auto [seq, inserted] = _log_state.seq_table.try_emplace(bid.pid);
         auto translated = from_log_offset(last_offset);
         if (inserted) {
-            seq_it->second.pid = bid.pid;
-            seq_it->second.seq = bid.last_seq;
-            seq_it->second.last_offset = translated;
+            seq.seq = bid.last_seq;
+            seq.last_offset = translated;
         } else {
-            seq_it->second.update(bid.last_seq, translated);
+            seq.update(bid.last_seq, translated);
         }
-        seq_it->second.last_write_timestamp = bid.first_timestamp.value();
+        seq.last_write_timestamp = bid.first_timestamp.value();
         _oldest_session = std::min(_oldest_session, bid.first_timestamp);
     }
 
@@ -1888,6 +1929,15 @@ rm_stm::apply_snapshot(stm_snapshot_header hdr, iobuf&& tx_ss_buf) {
     iobuf_parser data_parser(std::move(tx_ss_buf));
     if (hdr.version == tx_snapshot::version) {
         data = reflection::adl<tx_snapshot>{}.from(data_parser);
+    } else if (hdr.version == tx_snapshot_v2::version) {
+        auto data_v2 = reflection::adl<tx_snapshot_v2>{}.from(data_parser);
+        data.fenced = std::move(data_v2.fenced);
+        data.ongoing = std::move(data_v2.ongoing);
+        data.prepared = std::move(data_v2.prepared);
+        data.aborted = std::move(data_v2.aborted);
+        data.abort_indexes = std::move(data_v2.abort_indexes);
+        data.offset = std::move(data_v2.offset);
+        data.seqs = std::move(data_v2.seqs);
     } else if (hdr.version == tx_snapshot_v1::version) {
         auto data_v1 = reflection::adl<tx_snapshot_v1>{}.from(data_parser);
         data.fenced = std::move(data_v1.fenced);
@@ -1951,35 +2001,32 @@ rm_stm::apply_snapshot(stm_snapshot_header hdr, iobuf&& tx_ss_buf) {
         _log_state.prepared.emplace(entry.pid, entry);
     }
     _log_state.aborted.insert(
-      _log_state.aborted.end(),
       std::make_move_iterator(data.aborted.begin()),
       std::make_move_iterator(data.aborted.end()));
     _log_state.abort_indexes.insert(
-      _log_state.abort_indexes.end(),
       std::make_move_iterator(data.abort_indexes.begin()),
       std::make_move_iterator(data.abort_indexes.end()));
+    auto spill_generation = data.spilled_seqs.generation;
+    co_await _log_state.seq_table.apply_spill_state(
+      std::move(data.spilled_seqs));
+    _seq_spill_snapshots.clear();
+    _seq_spill_snapshots.emplace_back(data.offset, spill_generation);
     for (auto& entry : data.seqs) {
-        auto [seq_it, inserted] = _log_state.seq_table.try_emplace(
-          entry.pid, std::move(entry));
-        // try_emplace does not move from r-value reference if the insertion
-        // didn't take place so the clang-tidy warning is a false positive
-        // NOLINTNEXTLINE(hicpp-invalid-access-moved)
-        if (!inserted && seq_it->second.seq < entry.seq) {
-            seq_it->second = std::move(entry);
+        auto [seq, inserted] = _log_state.seq_table.try_emplace(entry.pid);
+        if (inserted || seq.seq < entry.seq) {
+            seq = std::move(entry);
         }
     }
 
     abort_index last{.last = model::offset(-1)};
-    for (auto& entry : _log_state.abort_indexes) {
+    _log_state.abort_indexes.for_each([&last](const abort_index& entry) {
         if (entry.last > last.last) {
             last = entry;
         }
-    }
+    });
     if (last.last > model::offset(0)) {
-        auto snapshot_opt = co_await load_abort_snapshot(last);
-        if (snapshot_opt) {
-            _log_state.last_abort_snapshot = snapshot_opt.value();
-        }
+        // warm up the cache with the most recent snapshot
+        co_await get_abort_snapshot(last);
     }
 
     _last_snapshot_offset = data.offset;
@@ -1988,9 +2035,13 @@ rm_stm::apply_snapshot(stm_snapshot_header hdr, iobuf&& tx_ss_buf) {
 
 uint8_t rm_stm::active_snapshot_version() {
     if (_feature_table.local().is_active(
-          features::feature::rm_stm_kafka_cache)) {
+          features::feature::rm_stm_spill_seqs)) {
         return tx_snapshot::version;
     }
+    if (_feature_table.local().is_active(
+          features::feature::rm_stm_kafka_cache)) {
+        return tx_snapshot_v2::version;
+    }
     return tx_snapshot_v1::version;
 }
 
@@ -2005,12 +2056,12 @@ void rm_stm::fill_snapshot_wo_seqs(T& snapshot) {
     for (auto& entry : _log_state.prepared) {
         snapshot.prepared.push_back(entry.second);
     }
-    for (auto& entry : _log_state.aborted) {
+    _log_state.aborted.for_each([&snapshot](const tx_range& entry) {
         snapshot.aborted.push_back(entry);
-    }
-    for (auto& entry : _log_state.abort_indexes) {
+    });
+    _log_state.abort_indexes.for_each([&snapshot](const abort_index& entry) {
         snapshot.abort_indexes.push_back(entry);
-    }
+    });
 }
 
 ss::future<> rm_stm::offload_aborted_txns() {
@@ -2025,47 +2076,42 @@ ss::future<> rm_stm::offload_aborted_txns() {
     // this situation, offload_aborted_txns should be invoked only
     // under _state_lock's write lock because all the other updators
     // use the read lock.
-    std::sort(
-      std::begin(_log_state.aborted),
-      std::end(_log_state.aborted),
-      [](tx_range a, tx_range b) { return a.first < b.first; });
+    const auto& aborted = _log_state.aborted.sorted();
 
     abort_snapshot snapshot{
       .first = model::offset::max(), .last = model::offset::min()};
-    for (auto const& entry : _log_state.aborted) {
+    for (auto const& entry : aborted) {
         snapshot.first = std::min(snapshot.first, entry.first);
         snapshot.last = std::max(snapshot.last, entry.last);
         snapshot.aborted.push_back(entry);
         if (snapshot.aborted.size() == _abort_index_segment_size) {
             auto idx = abort_index{
               .first = snapshot.first, .last = snapshot.last};
-            _log_state.abort_indexes.push_back(idx);
+            _log_state.abort_indexes.add(idx);
             co_await save_abort_snapshot(snapshot);
             snapshot = abort_snapshot{
               .first = model::offset::max(), .last = model::offset::min()};
         }
     }
-    _log_state.aborted = snapshot.aborted;
+    _log_state.aborted = offset_interval_index<tx_range>(
+      std::move(snapshot.aborted));
 }
 
 ss::future<stm_snapshot> rm_stm::take_snapshot() {
     auto start_offset = _raft->start_offset();
 
-    std::vector<abort_index> abort_indexes;
     std::vector<abort_index> expired_abort_indexes;
-    abort_indexes.reserve(_log_state.abort_indexes.size());
-
-    for (const auto& idx : _log_state.abort_indexes) {
-        if (idx.last < start_offset) {
-            // caching expired indexes instead of removing them as we go
-            // to avoid giving control to another coroutine and managing
-            // concurrent access to _log_state.abort_indexes
-            expired_abort_indexes.push_back(idx);
-        } else {
-            abort_indexes.push_back(idx);
-        }
-    }
-    _log_state.abort_indexes = std::move(abort_indexes);
+    _log_state.abort_indexes.remove_if(
+      [start_offset, &expired_abort_indexes](const abort_index& idx) {
+          if (idx.last < start_offset) {
+              // caching expired indexes instead of removing them as we go
+              // to avoid giving control to another coroutine and managing
+              // concurrent access to _log_state.abort_indexes
+              expired_abort_indexes.push_back(idx);
+              return true;
+          }
+          return false;
+      });
 
     vlog(
       _ctx_log.debug,
@@ -2074,18 +2120,15 @@ ss::future<stm_snapshot> rm_stm::take_snapshot() {
       start_offset);
 
     for (const auto& idx : expired_abort_indexes) {
+        evict_abort_snapshot(idx);
         auto filename = abort_idx_name(idx.first, idx.last);
         co_await _abort_snapshot_mgr.remove_snapshot(filename);
     }
 
-    std::vector<tx_range> aborted;
-    aborted.reserve(_log_state.aborted.size());
-    std::copy_if(
-      _log_state.aborted.begin(),
-      _log_state.aborted.end(),
-      std::back_inserter(aborted),
-      [start_offset](tx_range range) { return range.last >= start_offset; });
-    _log_state.aborted = std::move(aborted);
+    _log_state.aborted.remove_if(
+      [start_offset](const tx_range& range) {
+          return range.last < start_offset;
+      });
 
     if (_log_state.aborted.size() > _abort_index_segment_size) {
         co_await _state_lock.hold_write_lock().then(
@@ -2102,18 +2145,53 @@ ss::future<stm_snapshot> rm_stm::take_snapshot() {
     iobuf tx_ss_buf;
     auto version = active_snapshot_version();
     if (version == tx_snapshot::version) {
+        // the spilled generations which can't be referenced by the
+        // persisted snapshot anymore
+        while (_seq_spill_snapshots.size() > 1
+               && _seq_spill_snapshots[1].first <= _last_snapshot_offset) {
+            _seq_spill_snapshots.pop_front();
+        }
+        std::vector<int64_t> referenced;
+        for (const auto& [_, generation] : _seq_spill_snapshots) {
+            referenced.push_back(generation);
+        }
+        co_await _log_state.seq_table.remove_unreferenced(
+          std::move(referenced));
+
+        if (_log_state.seq_table.needs_spill()) {
+            auto expire_before = model::timestamp::now().value()
+                                 - _transactional_id_expiration.count();
+            co_await _log_state.seq_table.spill(
+              [this](model::producer_identity pid) {
+                  return is_seq_pinned(pid);
+              },
+              expire_before);
+        }
+
+        // the entries in the spilled table are only referenced, so the
+        // snapshot grows with the number of recently active producers
         tx_snapshot tx_ss;
         fill_snapshot_wo_seqs(tx_ss);
-        for (const auto& entry : _log_state.seq_table) {
-            tx_ss.seqs.push_back(entry.second.copy());
-        }
+        _log_state.seq_table.for_each_dirty([&tx_ss](const seq_entry& entry) {
+            tx_ss.seqs.push_back(entry.copy());
+        });
+        tx_ss.spilled_seqs = _log_state.seq_table.get_spill_state();
         tx_ss.offset = _insync_offset;
+        _seq_spill_snapshots.emplace_back(
+          tx_ss.offset, tx_ss.spilled_seqs.generation);
         reflection::adl<tx_snapshot>{}.to(tx_ss_buf, std::move(tx_ss));
+    } else if (version == tx_snapshot_v2::version) {
+        tx_snapshot_v2 tx_ss;
+        fill_snapshot_wo_seqs(tx_ss);
+        _log_state.seq_table.for_each([&tx_ss](const seq_entry& entry) {
+            tx_ss.seqs.push_back(entry.copy());
+        });
+        tx_ss.offset = _insync_offset;
+        reflection::adl<tx_snapshot_v2>{}.to(tx_ss_buf, std::move(tx_ss));
     } else if (version == tx_snapshot_v1::version) {
         tx_snapshot_v1 tx_ss;
         fill_snapshot_wo_seqs(tx_ss);
-        for (const auto& it : _log_state.seq_table) {
-            auto& entry = it.second;
+        _log_state.seq_table.for_each([this, &tx_ss](const seq_entry& entry) {
             seq_entry_v1 seqs;
             seqs.pid = entry.pid;
             seqs.seq = entry.seq;
@@ -2121,7 +2199,7 @@ ss::future<stm_snapshot> rm_stm::take_snapshot() {
                 seqs.last_offset = to_log_offset(entry.last_offset);
             } catch (...) {
                 // ignoring outside the translation range errors
-                continue;
+                return;
             }
             seqs.last_write_timestamp = entry.last_write_timestamp;
             seqs.seq_cache.reserve(seqs.seq_cache.size());
@@ -2135,7 +2213,7 @@ ss::future<stm_snapshot> rm_stm::take_snapshot() {
                 }
             }
             tx_ss.seqs.push_back(std::move(seqs));
-        }
+        });
         tx_ss.offset = _insync_offset;
         reflection::adl<tx_snapshot_v1>{}.to(tx_ss_buf, std::move(tx_ss));
     } else {
@@ -2211,19 +2289,28 @@ ss::future<> rm_stm::remove_persistent_state() {
 }
 
 ss::future<> rm_stm::do_remove_persistent_state() {
-    for (const auto& idx : _log_state.abort_indexes) {
+    abort_snapshot_cache::local().evict(_abort_snapshot_owner);
+    std::vector<abort_index> abort_indexes;
+    _log_state.abort_indexes.for_each(
+      [&abort_indexes](const abort_index& idx) {
+          abort_indexes.push_back(idx);
+      });
+    for (const auto& idx : abort_indexes) {
         auto filename = abort_idx_name(idx.first, idx.last);
         co_await _abort_snapshot_mgr.remove_snapshot(filename);
     }
     co_await _abort_snapshot_mgr.remove_partial_snapshots();
+    _seq_spill_snapshots.clear();
+    co_await _log_state.seq_table.remove_persistent_state();
     co_return co_await persisted_stm::remove_persistent_state();
 }
 
 ss::future<> rm_stm::handle_eviction() {
     return _state_lock.hold_write_lock().then(
       [this]([[maybe_unused]] ss::basic_rwlock<>::holder unit) {
-          _log_state = {};
+          _log_state.reset();
           _mem_state = {};
+          abort_snapshot_cache::local().evict(_abort_snapshot_owner);
           set_next(_c->start_offset());
           return ss::now();
       });
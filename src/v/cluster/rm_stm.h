@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include "cluster/abort_snapshot_cache.h"
+#include "cluster/offset_interval_index.h"
 #include "cluster/persisted_stm.h"
+#include "cluster/producer_state_table.h"
 #include "cluster/tx_utils.h"
 #include "cluster/types.h"
 #include "config/configuration.h"
@@ -29,10 +32,13 @@
 #include "utils/mutex.h"
 #include "utils/prefix_logger.h"
 
+#include <seastar/core/shared_future.hh>
+
 #include <absl/container/btree_map.h>
 #include <absl/container/btree_set.h>
 #include <absl/container/flat_hash_map.h>
 
+#include <deque>
 #include <system_error>
 
 namespace cluster {
@@ -71,58 +77,11 @@ public:
         model::producer_identity pid;
     };
 
-    struct seq_cache_entry {
-        int32_t seq{-1};
-        kafka::offset offset;
-    };
-
-    struct seq_entry {
-        static const int seq_cache_size = 5;
-        model::producer_identity pid;
-        int32_t seq{-1};
-        kafka::offset last_offset{-1};
-        ss::circular_buffer<seq_cache_entry> seq_cache;
-        model::timestamp::type last_write_timestamp;
-
-        seq_entry copy() const {
-            seq_entry ret;
-            ret.pid = pid;
-            ret.seq = seq;
-            ret.last_offset = last_offset;
-            ret.seq_cache.reserve(seq_cache.size());
-            std::copy(
-              seq_cache.cbegin(),
-              seq_cache.cend(),
-              std::back_inserter(ret.seq_cache));
-            ret.last_write_timestamp = last_write_timestamp;
-            return ret;
-        }
-
-        void update(int32_t new_seq, kafka::offset new_offset) {
-            if (new_seq < seq) {
-                return;
-            }
-
-            if (seq == new_seq) {
-                last_offset = new_offset;
-                return;
-            }
-
-            if (seq >= 0 && last_offset >= kafka::offset{0}) {
-                auto entry = seq_cache_entry{.seq = seq, .offset = last_offset};
-                seq_cache.push_back(entry);
-                while (seq_cache.size() >= seq_entry::seq_cache_size) {
-                    seq_cache.pop_front();
-                }
-            }
-
-            seq = new_seq;
-            last_offset = new_offset;
-        }
-    };
+    using seq_cache_entry = cluster::seq_cache_entry;
+    using seq_entry = cluster::seq_entry;
 
     struct tx_snapshot {
-        static constexpr uint8_t version = 2;
+        static constexpr uint8_t version = 3;
 
         std::vector<model::producer_identity> fenced;
         std::vector<tx_range> ongoing;
@@ -130,7 +89,9 @@ public:
         std::vector<tx_range> aborted;
         std::vector<abort_index> abort_indexes;
         model::offset offset;
+        // entries which aren't a part of the spilled seq table
         std::vector<seq_entry> seqs;
+        producer_state_table::spill_state spilled_seqs;
     };
 
     struct abort_snapshot {
@@ -293,6 +254,12 @@ private:
     ss::future<std::optional<abort_snapshot>> load_abort_snapshot(abort_index);
     ss::future<> save_abort_snapshot(abort_snapshot);
 
+    using aborted_index_ptr = abort_snapshot_cache::index_ptr;
+    /// Aborted transactions of the abort index, loaded through the cache of
+    /// the recently used snapshots. nullptr if the snapshot doesn't exist.
+    ss::future<aborted_index_ptr> get_abort_snapshot(abort_index);
+    void evict_abort_snapshot(abort_index);
+
     bool check_seq(model::batch_identity);
     std::optional<kafka::offset> known_seq(model::batch_identity) const;
     void set_seq(model::batch_identity, kafka::offset);
@@ -352,6 +319,8 @@ private:
     void apply_data(model::batch_identity, model::offset);
 
     ss::future<> reduce_aborted_list();
+    ss::future<> spill_seq_table();
+    bool is_seq_pinned(model::producer_identity) const;
     ss::future<> offload_aborted_txns();
 
     // The state of this state machine maybe change via two paths
@@ -371,6 +340,19 @@ private:
     // to replay replicated commands and mem_state to keep the effect of
     // not replicated yet commands.
     struct log_state {
+        log_state(std::filesystem::path spill_dir, size_t max_seqs_in_memory)
+          : seq_table(std::move(spill_dir), max_seqs_in_memory) {}
+
+        void reset() {
+            fence_pid_epoch.clear();
+            ongoing_map.clear();
+            ongoing_set.clear();
+            prepared.clear();
+            aborted.clear();
+            abort_indexes.clear();
+            seq_table.clear();
+        }
+
         // we enforce monotonicity of epochs related to the same producer_id
         // and fence off out of order requests
         absl::flat_hash_map<model::producer_id, model::producer_epoch>
@@ -380,15 +362,15 @@ private:
         // a heap of the first offsets of the ongoing transactions
         absl::btree_set<model::offset> ongoing_set;
         absl::flat_hash_map<model::producer_identity, prepare_marker> prepared;
-        std::vector<tx_range> aborted;
-        std::vector<abort_index> abort_indexes;
-        abort_snapshot last_abort_snapshot{.last = model::offset(-1)};
+        offset_interval_index<tx_range> aborted;
+        offset_interval_index<abort_index> abort_indexes;
         // the only piece of data which we update on replay and before
         // replicating the command. we use the highest seq number to resolve
         // conflicts. if the replication fails we reject a command but clients
         // by spec should be ready for thier commands being rejected so it's
-        // ok by design to have false rejects
-        absl::flat_hash_map<model::producer_identity, seq_entry> seq_table;
+        // ok by design to have false rejects. idle producers are spilled to
+        // disk, a producer has to be prefetched before accessing its entry
+        producer_state_table seq_table;
     };
 
     struct mem_state {
@@ -523,6 +505,7 @@ private:
 
     ss::basic_rwlock<> _state_lock;
     bool _is_abort_idx_reduction_requested{false};
+    bool _is_seq_spill_requested{false};
     absl::flat_hash_map<model::producer_id, ss::lw_shared_ptr<mutex>> _tx_locks;
     absl::flat_hash_map<
       model::producer_identity,
@@ -530,6 +513,14 @@ private:
       _inflight_requests;
     log_state _log_state;
     mem_state _mem_state;
+    // offsets of the snapshots referencing a generation of the spilled seq
+    // table, the front one is persisted. its files are removed once all the
+    // snapshots referencing them are superseded
+    std::deque<std::pair<model::offset, int64_t>> _seq_spill_snapshots;
+    // abort snapshots loaded by read_committed fetches are kept in the cache
+    // shared by all partitions of the shard under this id
+    abort_snapshot_cache::owner_id _abort_snapshot_owner{
+      abort_snapshot_cache::local().register_owner()};
     ss::timer<clock_type> auto_abort_timer;
     model::timestamp _oldest_session;
     std::chrono::milliseconds _sync_timeout;
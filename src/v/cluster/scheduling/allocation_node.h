@@ -100,6 +100,11 @@ public:
         _rack = std::move(rack);
     }
 
+    // Partition slots of the core that are kept free for the controller
+    uint32_t reserved_partitions(ss::shard_id core) const {
+        return core == 0 ? static_cast<uint32_t>(_shard0_reserved) : 0;
+    }
+
     allocation_capacity allocated_partitions() const {
         return _allocated_partitions;
     }
@@ -259,6 +259,136 @@ soft_constraint_evaluator distinct_rack(
     return soft_constraint_evaluator(std::make_unique<impl>(replicas, state));
 }
 
+void allocation_load_report::snapshot_allocations(
+  const allocation_state& state) {
+    uint64_t disk_total = 0;
+    uint64_t disk_used = 0;
+    double throughput = 0;
+    uint32_t cores = 0;
+    for (auto& [id, load] : nodes) {
+        auto it = state.allocation_nodes().find(id);
+        if (it == state.allocation_nodes().end()) {
+            continue;
+        }
+        load.allocated_partitions = it->second->allocated_partitions()();
+        disk_total += load.disk_total;
+        disk_used += load.disk_used;
+        throughput += load.throughput;
+        cores += it->second->cpus();
+    }
+    disk_usage_ratio = disk_total == 0 ? 0
+                                       : static_cast<double>(disk_used)
+                                           / static_cast<double>(disk_total);
+    throughput_per_core = cores == 0 ? 0 : throughput / cores;
+}
+
+uint32_t allocation_load_report::allocated_since(
+  const allocation_node& node, const node_load& load) const {
+    auto allocated = node.allocated_partitions()();
+    return allocated > load.allocated_partitions
+             ? allocated - load.allocated_partitions
+             : 0;
+}
+
+soft_constraint_evaluator least_disk_used(
+  const allocation_load_report& report,
+  const double max_disk_usage_ratio,
+  const double weight) {
+    class impl : public soft_constraint_evaluator::impl {
+    public:
+        static constexpr double disk_usage_slack = 0.1;
+
+        impl(
+          const allocation_load_report& report,
+          const double max_disk_usage_ratio,
+          const double weight)
+          : _report(report)
+          , _max_disk_usage_ratio(max_disk_usage_ratio)
+          , _max_score(static_cast<uint64_t>(
+              soft_constraint_evaluator::max_score
+              * std::clamp(weight, 0.0, 1.0))) {}
+
+        uint64_t score(const allocation_node& node) const final {
+            auto it = _report.nodes.find(node.id());
+            if (it == _report.nodes.end() || it->second.disk_total == 0) {
+                return _max_score;
+            }
+            const auto& load = it->second;
+            auto used = load.disk_used
+                        + _report.allocated_since(node, load)
+                            * _report.partition_size;
+            auto ratio = static_cast<double>(used)
+                         / static_cast<double>(load.disk_total);
+            auto threshold = std::min(
+              _report.disk_usage_ratio + disk_usage_slack,
+              _max_disk_usage_ratio);
+            if (ratio <= threshold) {
+                return _max_score;
+            }
+            if (ratio >= _max_disk_usage_ratio) {
+                return 0;
+            }
+            return static_cast<uint64_t>(
+              _max_score * (_max_disk_usage_ratio - ratio)
+              / (_max_disk_usage_ratio - threshold));
+        }
+
+        void print(std::ostream& o) const final {
+            fmt::print(o, "least used disk");
+        }
+
+        const allocation_load_report& _report;
+        const double _max_disk_usage_ratio;
+        const uint64_t _max_score;
+    };
+
+    return soft_constraint_evaluator(
+      std::make_unique<impl>(report, max_disk_usage_ratio, weight));
+}
+
+soft_constraint_evaluator
+least_throughput(const allocation_load_report& report, const double weight) {
+    class impl : public soft_constraint_evaluator::impl {
+    public:
+        static constexpr double throughput_slack = 0.2;
+
+        impl(const allocation_load_report& report, const double weight)
+          : _report(report)
+          , _max_score(static_cast<uint64_t>(
+              soft_constraint_evaluator::max_score
+              * std::clamp(weight, 0.0, 1.0))) {}
+
+        uint64_t score(const allocation_node& node) const final {
+            auto it = _report.nodes.find(node.id());
+            if (
+              it == _report.nodes.end() || node.cpus() == 0
+              || _report.throughput_per_core <= 0) {
+                return _max_score;
+            }
+            const auto& load = it->second;
+            auto throughput = load.throughput
+                              + _report.allocated_since(node, load)
+                                  * _report.partition_throughput;
+            auto per_core = throughput / node.cpus();
+            auto threshold = _report.throughput_per_core
+                             * (1 + throughput_slack);
+            if (per_core <= threshold) {
+                return _max_score;
+            }
+            return static_cast<uint64_t>(_max_score * threshold / per_core);
+        }
+
+        void print(std::ostream& o) const final {
+            fmt::print(o, "least throughput per core");
+        }
+
+        const allocation_load_report& _report;
+        const uint64_t _max_score;
+    };
+
+    return soft_constraint_evaluator(std::make_unique<impl>(report, weight));
+}
+
 soft_constraint_evaluator least_disk_filled(
   const double max_disk_usage_ratio,
   const absl::flat_hash_map<model::node_id, node_disk_space>&
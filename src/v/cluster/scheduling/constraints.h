@@ -20,6 +20,43 @@ namespace cluster {
 
 class allocation_state;
 
+/*
+ * Resource usage of the nodes taken from the health reports. Used by the load
+ * aware constraints to keep new replicas away from the nodes that are short
+ * of disk space or serve more traffic than the others.
+ *
+ * The replicas allocated after the report was taken are accounted with the
+ * size and throughput estimates of a new replica, so that a request creating
+ * many partitions doesn't pile them up on the least loaded nodes.
+ */
+struct allocation_load_report {
+    struct node_load {
+        uint64_t disk_total{0};
+        uint64_t disk_used{0};
+        // bytes per second served by the partitions led by the node
+        double throughput{0};
+        // partitions allocated on the node when the report was taken
+        uint32_t allocated_partitions{0};
+    };
+
+    absl::flat_hash_map<model::node_id, node_load> nodes;
+    // estimated size and throughput of a replica of a new partition
+    uint64_t partition_size{0};
+    double partition_throughput{0};
+    // averages over the reporting nodes
+    double disk_usage_ratio{0};
+    double throughput_per_core{0};
+
+    /*
+     * records the number of partitions allocated on the nodes and computes
+     * the averages. Must be called on the allocator shard right before the
+     * allocation.
+     */
+    void snapshot_allocations(const allocation_state&);
+
+    uint32_t allocated_since(const allocation_node&, const node_load&) const;
+};
+
 hard_constraint_evaluator not_fully_allocated();
 hard_constraint_evaluator is_active();
 
@@ -70,4 +107,27 @@ soft_constraint_evaluator least_disk_filled(
 soft_constraint_evaluator
 distinct_rack(const std::vector<model::broker_shard>&, const allocation_state&);
 
+/*
+ * Load aware constraints are weighted, `weight` in [0, 1] scales their score
+ * relative to the other soft constraints.
+ *
+ * scores nodes on their disk usage including the estimated size of the
+ * replicas allocated since the report was taken. Nodes that are at most
+ * `disk_usage_slack` above the average usage of the cluster score `weight *
+ * max_score`, above that the score decreases linearly to `0` at
+ * max_disk_usage_ratio. Nodes missing from the report are not penalized.
+ */
+soft_constraint_evaluator least_disk_used(
+  const allocation_load_report&, double max_disk_usage_ratio, double weight);
+
+/*
+ * scores nodes on the traffic they serve per core including the estimated
+ * throughput of the replicas allocated since the report was taken. Nodes that
+ * are at most `throughput_slack` above the average of the cluster score
+ * `weight * max_score`, above that the score is inversely proportional to
+ * the throughput per core. Nodes missing from the report are not penalized.
+ */
+soft_constraint_evaluator
+least_throughput(const allocation_load_report&, double weight);
+
 } // namespace cluster
@@ -10,10 +10,12 @@
  */
 #include "cluster/scheduling/leader_balancer.h"
 
+#include "cluster/health_monitor_frontend.h"
 #include "cluster/logger.h"
 #include "cluster/members_table.h"
 #include "cluster/partition_leaders_table.h"
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/types.h"
 #include "cluster/shard_table.h"
 #include "cluster/topic_table.h"
 #include "model/namespace.h"
@@ -43,24 +45,30 @@ leader_balancer::leader_balancer(
   raft::consensus_client_protocol client,
   ss::sharded<shard_table>& shard_table,
   ss::sharded<partition_manager>& partition_manager,
+  ss::sharded<health_monitor_frontend>& health_monitor,
   ss::sharded<ss::abort_source>& as,
   config::binding<bool>&& enabled,
   config::binding<std::chrono::milliseconds>&& idle_timeout,
   config::binding<std::chrono::milliseconds>&& mute_timeout,
   config::binding<std::chrono::milliseconds>&& node_mute_timeout,
   config::binding<size_t>&& transfer_limit_per_shard,
+  config::binding<model::leader_balancer_mode>&& mode,
+  config::binding<size_t>&& transfers_per_tick,
   consensus_ptr raft0)
   : _enabled(std::move(enabled))
   , _idle_timeout(std::move(idle_timeout))
   , _mute_timeout(std::move(mute_timeout))
   , _node_mute_timeout(std::move(node_mute_timeout))
   , _transfer_limit_per_shard(std::move(transfer_limit_per_shard))
+  , _mode(std::move(mode))
+  , _transfers_per_tick(std::move(transfers_per_tick))
   , _topics(topics)
   , _leaders(leaders)
   , _members(members)
   , _client(std::move(client))
   , _shard_table(shard_table)
   , _partition_manager(partition_manager)
+  , _health_monitor(health_monitor)
   , _as(as)
   , _raft0(std::move(raft0))
   , _timer([this] { trigger_balance(); }) {
@@ -247,6 +255,10 @@ void leader_balancer::trigger_balance() {
         _throttled = false;
     }
 
+    // a new tick of the throughput aware balancer
+    _group_loads.reset();
+    _tick_transfers = 0;
+
     ssx::spawn_with_gate(_gate, [this] {
         return ss::repeat([this] {
                    if (_as.local().abort_requested()) {
@@ -354,6 +366,24 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         co_return ss::stop_iteration::yes;
     }
 
+    if (
+      _mode() == model::leader_balancer_mode::throughput_balanced_shards) {
+        if (_tick_transfers >= _transfers_per_tick()) {
+            vlog(
+              clusterlog.debug,
+              "Leadership balancer tick: started {} transfers, waiting for "
+              "the loads to be measured again",
+              _tick_transfers);
+            if (!_timer.armed()) {
+                _timer.arm(load_remeasure_delay);
+            }
+            co_return ss::stop_iteration::yes;
+        }
+        if (!_group_loads) {
+            _group_loads = co_await collect_group_loads();
+        }
+    }
+
     /*
      * For simplicity the current implementation rebuilds the index on each
      * rebalancing tick. Testing shows that this takes up to a couple
@@ -362,8 +392,8 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
      * (e.g. on average little should change between ticks) and bounding the
      * search for leader moves.
      */
-    greedy_balanced_shards strategy(build_index(), muted_nodes());
-    auto cores = strategy.stats();
+    auto strategy = make_strategy();
+    auto cores = strategy->stats();
 
     if (clusterlog.is_enabled(ss::log_level::trace)) {
         for (const auto& core : cores) {
@@ -420,8 +450,8 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         co_return ss::stop_iteration::yes;
     }
 
-    auto error = strategy.error();
-    auto transfer = strategy.find_movement(muted_groups());
+    auto error = strategy->error();
+    auto transfer = strategy->find_movement(muted_groups());
     if (!transfer) {
         vlog(
           clusterlog.debug,
@@ -439,6 +469,7 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
     _in_flight_changes[transfer->group] = {
       *transfer, clock_type::now() + _mute_timeout()};
     check_register_leadership_change_notification();
+    ++_tick_transfers;
 
     auto success = co_await do_transfer(*transfer);
     if (!success) {
@@ -477,6 +508,65 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
     co_return ss::stop_iteration::no;
 }
 
+std::unique_ptr<leader_balancer_strategy> leader_balancer::make_strategy() {
+    if (
+      _mode() == model::leader_balancer_mode::throughput_balanced_shards
+      && _group_loads) {
+        return std::make_unique<throughput_balanced_shards>(
+          build_index(), muted_nodes(), *_group_loads, idle_group_load);
+    }
+    return std::make_unique<greedy_balanced_shards>(
+      build_index(), muted_nodes());
+}
+
+/*
+ * loads of the groups as reported by their leaders in the node health
+ * reports. groups without a report are assumed to be idle.
+ */
+ss::future<leader_balancer::group_loads>
+leader_balancer::collect_group_loads() {
+    group_loads loads;
+    auto report = co_await _health_monitor.local().get_cluster_health(
+      cluster_report_filter{},
+      force_refresh::no,
+      model::timeout_clock::now() + health_report_timeout);
+    if (!report) {
+        vlog(
+          clusterlog.info,
+          "Leadership balancer tick: unable to get the cluster health report "
+          "({}), treating all groups as idle",
+          report.error().message());
+        co_return loads;
+    }
+
+    const auto& topics = _topics.topics_map();
+    for (const auto& node : report.value().node_reports) {
+        for (const auto& topic : node.topics) {
+            auto t_it = topics.find(topic.tp_ns);
+            if (t_it == topics.end()) {
+                continue;
+            }
+            const auto& assignments = t_it->second.get_assignments();
+            for (const auto& p : topic.partitions) {
+                if (p.leader_id != node.id) {
+                    continue;
+                }
+                auto load = static_cast<double>(p.bytes_rate)
+                            + static_cast<double>(p.requests_rate)
+                                * request_cost_bytes;
+                if (load == 0) {
+                    continue;
+                }
+                if (auto a_it = assignments.find(p.id);
+                    a_it != assignments.end()) {
+                    loads[a_it->group] = load;
+                }
+            }
+        }
+    }
+    co_return loads;
+}
+
 absl::flat_hash_set<model::node_id> leader_balancer::muted_nodes() const {
     absl::flat_hash_set<model::node_id> nodes;
     const auto now = raft::clock_type::now();
@@ -13,6 +13,7 @@
 #include "cluster/partition_manager.h"
 #include "cluster/scheduling/leader_balancer_probe.h"
 #include "cluster/scheduling/leader_balancer_strategy.h"
+#include "cluster/scheduling/leader_balancer_throughput.h"
 #include "cluster/types.h"
 #include "raft/consensus.h"
 #include "raft/consensus_client_protocol.h"
@@ -69,6 +70,16 @@ class leader_balancer {
      */
     static constexpr clock_type::duration throttle_reactivation_delay = 5s;
 
+    /*
+     * the loads are taken from the health reports which are refreshed
+     * periodically. after starting leader_balancer_transfers_per_tick
+     * transfers the throughput aware balancer waits for this long so that
+     * the reports reflect the moves before balancing further.
+     */
+    static constexpr clock_type::duration load_remeasure_delay = 30s;
+
+    static constexpr clock_type::duration health_report_timeout = 5s;
+
 public:
     leader_balancer(
       topic_table&,
@@ -77,12 +88,15 @@ public:
       raft::consensus_client_protocol,
       ss::sharded<shard_table>&,
       ss::sharded<partition_manager>&,
+      ss::sharded<health_monitor_frontend>&,
       ss::sharded<ss::abort_source>&,
       config::binding<bool>&&,
       config::binding<std::chrono::milliseconds>&&,
       config::binding<std::chrono::milliseconds>&&,
       config::binding<std::chrono::milliseconds>&&,
       config::binding<size_t>&&,
+      config::binding<model::leader_balancer_mode>&&,
+      config::binding<size_t>&&,
       consensus_ptr);
 
     ss::future<> start();
@@ -91,8 +105,11 @@ public:
 private:
     using index_type = leader_balancer_strategy::index_type;
     using reassignment = leader_balancer_strategy::reassignment;
+    using group_loads = throughput_balanced_shards::group_loads;
 
     index_type build_index();
+    std::unique_ptr<leader_balancer_strategy> make_strategy();
+    ss::future<group_loads> collect_group_loads();
     absl::flat_hash_set<raft::group_id> muted_groups() const;
     absl::flat_hash_set<model::node_id> muted_nodes() const;
 
@@ -162,6 +179,14 @@ private:
      */
     config::binding<size_t> _transfer_limit_per_shard;
 
+    config::binding<model::leader_balancer_mode> _mode;
+
+    /*
+     * limits the leadership transfers started by the throughput aware
+     * balancer before the loads are measured again.
+     */
+    config::binding<size_t> _transfers_per_tick;
+
     struct last_known_leader {
         model::broker_shard shard;
         clock_type::time_point expires;
@@ -171,6 +196,10 @@ private:
     leader_balancer_probe _probe;
     bool _need_controller_refresh{true};
     bool _throttled{false};
+    // loads of the groups used by the current tick of the throughput aware
+    // balancer and the number of transfers it started
+    std::optional<group_loads> _group_loads;
+    size_t _tick_transfers{0};
     absl::btree_map<raft::group_id, clock_type::time_point> _muted;
     cluster::notification_id_type _leader_notify_handle;
     std::optional<cluster::notification_id_type>
@@ -182,6 +211,7 @@ private:
     raft::consensus_client_protocol _client;
     ss::sharded<shard_table>& _shard_table;
     ss::sharded<partition_manager>& _partition_manager;
+    ss::sharded<health_monitor_frontend>& _health_monitor;
     ss::sharded<ss::abort_source>& _as;
     consensus_ptr _raft0;
     ss::gate _gate;
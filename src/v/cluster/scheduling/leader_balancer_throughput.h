@@ -0,0 +1,181 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/scheduling/leader_balancer_strategy.h"
+#include "model/metadata.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Throughput balanced shards strategy weighs every group by the load of its
+ * leader (the produce and fetch traffic it serves) and moves leaders from the
+ * most loaded cores so that the load of the cores is as even as possible. Like
+ * the greedy strategy it treats all cores equally, ignoring node-level
+ * balancing.
+ *
+ * Every group weighs at least `idle_group_load`, so without any traffic the
+ * strategy balances the number of leaders per core.
+ */
+namespace cluster {
+
+class throughput_balanced_shards final : public leader_balancer_strategy {
+public:
+    /*
+     * a move has to improve the load difference of the two cores by more
+     * than this fraction of the moved group's load. measured loads are noisy,
+     * without the margin two cores with almost the same load could keep
+     * exchanging a group.
+     */
+    static constexpr double improvement_margin = 0.1;
+
+    using group_loads = absl::flat_hash_map<raft::group_id, double>;
+
+    throughput_balanced_shards(
+      index_type cores,
+      absl::flat_hash_set<model::node_id> muted_nodes,
+      const group_loads& loads,
+      double idle_group_load)
+      : _cores(std::move(cores))
+      , _muted_nodes(std::move(muted_nodes)) {
+        double total = 0;
+        size_t num_cores = 0;
+        for (const auto& [shard, groups] : _cores) {
+            double core_load = 0;
+            for (const auto& group : groups) {
+                auto it = loads.find(group.first);
+                auto load = idle_group_load
+                            + (it == loads.end() ? 0 : it->second);
+                _group_load.emplace(group.first, load);
+                core_load += load;
+            }
+            _shard_load.emplace(shard, core_load);
+            // groups led by muted nodes won't be moved, they don't count
+            // towards the target load
+            if (!_muted_nodes.contains(shard.node_id)) {
+                total += core_load;
+                ++num_cores;
+            }
+        }
+        _target_load = num_cores == 0 ? 0 : total / num_cores;
+
+        _load.reserve(_shard_load.size());
+        for (const auto& [shard, load] : _shard_load) {
+            _load.emplace_back(load, shard);
+        }
+        std::sort(
+          _load.begin(), _load.end(), [](const auto& a, const auto& b) {
+              return a.first > b.first;
+          });
+    }
+
+    double calc_target_load() const { return _target_load; }
+
+    /*
+     * error = sum((shard.load - target)^2 for each non-muted shard)
+     */
+    double error() const final {
+        double error = 0;
+        for (const auto& [shard, load] : _shard_load) {
+            if (!_muted_nodes.contains(shard.node_id)) {
+                error += std::pow(load - _target_load, 2);
+            }
+        }
+        return error;
+    }
+
+    /*
+     * Find a group reassignment that improves overall error. Moving a group
+     * of load w from a core with load `from` to a core with load `to` changes
+     * the error by 2w(w - (from - to)), so among the groups of the most loaded
+     * core that can be improved the one with the largest decrease is chosen.
+     * The cost is linear in the number of groups of the considered cores.
+     *
+     * Muted nodes are treated as in the greedy strategy: leadership isn't
+     * moved to them and their leaders aren't touched.
+     */
+    std::optional<reassignment>
+    find_movement(const absl::flat_hash_set<raft::group_id>& skip) const final {
+        for (const auto& [from_load, from] : _load) {
+            if (_muted_nodes.contains(from.node_id)) {
+                continue;
+            }
+            if (from_load <= _target_load) {
+                // the remaining cores are at most at the target, moving a
+                // leader away can't improve the error
+                break;
+            }
+
+            double best_decrease = 0;
+            std::optional<reassignment> best;
+            for (const auto& [group, replicas] : _cores.at(from)) {
+                if (skip.contains(group)) {
+                    continue;
+                }
+                auto w = _group_load.at(group);
+                for (const auto& to : replicas) {
+                    if (to == from || _muted_nodes.contains(to.node_id)) {
+                        continue;
+                    }
+                    auto to_load = load_of(to);
+                    auto diff = from_load - to_load;
+                    if (diff <= w * (1 + improvement_margin)) {
+                        continue;
+                    }
+                    auto decrease = 2 * w * (diff - w);
+                    if (decrease > best_decrease) {
+                        best_decrease = decrease;
+                        best = reassignment{group, from, to};
+                    }
+                }
+            }
+
+            if (best) {
+                return best;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::vector<shard_load> stats() const final {
+        std::vector<shard_load> ret;
+        ret.reserve(_load.size());
+        for (const auto& [load, shard] : _load) {
+            // oddly, absl::btree::size returns a signed type
+            ret.push_back(shard_load{
+              shard, static_cast<size_t>(_cores.at(shard).size())});
+        }
+        return ret;
+    }
+
+    /*
+     * Load of a shard, the sum of the loads of the groups it leads.
+     */
+    double load_of(const model::broker_shard& shard) const {
+        auto it = _shard_load.find(shard);
+        return it == _shard_load.end() ? 0 : it->second;
+    }
+
+private:
+    index_type _cores;
+    absl::flat_hash_set<model::node_id> _muted_nodes;
+    absl::flat_hash_map<raft::group_id, double> _group_load;
+    absl::flat_hash_map<model::broker_shard, double> _shard_load;
+    // cores ordered by load, the most loaded first
+    std::vector<std::pair<double, model::broker_shard>> _load;
+    double _target_load{0};
+};
+
+} // namespace cluster
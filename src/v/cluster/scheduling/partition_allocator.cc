@@ -355,6 +355,41 @@ result<allocation_units> partition_allocator::reallocate_partition(
       domain);
 }
 
+result<allocation_units> partition_allocator::reallocate_replica_shard(
+  const partition_assignment& current_assignment,
+  model::broker_shard replica,
+  ss::shard_id target_shard,
+  const partition_allocation_domain domain) {
+    if (!_state->validate_shard(replica.node_id, target_shard)) {
+        return errc::invalid_node_operation;
+    }
+    auto replicas = current_assignment.replicas;
+    auto it = std::find(replicas.begin(), replicas.end(), replica);
+    if (it == replicas.end()) {
+        return errc::invalid_node_operation;
+    }
+    vlog(
+      clusterlog.debug,
+      "reallocating replica {} of partition {} to shard {}",
+      replica,
+      current_assignment.id,
+      target_shard);
+    it->shard = target_shard;
+    _state->apply_update({*it}, raft::group_id{}, domain);
+
+    partition_assignment assignment{
+      current_assignment.group,
+      current_assignment.id,
+      std::move(replicas),
+    };
+
+    return allocation_units(
+      {std::move(assignment)},
+      current_assignment.replicas,
+      _state.get(),
+      domain);
+}
+
 result<allocation_units> partition_allocator::reassign_decommissioned_replicas(
   const partition_assignment& current_assignment,
   const partition_allocation_domain domain) {
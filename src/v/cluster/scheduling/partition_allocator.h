@@ -68,6 +68,17 @@ public:
       const partition_assignment&,
       partition_allocation_domain);
 
+    /// Moves a replica of the partition to another core of the same node.
+    /// The other replicas are not changed.
+    /// Allocation domain must match the one used to allocate the partition.
+    ///
+    /// Returns an error if the replica or the target core doesn't exist
+    result<allocation_units> reallocate_replica_shard(
+      const partition_assignment&,
+      model::broker_shard replica,
+      ss::shard_id target_shard,
+      partition_allocation_domain);
+
     /// Best effort. Does not throw if we cannot find the replicas.
     /// Allocation domain must match the one used to allocate the partition.
     void deallocate(
@@ -21,6 +21,14 @@ namespace cluster {
 class allocation_node;
 class allocation_state;
 
+/*
+ * The balancers weigh every raft group by the traffic of its leader: bytes
+ * produced and fetched per second plus a fixed cost of every request. Every
+ * group weighs at least idle_group_load, so idle groups are spread evenly.
+ */
+inline constexpr double request_cost_bytes = 4096;
+inline constexpr double idle_group_load = 4096;
+
 /**
  * Constraints evaluators loosely inspired by Fenzo Constrainst Solver.
  *
@@ -454,6 +454,15 @@ ss::future<get_node_health_reply> service::collect_node_health_report(
       });
 }
 
+ss::future<get_node_health_delta_reply>
+service::collect_node_health_report_delta(
+  get_node_health_delta_request&& req, rpc::streaming_context&) {
+    return ss::with_scheduling_group(
+      get_scheduling_group(), [this, req = std::move(req)]() mutable {
+          return do_collect_node_health_report_delta(std::move(req));
+      });
+}
+
 ss::future<get_cluster_health_reply> service::get_cluster_health_report(
   get_cluster_health_request&& req, rpc::streaming_context&) {
     return ss::with_scheduling_group(
@@ -505,6 +514,21 @@ service::do_collect_node_health_report(get_node_health_request req) {
     };
 }
 
+ss::future<get_node_health_delta_reply>
+service::do_collect_node_health_report_delta(
+  get_node_health_delta_request req) {
+    auto res = co_await _hm_frontend.local().collect_node_health_delta(
+      req.base);
+    if (res.has_error()) {
+        co_return get_node_health_delta_reply{
+          .error = map_health_monitor_error_code(res.error())};
+    }
+    co_return get_node_health_delta_reply{
+      .error = errc::success,
+      .report = std::move(res.value()),
+    };
+}
+
 ss::future<get_cluster_health_reply>
 service::do_get_cluster_health_report(get_cluster_health_request req) {
     auto tout = config::shard_local_cfg().health_monitor_max_metadata_age()
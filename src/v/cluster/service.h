@@ -87,6 +87,9 @@ public:
     ss::future<get_node_health_reply> collect_node_health_report(
       get_node_health_request&&, rpc::streaming_context&) final;
 
+    ss::future<get_node_health_delta_reply> collect_node_health_report_delta(
+      get_node_health_delta_request&&, rpc::streaming_context&) final;
+
     ss::future<get_cluster_health_reply> get_cluster_health_report(
       get_cluster_health_request&&, rpc::streaming_context&) final;
 
@@ -129,6 +132,9 @@ private:
     ss::future<get_node_health_reply>
       do_collect_node_health_report(get_node_health_request);
 
+    ss::future<get_node_health_delta_reply>
+      do_collect_node_health_report_delta(get_node_health_delta_request);
+
     ss::future<get_cluster_health_reply>
       do_get_cluster_health_report(get_cluster_health_request);
 
@@ -0,0 +1,155 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/abort_snapshot_cache.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <stdexcept>
+#include <vector>
+
+using cache_t = cluster::abort_snapshot_cache;
+
+namespace {
+
+cache_t::index_ptr make_snapshot(size_t ranges) {
+    std::vector<model::tx_range> aborted;
+    for (size_t i = 0; i < ranges; ++i) {
+        aborted.push_back(model::tx_range{
+          .pid = model::producer_identity(static_cast<int64_t>(i), 0),
+          .first = model::offset(i * 10),
+          .last = model::offset(i * 10 + 5)});
+    }
+    return ss::make_lw_shared<cluster::offset_interval_index<model::tx_range>>(
+      std::move(aborted));
+}
+
+struct counting_loader {
+    size_t ranges;
+    int& loads;
+
+    ss::future<cache_t::index_ptr> operator()() {
+        ++loads;
+        return ss::make_ready_future<cache_t::index_ptr>(make_snapshot(ranges));
+    }
+};
+
+ss::future<cache_t::index_ptr> get_snapshot(
+  cache_t& cache, cache_t::owner_id owner, int64_t idx, counting_loader l) {
+    return cache.get(
+      owner, model::offset(idx * 100), model::offset(idx * 100 + 99), l);
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_snapshot_loaded_once) {
+    cache_t cache;
+    auto owner = cache.register_owner();
+    int loads = 0;
+
+    ss::promise<cache_t::index_ptr> loaded;
+    auto f1 = cache.get(
+      owner, model::offset(0), model::offset(99), [&loaded, &loads] {
+          ++loads;
+          return loaded.get_future();
+      });
+    // concurrent fetches wait for the same load
+    auto f2 = get_snapshot(cache, owner, 0, counting_loader{1, loads});
+    loaded.set_value(make_snapshot(3));
+    auto s1 = f1.get0();
+    auto s2 = f2.get0();
+    BOOST_REQUIRE_EQUAL(loads, 1);
+    BOOST_REQUIRE(s1 == s2);
+    BOOST_REQUIRE_EQUAL(s1->size(), 3);
+
+    auto s3 = get_snapshot(cache, owner, 0, counting_loader{1, loads}).get0();
+    BOOST_REQUIRE_EQUAL(loads, 1);
+    BOOST_REQUIRE(s3 == s1);
+    BOOST_REQUIRE_GT(cache.size_bytes(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_failed_load_not_cached) {
+    cache_t cache;
+    auto owner = cache.register_owner();
+    int loads = 0;
+
+    auto failed = cache.get(owner, model::offset(0), model::offset(99), [] {
+        return ss::make_exception_future<cache_t::index_ptr>(
+          std::runtime_error("io error"));
+    });
+    BOOST_REQUIRE_THROW(failed.get(), std::runtime_error);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 0);
+
+    auto s = get_snapshot(cache, owner, 0, counting_loader{2, loads}).get0();
+    BOOST_REQUIRE_EQUAL(loads, 1);
+    BOOST_REQUIRE_EQUAL(s->size(), 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_budget_shared_by_owners) {
+    int loads = 0;
+    // measure the memory used by a single snapshot
+    size_t entry_bytes = 0;
+    {
+        cache_t probe;
+        auto owner = probe.register_owner();
+        get_snapshot(probe, owner, 0, counting_loader{64, loads}).get();
+        entry_bytes = probe.size_bytes();
+    }
+
+    // the budget fits three snapshots of any of the partitions
+    cache_t cache(3 * entry_bytes);
+    auto a = cache.register_owner();
+    auto b = cache.register_owner();
+    get_snapshot(cache, a, 0, counting_loader{64, loads}).get();
+    get_snapshot(cache, b, 0, counting_loader{64, loads}).get();
+    get_snapshot(cache, a, 1, counting_loader{64, loads}).get();
+    BOOST_REQUIRE_EQUAL(cache.size(), 3);
+
+    // use the oldest one so that the snapshot of the other partition becomes
+    // the least recently used
+    loads = 0;
+    get_snapshot(cache, a, 0, counting_loader{64, loads}).get();
+    BOOST_REQUIRE_EQUAL(loads, 0);
+
+    get_snapshot(cache, b, 1, counting_loader{64, loads}).get();
+    BOOST_REQUIRE_EQUAL(loads, 1);
+    BOOST_REQUIRE_EQUAL(cache.size(), 3);
+    BOOST_REQUIRE_LE(cache.size_bytes(), 3 * entry_bytes);
+
+    get_snapshot(cache, a, 0, counting_loader{64, loads}).get();
+    get_snapshot(cache, a, 1, counting_loader{64, loads}).get();
+    BOOST_REQUIRE_EQUAL(loads, 1);
+    get_snapshot(cache, b, 0, counting_loader{64, loads}).get();
+    BOOST_REQUIRE_EQUAL(loads, 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_evict_owner) {
+    cache_t cache;
+    auto a = cache.register_owner();
+    auto b = cache.register_owner();
+    int loads = 0;
+    get_snapshot(cache, a, 0, counting_loader{1, loads}).get();
+    get_snapshot(cache, a, 1, counting_loader{1, loads}).get();
+    get_snapshot(cache, b, 0, counting_loader{1, loads}).get();
+
+    cache.evict(a);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    loads = 0;
+    get_snapshot(cache, b, 0, counting_loader{1, loads}).get();
+    BOOST_REQUIRE_EQUAL(loads, 0);
+
+    cache.evict(b, model::offset(0), model::offset(99));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 0);
+}
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "cluster/scheduling/constraints.h"
 #include "cluster/tests/partition_allocator_fixture.h"
 #include "cluster/types.h"
 #include "raft/types.h"
@@ -17,6 +18,68 @@
 
 #include <vector>
 
+namespace {
+
+constexpr int large_cluster_nodes = 30;
+constexpr int large_cluster_cores = 16;
+constexpr int large_cluster_partitions = 100'000;
+
+/*
+ * 30 nodes with 100k partitions with 3 replicas, the first nodes short of
+ * disk space and serving most of the traffic.
+ */
+cluster::allocation_load_report
+populate_large_cluster(partition_allocator_fixture& f) {
+    if (f.allocator.state().allocation_nodes().empty()) {
+        for (int n = 0; n < large_cluster_nodes; ++n) {
+            f.register_node(n, large_cluster_cores);
+        }
+        std::vector<model::broker_shard> replicas;
+        for (int p = 0; p < large_cluster_partitions; ++p) {
+            replicas.clear();
+            for (int r = 0; r < 3; ++r) {
+                auto replica = p * 3 + r;
+                replicas.push_back(model::broker_shard{
+                  .node_id = model::node_id(
+                    (p + r * 7) % large_cluster_nodes),
+                  .shard = uint32_t(replica / large_cluster_nodes)
+                           % large_cluster_cores});
+            }
+            f.allocator.update_allocation_state(
+              replicas,
+              raft::group_id(p),
+              cluster::partition_allocation_domains::common);
+        }
+    }
+
+    cluster::allocation_load_report report;
+    for (int n = 0; n < large_cluster_nodes; ++n) {
+        auto& load = report.nodes[model::node_id(n)];
+        load.disk_total = 1_TiB;
+        load.disk_used = n < 5 ? 900_GiB : 300_GiB;
+        load.throughput = n < 5 ? 400_MiB : 50_MiB;
+    }
+    report.partition_size = 100_MiB;
+    report.partition_throughput = 100_KiB;
+    report.snapshot_allocations(f.allocator.state());
+    return report;
+}
+
+void add_load_constraints(
+  cluster::allocation_request& req,
+  const cluster::allocation_load_report& report) {
+    auto disk = ss::make_lw_shared<cluster::soft_constraint_evaluator>(
+      cluster::least_disk_used(report, 0.95, 1.0));
+    auto throughput = ss::make_lw_shared<cluster::soft_constraint_evaluator>(
+      cluster::least_throughput(report, 0.5));
+    for (auto& p : req.partitions) {
+        p.constraints.soft_constraints.push_back(disk);
+        p.constraints.soft_constraints.push_back(throughput);
+    }
+}
+
+} // namespace
+
 PERF_TEST_F(partition_allocator_fixture, allocation_3) {
     register_node(0, 24);
     register_node(1, 24);
@@ -69,3 +132,23 @@ PERF_TEST_F(partition_allocator_fixture, recovery) {
       cluster::partition_allocation_domains::common);
     perf_tests::stop_measuring_time();
 }
+
+PERF_TEST_F(partition_allocator_fixture, allocation_large_cluster) {
+    populate_large_cluster(*this);
+    auto req = make_allocation_request(1000, 3);
+
+    perf_tests::start_measuring_time();
+    auto vals = allocator.allocate(std::move(req));
+    perf_tests::do_not_optimize(vals);
+    perf_tests::stop_measuring_time();
+}
+PERF_TEST_F(partition_allocator_fixture, load_aware_allocation_large_cluster) {
+    auto report = populate_large_cluster(*this);
+    auto req = make_allocation_request(1000, 3);
+
+    perf_tests::start_measuring_time();
+    add_load_constraints(req, report);
+    auto vals = allocator.allocate(std::move(req));
+    perf_tests::do_not_optimize(vals);
+    perf_tests::stop_measuring_time();
+}
@@ -9,8 +9,11 @@
 
 #include "cluster/controller_api.h"
 #include "cluster/errc.h"
+#include "cluster/partition_manager.h"
+#include "cluster/shard_table.h"
 #include "cluster/tests/cluster_test_fixture.h"
 #include "cluster/types.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/timeout_clock.h"
@@ -19,6 +22,9 @@
 
 #include <seastar/core/loop.hh>
 
+#include <algorithm>
+#include <functional>
+
 using namespace std::chrono_literals; // NOLINT
 
 FIXTURE_TEST(test_querying_ntp_status, cluster_test_fixture) {
@@ -68,3 +74,96 @@ FIXTURE_TEST(test_querying_ntp_status, cluster_test_fixture) {
           });
     }).get();
 }
+
+FIXTURE_TEST(
+  test_reconciliation_done_after_shard_table_update, cluster_test_fixture) {
+    auto n1 = create_node_application(model::node_id{0});
+    wait_for_controller_leadership(model::node_id{0}).get();
+
+    // shard table updates of many partitions created at once are coalesced,
+    // an ntp may only be reported as reconciled once its shard table entry is
+    // visible on every core
+    const int partitions = 64;
+    model::topic_namespace tp_ns(test_ns, model::topic("tp"));
+    std::vector<cluster::topic_configuration> topics;
+    topics.emplace_back(tp_ns.ns, tp_ns.tp, partitions, 1);
+    n1->controller->get_topics_frontend()
+      .local()
+      .create_topics(
+        cluster::without_custom_assignments(topics),
+        1s + model::timeout_clock::now())
+      .get();
+
+    std::vector<model::ntp> ntps;
+    for (int i = 0; i < partitions; ++i) {
+        ntps.emplace_back(tp_ns.ns, tp_ns.tp, model::partition_id(i));
+    }
+
+    tests::cooperative_spin_wait_with_timeout(10s, [n1, &ntps] {
+        return n1->controller->get_api()
+          .local()
+          .all_reconciliations_done(ntps)
+          .then([](result<bool> r) { return r.has_value() && r.value(); });
+    }).get();
+
+    auto missing = n1->shard_table
+                     .map_reduce0(
+                       [&ntps](cluster::shard_table& st) {
+                           return static_cast<size_t>(std::count_if(
+                             ntps.begin(),
+                             ntps.end(),
+                             [&st](const model::ntp& ntp) {
+                                 return !st.shard_for(ntp).has_value();
+                             }));
+                       },
+                       size_t(0),
+                       std::plus<>())
+                     .get();
+    BOOST_REQUIRE_EQUAL(missing, 0);
+}
+
+FIXTURE_TEST(test_background_bootstrap_after_restart, cluster_test_fixture) {
+    const model::node_id id{0};
+    auto n1 = create_node_application(id);
+    wait_for_controller_leadership(id).get();
+
+    const int partitions = 16;
+    model::topic_namespace tp_ns(test_ns, model::topic("tp"));
+    std::vector<cluster::topic_configuration> topics;
+    topics.emplace_back(tp_ns.ns, tp_ns.tp, partitions, 1);
+    n1->controller->get_topics_frontend()
+      .local()
+      .create_topics(
+        cluster::without_custom_assignments(topics),
+        1s + model::timeout_clock::now())
+      .get();
+    n1->controller->get_api()
+      .local()
+      .wait_for_topic(tp_ns, 10s + model::timeout_clock::now())
+      .get();
+
+    ss::smp::invoke_on_all([] {
+        config::shard_local_cfg()
+          .controller_backend_background_bootstrap.set_value(true);
+    }).get();
+    remove_node_application(id);
+
+    // partitions of the topic are bootstrapped in the background, the node
+    // only finishes its startup once they are all back
+    n1 = create_node_application(id);
+    n1->controller->get_api().local().wait_for_bootstrap().get();
+
+    for (int i = 0; i < partitions; ++i) {
+        model::ntp ntp(tp_ns.ns, tp_ns.tp, model::partition_id(i));
+        auto shard = n1->shard_table.local().shard_for(ntp);
+        BOOST_REQUIRE(shard.has_value());
+        auto exists = n1->partition_manager
+                        .invoke_on(
+                          *shard,
+                          [ntp](cluster::partition_manager& pm) {
+                              return pm.get(ntp) != nullptr;
+                          })
+                        .get();
+        BOOST_REQUIRE(exists);
+    }
+}
@@ -22,6 +22,7 @@
 #include "model/timeout_clock.h"
 #include "net/unresolved_address.h"
 #include "outcome.h"
+#include "serde/serde.h"
 #include "test_utils/async.h"
 #include "test_utils/fixture.h"
 
@@ -354,3 +355,81 @@ FIXTURE_TEST(test_alive_status, cluster_test_fixture) {
           });
     }).get();
 }
+
+namespace {
+cluster::partition_status make_partition_status(
+  int32_t id, int64_t term, std::optional<model::node_id> leader) {
+    return cluster::partition_status{
+      .id = model::partition_id(id),
+      .term = model::term_id(term),
+      .leader_id = leader,
+      .revision_id = model::revision_id(10),
+      .size_bytes = 1024 * static_cast<size_t>(id),
+    };
+}
+
+model::topic_namespace make_tp_ns(std::string_view topic) {
+    return {model::kafka_namespace, model::topic(ss::sstring(topic))};
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_apply_node_health_delta) {
+    cluster::node_health_report full_report{.id = model::node_id(1)};
+    full_report.topics.push_back(cluster::topic_status{
+      .tp_ns = make_tp_ns("a"),
+      .partitions = {
+        make_partition_status(2, 1, model::node_id(1)),
+        make_partition_status(0, 1, model::node_id(1)),
+        make_partition_status(1, 1, std::nullopt)}});
+    full_report.topics.push_back(cluster::topic_status{
+      .tp_ns = make_tp_ns("b"),
+      .partitions = {make_partition_status(0, 3, model::node_id(2))}});
+
+    // full delta survives serialization, including partitions without leader
+    auto full = cluster::node_health_report_delta::full(full_report);
+    BOOST_REQUIRE(full.is_full());
+    auto decoded = serde::from_iobuf<cluster::node_health_report_delta>(
+      serde::to_iobuf(cluster::node_health_report_delta::full(full_report)));
+    BOOST_REQUIRE(decoded == full);
+
+    cluster::node_health_report report;
+    cluster::apply_node_health_delta(report, std::move(decoded));
+    BOOST_REQUIRE_EQUAL(report.topics.size(), 2);
+    BOOST_REQUIRE(
+      report.topics[0].partitions
+      == std::vector<cluster::partition_status>(
+        {make_partition_status(0, 1, model::node_id(1)),
+         make_partition_status(1, 1, std::nullopt),
+         make_partition_status(2, 1, model::node_id(1))}));
+    BOOST_REQUIRE(report.topics[1] == full_report.topics[1]);
+
+    cluster::node_health_report_delta delta{
+      .id = model::node_id(1),
+      .base = {.session = 1, .seq = 1},
+      .position = {.session = 1, .seq = 2},
+    };
+    cluster::topic_status_delta a{.tp_ns = make_tp_ns("a")};
+    a.updated.push_back(make_partition_status(1, 2, model::node_id(3)));
+    a.updated.push_back(make_partition_status(4, 1, model::node_id(1)));
+    a.removed.push_back(model::partition_id(0));
+    cluster::topic_status_delta c{.tp_ns = make_tp_ns("c")};
+    c.updated.push_back(make_partition_status(0, 1, std::nullopt));
+    delta.topics.push_back(std::move(a));
+    delta.topics.push_back(std::move(c));
+    delta.removed_topics.push_back(make_tp_ns("b"));
+
+    cluster::apply_node_health_delta(report, std::move(delta));
+    BOOST_REQUIRE_EQUAL(report.topics.size(), 2);
+    BOOST_REQUIRE(report.topics[0].tp_ns == make_tp_ns("a"));
+    BOOST_REQUIRE(
+      report.topics[0].partitions
+      == std::vector<cluster::partition_status>(
+        {make_partition_status(1, 2, model::node_id(3)),
+         make_partition_status(2, 1, model::node_id(1)),
+         make_partition_status(4, 1, model::node_id(1))}));
+    BOOST_REQUIRE(report.topics[1].tp_ns == make_tp_ns("c"));
+    BOOST_REQUIRE(
+      report.topics[1].partitions
+      == std::vector<cluster::partition_status>(
+        {make_partition_status(0, 1, std::nullopt)}));
+}
@@ -9,6 +9,7 @@
  * by the Apache License, Version 2.0
  */
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/leader_balancer_throughput.h"
 #include "leader_balancer_test_utils.h"
 
 #include <seastar/testing/perf_tests.hh>
@@ -45,8 +46,56 @@ void balancer_bench(bool measure_all) {
     perf_tests::stop_measuring_time();
 }
 
+void throughput_balancer_bench(bool measure_all) {
+    constexpr int node_count = 72;
+    constexpr int shards_per_node = 16;
+    constexpr int groups_per_shard = 80;
+    constexpr int replicas = 3;
+    constexpr int hot_groups = 4;
+    constexpr double hot_group_load = 200e6; // 200 MB/s
+    constexpr double idle_group_load = 4096;
+
+    cluster::leader_balancer_strategy::index_type index
+      = leader_balancer_test_utils::make_cluster_index(
+        node_count, shards_per_node, groups_per_shard, replicas);
+
+    // a shard leads a few more groups than the others, and these serve most
+    // of the traffic of the cluster
+    cluster::throughput_balanced_shards::group_loads loads;
+    auto& hot_shard = index.begin()->second;
+    auto hot_replicas = hot_shard.begin()->second;
+    for (int g = 0; g < hot_groups; g++) {
+        raft::group_id group(groups_per_shard + g);
+        hot_shard[group] = hot_replicas;
+        loads[group] = hot_group_load;
+    }
+
+    if (measure_all) {
+        perf_tests::start_measuring_time();
+    }
+
+    auto balancer = cluster::throughput_balanced_shards(
+      std::move(index), {}, loads, idle_group_load);
+
+    if (!measure_all) {
+        perf_tests::start_measuring_time();
+    }
+    auto movement = balancer.find_movement({});
+    vassert(movement, "expected a movement from the hot shard");
+    perf_tests::do_not_optimize(movement);
+    perf_tests::stop_measuring_time();
+}
+
 } // namespace
 
 PERF_TEST(leader_balancing, bench_movement) { balancer_bench(false); }
 
 PERF_TEST(leader_balancing, bench_all) { balancer_bench(true); }
+
+PERF_TEST(leader_balancing, bench_throughput_movement) {
+    throughput_balancer_bench(false);
+}
+
+PERF_TEST(leader_balancing, bench_throughput_all) {
+    throughput_balancer_bench(true);
+}
@@ -12,6 +12,7 @@
 
 #include "absl/container/flat_hash_map.h"
 #include "cluster/scheduling/leader_balancer_greedy.h"
+#include "cluster/scheduling/leader_balancer_throughput.h"
 #include "leader_balancer_test_utils.h"
 #include "model/metadata.h"
 
@@ -25,6 +26,7 @@
 
 using index_type = cluster::leader_balancer_strategy::index_type;
 using gbs = cluster::greedy_balanced_shards;
+using tbs = cluster::throughput_balanced_shards;
 using reassignment = cluster::leader_balancer_strategy::reassignment;
 
 /**
@@ -361,3 +363,99 @@ BOOST_AUTO_TEST_CASE(greedy_skip) {
       raft::group_id(5), raft::group_id(6)};
     BOOST_REQUIRE(no_movement(spec, {0}, skip));
 }
+
+/**
+ * @brief Create a throughput balancer from a cluster_spec, the loads of the
+ * groups and a set of muted nodes. Every group weighs at least 1.
+ */
+static auto throughput_from_spec(
+  const cluster_spec& spec,
+  const absl::flat_hash_map<int, double>& loads,
+  const absl::flat_hash_set<int>& muted = {}) {
+    auto [index, _] = from_spec(spec, muted);
+
+    tbs::group_loads loads_typed;
+    for (auto [group, load] : loads) {
+        loads_typed[raft::group_id(group)] = load;
+    }
+    absl::flat_hash_set<model::node_id> muted_typed;
+    for (auto id : muted) {
+        muted_typed.insert(model::node_id(id));
+    }
+
+    return std::make_tuple(index, tbs{index, muted_typed, loads_typed, 1});
+}
+
+BOOST_AUTO_TEST_CASE(throughput_idle_balances_leaders) {
+    auto [index, balancer] = throughput_from_spec(
+      {
+        // clang-format off
+        {{1, 2}, {}},
+        {{},     {1, 2}}
+        // clang-format on
+      },
+      {});
+
+    auto movement = balancer.find_movement({});
+    BOOST_REQUIRE(movement);
+    check_valid(index, *movement);
+    BOOST_REQUIRE(*movement == re(1, 0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(throughput_moves_hot_leaders) {
+    auto spec = cluster_spec{
+      // clang-format off
+      {{1, 2},       {-1}},
+      {{3, 4, 5, 6}, {-1}},
+      // clang-format on
+    };
+
+    // by the number of leaders node 0 is the least loaded one
+    BOOST_REQUIRE_EQUAL(expect_movement(spec, re(3, 1, 0)), "");
+
+    // but it serves all the traffic
+    auto [index, balancer] = throughput_from_spec(spec, {{1, 100}, {2, 100}});
+    BOOST_REQUIRE_GT(balancer.error(), 0);
+    auto movement = balancer.find_movement({});
+    BOOST_REQUIRE(movement);
+    check_valid(index, *movement);
+    BOOST_REQUIRE(*movement == re(1, 0, 1));
+
+    // the hot groups may be skipped
+    BOOST_REQUIRE(
+      !balancer.find_movement({raft::group_id(1), raft::group_id(2)}));
+}
+
+BOOST_AUTO_TEST_CASE(throughput_no_thrashing) {
+    // moving either group would only swap the loads of the nodes
+    auto [_, balancer] = throughput_from_spec(
+      {
+        // clang-format off
+        {{1}, {2}},
+        {{2}, {1}},
+        // clang-format on
+      },
+      {{1, 100}, {2, 90}});
+    BOOST_REQUIRE(!balancer.find_movement({}));
+}
+
+BOOST_AUTO_TEST_CASE(throughput_muted) {
+    auto spec = cluster_spec{
+      // clang-format off
+      {{1, 2}, {-1}},
+      {{},     {-1}},
+      {{},     {-1}},
+      // clang-format on
+    };
+    absl::flat_hash_map<int, double> loads{{1, 100}, {2, 100}};
+
+    // the hot leaders of a muted node are not moved
+    auto [i0, muted_from] = throughput_from_spec(spec, loads, {0});
+    BOOST_REQUIRE(!muted_from.find_movement({}));
+
+    // and nothing is moved to a muted node
+    auto [i1, muted_to] = throughput_from_spec(spec, loads, {1});
+    auto movement = muted_to.find_movement({});
+    BOOST_REQUIRE(movement);
+    BOOST_REQUIRE_EQUAL(movement->to.node_id, model::node_id(2));
+}
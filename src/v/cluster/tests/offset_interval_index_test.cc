@@ -0,0 +1,110 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE cluster
+#include "cluster/offset_interval_index.h"
+#include "model/fundamental.h"
+#include "random/generators.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+struct interval {
+    model::offset first;
+    model::offset last;
+
+    friend bool operator==(const interval&, const interval&) = default;
+    friend bool operator<(const interval& a, const interval& b) {
+        return std::tie(a.first, a.last) < std::tie(b.first, b.last);
+    }
+};
+
+interval random_interval() {
+    auto first = random_generators::get_int<int64_t>(0, 10000);
+    auto length = random_generators::get_int<int64_t>(0, 200);
+    return interval{
+      .first = model::offset(first), .last = model::offset(first + length)};
+}
+
+std::vector<interval> intersecting(
+  const cluster::offset_interval_index<interval>& index,
+  model::offset from,
+  model::offset to) {
+    std::vector<interval> result;
+    index.for_each_intersecting(
+      from, to, [&result](const interval& i) { result.push_back(i); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<interval> intersecting(
+  const std::vector<interval>& intervals,
+  model::offset from,
+  model::offset to) {
+    std::vector<interval> result;
+    std::copy_if(
+      intervals.begin(),
+      intervals.end(),
+      std::back_inserter(result),
+      [from, to](const interval& i) {
+          return i.last >= from && i.first <= to;
+      });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+void check_queries(
+  const cluster::offset_interval_index<interval>& index,
+  const std::vector<interval>& expected) {
+    BOOST_REQUIRE_EQUAL(index.size(), expected.size());
+    for (int i = 0; i < 100; ++i) {
+        auto q = random_interval();
+        BOOST_REQUIRE(
+          intersecting(index, q.first, q.last)
+          == intersecting(expected, q.first, q.last));
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_intersecting_intervals) {
+    cluster::offset_interval_index<interval> index;
+    std::vector<interval> expected;
+    check_queries(index, expected);
+
+    for (int i = 0; i < 2000; ++i) {
+        auto r = random_interval();
+        index.add(r);
+        expected.push_back(r);
+        if (i % 97 == 0) {
+            check_queries(index, expected);
+        }
+    }
+    check_queries(index, expected);
+
+    const auto& sorted = index.sorted();
+    BOOST_REQUIRE(std::is_sorted(
+      sorted.begin(), sorted.end(), [](const interval& a, const interval& b) {
+          return a.first < b.first;
+      }));
+
+    auto cutoff = model::offset(5000);
+    auto expired = [cutoff](const interval& i) { return i.last < cutoff; };
+    index.remove_if(expired);
+    std::erase_if(expected, expired);
+    check_queries(index, expected);
+
+    cluster::offset_interval_index<interval> rebuilt(expected);
+    check_queries(rebuilt, expected);
+}
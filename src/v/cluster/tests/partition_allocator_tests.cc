@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "cluster/cluster_utils.h"
+#include "cluster/scheduling/constraints.h"
 #include "cluster/scheduling/types.h"
 #include "cluster/tests/partition_allocator_fixture.h"
 #include "model/metadata.h"
@@ -482,6 +483,50 @@ cluster::hard_constraint_evaluator random_evaluator() {
     }
 }
 
+FIXTURE_TEST(reallocate_replica_shard, partition_allocator_fixture) {
+    register_node(0, 4);
+    register_node(1, 4);
+    register_node(2, 4);
+    const auto domain = cluster::partition_allocation_domains::common;
+    using capacity = cluster::allocation_node::allocation_capacity;
+
+    cluster::partition_assignment assignment;
+    {
+        auto allocs = allocator.allocate(make_allocation_request(1, 3)).value();
+        assignment = allocs.get_assignments().front();
+        allocator.update_allocation_state(
+          assignment.replicas, assignment.group, domain);
+    }
+    auto replica = assignment.replicas.front();
+    const auto& node = allocator.state().allocation_nodes().at(
+      replica.node_id);
+    ss::shard_id target = (replica.shard + 1) % 4;
+
+    // the target core has to exist
+    BOOST_REQUIRE(
+      !allocator.reallocate_replica_shard(assignment, replica, 4, domain)
+         .has_value());
+    {
+        auto units = allocator.reallocate_replica_shard(
+          assignment, replica, target, domain);
+        BOOST_REQUIRE(units.has_value());
+        const auto& replicas
+          = units.value().get_assignments().front().replicas;
+        BOOST_REQUIRE_EQUAL(replicas.size(), 3);
+        BOOST_REQUIRE_EQUAL(
+          replicas.front(),
+          model::broker_shard{.node_id = replica.node_id, .shard = target});
+        BOOST_REQUIRE(std::equal(
+          replicas.begin() + 1,
+          replicas.end(),
+          assignment.replicas.begin() + 1));
+        // until the move is finished the replica is counted on both cores
+        BOOST_REQUIRE_EQUAL(node->allocated_partitions(), capacity{2});
+    }
+    // releasing the units removes the replica from the target core
+    BOOST_REQUIRE_EQUAL(node->allocated_partitions(), capacity{1});
+}
+
 FIXTURE_TEST(allocator_exception_safety_test, partition_allocator_fixture) {
     register_node(0, 2);
     register_node(1, 4);
@@ -707,3 +752,44 @@ FIXTURE_TEST(even_distribution_pri_allocation, partition_allocator_fixture) {
         }
     }
 }
+
+FIXTURE_TEST(load_aware_allocation, partition_allocator_fixture) {
+    for (int i = 0; i < 6; ++i) {
+        register_node(i, 2);
+    }
+    // node 0 is short of disk space, node 1 serves most of the traffic
+    cluster::allocation_load_report report;
+    for (int i = 0; i < 6; ++i) {
+        auto& load = report.nodes[model::node_id(i)];
+        load.disk_total = 100_GiB;
+        load.disk_used = i == 0 ? 90_GiB : 30_GiB;
+        load.throughput = i == 1 ? 100_MiB : 10_MiB;
+    }
+    report.partition_size = 100_MiB;
+    report.partition_throughput = 100_KiB;
+    report.snapshot_allocations(allocator.state());
+
+    auto req = make_allocation_request(40, 3);
+    auto disk = ss::make_lw_shared<cluster::soft_constraint_evaluator>(
+      cluster::least_disk_used(report, 0.9, 1.0));
+    auto throughput = ss::make_lw_shared<cluster::soft_constraint_evaluator>(
+      cluster::least_throughput(report, 1.0));
+    for (auto& p : req.partitions) {
+        p.constraints.soft_constraints.push_back(disk);
+        p.constraints.soft_constraints.push_back(throughput);
+    }
+    auto units = allocator.allocate(std::move(req)).value();
+
+    absl::flat_hash_map<model::node_id, int> replicas;
+    for (const auto& p_as : units.get_assignments()) {
+        for (const auto& bs : p_as.replicas) {
+            replicas[bs.node_id]++;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(replicas[model::node_id(0)], 0);
+    BOOST_REQUIRE_EQUAL(replicas[model::node_id(1)], 0);
+    // the replicas are spread evenly among the remaining nodes
+    for (int i = 2; i < 6; ++i) {
+        BOOST_REQUIRE_EQUAL(replicas[model::node_id(i)], 40 * 3 / 4);
+    }
+}
@@ -78,15 +78,21 @@ public:
 
 struct partition_balancer_planner_fixture {
     partition_balancer_planner_fixture()
-      : planner(
-        cluster::planner_config{
-          .soft_max_disk_usage_ratio = 0.8,
-          .hard_max_disk_usage_ratio = 0.95,
-          .movement_disk_size_batch = reallocation_batch_size,
-          .node_availability_timeout_sec = std::chrono::minutes(1)},
-        workers.table.local(),
-        workers.members.local(),
-        workers.allocator.local()) {}
+      : planner(make_planner()) {}
+
+    cluster::partition_balancer_planner make_planner(
+      std::optional<double> core_load_imbalance_ratio = std::nullopt) {
+        return cluster::partition_balancer_planner(
+          cluster::planner_config{
+            .soft_max_disk_usage_ratio = 0.8,
+            .hard_max_disk_usage_ratio = 0.95,
+            .movement_disk_size_batch = reallocation_batch_size,
+            .node_availability_timeout_sec = std::chrono::minutes(1),
+            .core_load_imbalance_ratio = core_load_imbalance_ratio},
+          workers.table.local(),
+          workers.members.local(),
+          workers.allocator.local());
+    }
 
     cluster::topic_configuration_assignment make_tp_configuration(
       const ss::sstring& topic, int partitions, int16_t replication_factor) {
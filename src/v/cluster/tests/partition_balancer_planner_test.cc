@@ -823,3 +823,80 @@ FIXTURE_TEST(
     BOOST_REQUIRE_EQUAL(plan_data.cancellations.size(), 0);
     BOOST_REQUIRE_EQUAL(plan_data.failed_reassignments_count, 1);
 }
+
+/*
+ * 3 nodes with 4 cores; 1 topic; no traffic
+ * Replicas are spread over the cores by the allocator, planner shouldn't
+ * move them between the cores.
+ */
+FIXTURE_TEST(test_core_balancing_stable, partition_balancer_planner_fixture) {
+    vlog(logger.debug, "test_core_balancing_stable");
+    allocator_register_nodes(3);
+    create_topic("topic-1", 8, 3);
+
+    auto hr = create_health_report();
+    auto fm = create_follower_metrics();
+
+    auto plan_data = make_planner(0.2).plan_reassignments(hr, fm);
+    check_violations(plan_data, {}, {});
+    BOOST_REQUIRE_EQUAL(plan_data.reassignments.size(), 0);
+}
+
+/*
+ * 3 nodes with 4 cores; 1 topic; one partition led by node 0 serves all the
+ * traffic. Planner should move idle replicas away from the core of the hot
+ * leader replica to the other cores of node 0 and keep the hot replica in
+ * place. Followers of the hot partition don't load their cores.
+ */
+FIXTURE_TEST(
+  test_core_balancing_hot_partition, partition_balancer_planner_fixture) {
+    vlog(logger.debug, "test_core_balancing_hot_partition");
+    allocator_register_nodes(3);
+    create_topic("topic-1", 8, 3);
+
+    model::ntp hot_ntp(test_ns, "topic-1", 0);
+    auto hr = create_health_report();
+    for (auto& ps : hr.node_reports[0].topics.front().partitions) {
+        if (ps.id == hot_ntp.tp.partition) {
+            ps.leader_id = model::node_id(0);
+            ps.bytes_rate = 100_MiB;
+        }
+    }
+    auto fm = create_follower_metrics();
+
+    auto plan_data = make_planner(0.2).plan_reassignments(hr, fm);
+    check_violations(plan_data, {}, {});
+    BOOST_REQUIRE_GT(plan_data.reassignments.size(), 0);
+
+    auto& topics = workers.table.local();
+    auto hot_replicas = topics.get_partition_assignment(hot_ntp)->replicas;
+    auto hot_shard = [&hot_replicas](model::node_id id) {
+        auto it = std::find_if(
+          hot_replicas.begin(),
+          hot_replicas.end(),
+          [id](const model::broker_shard& bs) { return bs.node_id == id; });
+        BOOST_REQUIRE(it != hot_replicas.end());
+        return it->shard;
+    };
+
+    for (const auto& reassignment : plan_data.reassignments) {
+        BOOST_REQUIRE_NE(reassignment.ntp, hot_ntp);
+        auto current
+          = topics.get_partition_assignment(reassignment.ntp)->replicas;
+        const auto& planned
+          = reassignment.allocation_units.get_assignments().front().replicas;
+        BOOST_REQUIRE_EQUAL(planned.size(), current.size());
+        size_t moved = 0;
+        for (size_t i = 0; i < current.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(planned[i].node_id, current[i].node_id);
+            if (planned[i].shard != current[i].shard) {
+                // only the core of the leader replica is loaded
+                BOOST_REQUIRE_EQUAL(current[i].node_id, model::node_id(0));
+                BOOST_REQUIRE_EQUAL(
+                  current[i].shard, hot_shard(current[i].node_id));
+                ++moved;
+            }
+        }
+        BOOST_REQUIRE_EQUAL(moved, 1);
+    }
+}
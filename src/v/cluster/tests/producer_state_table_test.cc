@@ -0,0 +1,182 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/producer_state_table.h"
+#include "model/fundamental.h"
+#include "random/generators.h"
+
+#include <seastar/core/seastar.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+namespace {
+
+std::filesystem::path make_test_dir() {
+    auto dir = std::filesystem::path(
+      "producer_state_table_test." + random_generators::gen_alphanum_string(8));
+    ss::recursive_touch_directory(dir.string()).get();
+    return dir;
+}
+
+model::producer_identity pid(int64_t id) {
+    return model::producer_identity(id, 0);
+}
+
+bool never_pinned(model::producer_identity) { return false; }
+
+/// Writes the entries of the producers [0, count), spilling the idle ones
+void populate(cluster::producer_state_table& table, int count) {
+    for (int i = 0; i < count; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        auto [entry, inserted] = table.try_emplace(pid(i));
+        BOOST_REQUIRE(inserted);
+        entry.seq = i;
+        entry.last_offset = kafka::offset(i);
+        entry.last_write_timestamp = 1000 + i;
+    }
+    table.spill(never_pinned, 0).get();
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_spilled_entries_are_prefetched) {
+    cluster::producer_state_table table(make_test_dir(), 100);
+    auto stop = ss::defer([&table] { table.stop().get(); });
+
+    populate(table, 1000);
+    BOOST_REQUIRE_LE(table.size(), 100);
+
+    for (int i = 0; i < 1000; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        auto entry = table.find(pid(i));
+        BOOST_REQUIRE(entry != nullptr);
+        BOOST_REQUIRE_EQUAL(entry->seq, i);
+        BOOST_REQUIRE_EQUAL(entry->last_offset, kafka::offset(i));
+    }
+
+    // unknown producers inside and outside of the spilled range
+    auto p = table.prefetch(pid(2000)).get();
+    BOOST_REQUIRE(table.find(pid(2000)) == nullptr);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_updates_shadow_spilled_entries) {
+    cluster::producer_state_table table(make_test_dir(), 100);
+    auto stop = ss::defer([&table] { table.stop().get(); });
+    populate(table, 1000);
+
+    // updating a half of the spilled producers and erasing the other half
+    for (int i = 0; i < 1000; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        if (i % 2 == 0) {
+            auto entry = table.find_for_update(pid(i));
+            BOOST_REQUIRE(entry != nullptr);
+            entry->update(i + 1, kafka::offset(i + 1));
+        } else {
+            table.erase(pid(i));
+        }
+        if (table.needs_spill()) {
+            table.spill(never_pinned, 0).get();
+        }
+    }
+    table.spill(never_pinned, 0).get();
+
+    for (int i = 0; i < 1000; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        auto entry = table.find(pid(i));
+        if (i % 2 == 0) {
+            BOOST_REQUIRE(entry != nullptr);
+            BOOST_REQUIRE_EQUAL(entry->seq, i + 1);
+            BOOST_REQUIRE_EQUAL(entry->seq_cache.size(), 1u);
+        } else {
+            BOOST_REQUIRE(entry == nullptr);
+        }
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_pinned_entries_stay_in_memory) {
+    cluster::producer_state_table table(make_test_dir(), 100);
+    auto stop = ss::defer([&table] { table.stop().get(); });
+
+    auto pinned = table.prefetch(pid(5000)).get();
+    table.try_emplace(pid(5000)).first.last_write_timestamp = 1;
+    populate(table, 1000);
+    BOOST_REQUIRE(table.find(pid(5000)) != nullptr);
+
+    {
+        auto p = table.prefetch(pid(1)).get();
+        BOOST_REQUIRE(table.find(pid(1)) != nullptr);
+    }
+    for (int i = 2000; i < 2200; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        table.try_emplace(pid(i)).first.last_write_timestamp = 1000 + i;
+    }
+    table.spill([](model::producer_identity p) { return p == pid(1); }, 0)
+      .get();
+    BOOST_REQUIRE(table.find(pid(1)) != nullptr);
+    BOOST_REQUIRE(table.find(pid(2000)) == nullptr);
+    BOOST_REQUIRE(table.find(pid(5000)) != nullptr);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_expired_entries_are_dropped) {
+    cluster::producer_state_table table(make_test_dir(), 100);
+    auto stop = ss::defer([&table] { table.stop().get(); });
+    populate(table, 1000);
+
+    // the rewrite of the on-disk table drops the expired entries
+    for (int i = 1000; i < 1200; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        table.try_emplace(pid(i)).first.last_write_timestamp = 1000 + i;
+    }
+    table.spill(never_pinned, 1500).get();
+
+    for (int i = 0; i < 1200; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        BOOST_REQUIRE_EQUAL(table.find(pid(i)) != nullptr, i > 500);
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_spill_state_roundtrip) {
+    auto dir = make_test_dir();
+    cluster::producer_state_table::spill_state state;
+    std::vector<cluster::seq_entry> dirty;
+    {
+        cluster::producer_state_table table(dir, 100);
+        auto stop = ss::defer([&table] { table.stop().get(); });
+        populate(table, 1000);
+        for (int i = 0; i < 10; ++i) {
+            auto p = table.prefetch(pid(i)).get();
+            table.erase(pid(i));
+        }
+        table.for_each_dirty([&dirty](const cluster::seq_entry& entry) {
+            dirty.push_back(entry.copy());
+        });
+        state = table.get_spill_state();
+    }
+    BOOST_REQUIRE_GE(state.generation, 0);
+    BOOST_REQUIRE_EQUAL(state.erased.size(), 10u);
+
+    cluster::producer_state_table table(dir, 100);
+    auto stop = ss::defer([&table] { table.stop().get(); });
+    table.apply_spill_state(std::move(state)).get();
+    for (auto& entry : dirty) {
+        table.try_emplace(entry.pid).first = std::move(entry);
+    }
+    table.remove_unused_files().get();
+
+    for (int i = 0; i < 1000; ++i) {
+        auto p = table.prefetch(pid(i)).get();
+        auto entry = table.find(pid(i));
+        if (i < 10) {
+            BOOST_REQUIRE(entry == nullptr);
+        } else {
+            BOOST_REQUIRE(entry != nullptr);
+            BOOST_REQUIRE_EQUAL(entry->seq, i);
+        }
+    }
+}
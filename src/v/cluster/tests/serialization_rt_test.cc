@@ -1137,6 +1137,29 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         cluster::abort_tx_reply data{random_tx_errc()};
         roundtrip_test(data);
     }
+    {
+        cluster::tx_markers_request data;
+        data.type = cluster::tx_marker_type::prepare;
+        data.tm = tests::random_named_int<model::partition_id>();
+        data.pid = random_producer_identity();
+        data.tx_seq = tests::random_named_int<model::tx_seq>();
+        for (int i = 0, mi = random_generators::get_int(10); i < mi; i++) {
+            cluster::tx_marker_partition partition;
+            partition.ntp = model::random_ntp();
+            partition.etag = tests::random_named_int<model::term_id>();
+            data.partitions.push_back(std::move(partition));
+        }
+        data.timeout = random_timeout_clock_duration();
+
+        serde_roundtrip_test(data);
+    }
+    {
+        cluster::tx_markers_reply data;
+        for (int i = 0, mi = random_generators::get_int(10); i < mi; i++) {
+            data.results.push_back(random_tx_errc());
+        }
+        serde_roundtrip_test(data);
+    }
     {
         cluster::begin_group_tx_request data{
           model::random_ntp(),
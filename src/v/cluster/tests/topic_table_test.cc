@@ -179,8 +179,9 @@ void validate_brokers_revisions(
     auto p_it = tp_it->second.metadata.get_assignments().find(ntp.tp.partition);
     BOOST_REQUIRE(p_it != tp_it->second.metadata.get_assignments().end());
 
-    auto rev_it = tp_it->second.replica_revisions.find(ntp.tp.partition);
-    BOOST_REQUIRE(rev_it != tp_it->second.replica_revisions.end());
+    BOOST_REQUIRE(tp_it->second.replica_revisions.contains(ntp.tp.partition));
+    auto revisions = tp_it->second.replica_revisions.get(
+      ntp.tp.partition, p_it->replicas);
 
     for (auto& bs : p_it->replicas) {
         fmt::print("replica: {}\n", bs);
@@ -189,20 +190,20 @@ void validate_brokers_revisions(
         fmt::print("expected_rev: {} = {}\n", bs.first, bs.second);
     }
 
-    for (auto& bs : rev_it->second) {
+    for (auto& bs : revisions) {
         fmt::print("current_rev: {} = {}\n", bs.first, bs.second);
     }
-    BOOST_REQUIRE_EQUAL(expected_revisions.size(), rev_it->second.size());
+    BOOST_REQUIRE_EQUAL(expected_revisions.size(), revisions.size());
     for (auto& bs : p_it->replicas) {
-        auto r = rev_it->second.find(bs.node_id);
+        auto r = revisions.find(bs.node_id);
         auto ex = expected_revisions.find(bs.node_id);
 
-        BOOST_REQUIRE(r != rev_it->second.end());
+        BOOST_REQUIRE(r != revisions.end());
         BOOST_REQUIRE(ex != expected_revisions.end());
 
         fmt::print("Checking {} == {}\n", r->second, ex->second);
         BOOST_REQUIRE_EQUAL(
-          rev_it->second.find(bs.node_id)->second,
+          revisions.find(bs.node_id)->second,
           expected_revisions.find(bs.node_id)->second);
     }
 }
@@ -396,3 +397,45 @@ FIXTURE_TEST(test_tracking_broker_revisions, topic_table_fixture) {
         {n_4, model::revision_id(13)},
         {n_3, model::revision_id(11)}});
 }
+
+SEASTAR_THREAD_TEST_CASE(test_replica_revisions) {
+    cluster::topic_table::replica_revisions_t revisions;
+    std::vector<model::broker_shard> replicas{
+      model::broker_shard{model::node_id(0), 0},
+      model::broker_shard{model::node_id(1), 0}};
+
+    revisions.add(model::partition_id(0), model::revision_id(10));
+    revisions.add(model::partition_id(2), model::revision_id(12));
+    BOOST_REQUIRE(revisions.contains(model::partition_id(0)));
+    BOOST_REQUIRE(!revisions.contains(model::partition_id(1)));
+    BOOST_REQUIRE(revisions.contains(model::partition_id(2)));
+    BOOST_REQUIRE(!revisions.contains(model::partition_id(3)));
+
+    using map_t = cluster::topic_table::replicas_revision_map;
+    BOOST_REQUIRE(
+      revisions.get(model::partition_id(2), replicas)
+      == map_t(
+        {{model::node_id(0), model::revision_id(12)},
+         {model::node_id(1), model::revision_id(12)}}));
+
+    // replicas with different revisions are tracked separately
+    map_t moved{
+      {model::node_id(0), model::revision_id(10)},
+      {model::node_id(2), model::revision_id(20)}};
+    revisions.set(model::partition_id(0), moved);
+    BOOST_REQUIRE_EQUAL(revisions.moved_partitions(), 1);
+    BOOST_REQUIRE(revisions.get(model::partition_id(0), replicas) == moved);
+
+    // and collapse when all of them share the revision again
+    revisions.set(
+      model::partition_id(0),
+      map_t(
+        {{model::node_id(0), model::revision_id(10)},
+         {model::node_id(1), model::revision_id(10)}}));
+    BOOST_REQUIRE_EQUAL(revisions.moved_partitions(), 0);
+    BOOST_REQUIRE(
+      revisions.get(model::partition_id(0), replicas)
+      == map_t(
+        {{model::node_id(0), model::revision_id(10)},
+         {model::node_id(1), model::revision_id(10)}}));
+}
@@ -58,20 +58,16 @@ topic_table::apply(create_topic_cmd cmd, model::offset offset) {
       .metadata = topic_metadata(
         std::move(cmd.value), model::revision_id(offset()), remote_revision)};
     // calculate delta
-    md.replica_revisions.reserve(cmd.value.assignments.size());
     for (auto& pas : md.get_assignments()) {
         auto ntp = model::ntp(cmd.key.ns, cmd.key.tp, pas.id);
-        for (auto& r : pas.replicas) {
-            md.replica_revisions[pas.id][r.node_id] = model::revision_id(
-              offset);
-        }
+        md.replica_revisions.add(pas.id, model::revision_id(offset));
         _pending_deltas.emplace_back(
           std::move(ntp),
           pas,
           offset,
           delta::op_type::add,
           std::nullopt,
-          md.replica_revisions[pas.id]);
+          md.replica_revisions.get(pas.id, pas.replicas));
     }
 
     _topics.insert({
@@ -152,17 +148,16 @@ topic_table::apply(create_partition_cmd cmd, model::offset offset) {
         tp->second.get_assignments().emplace(p_as);
         // propagate deltas
         auto ntp = model::ntp(cmd.key.ns, cmd.key.tp, p_as.id);
-        for (auto& bs : p_as.replicas) {
-            tp->second.replica_revisions[p_as.id][bs.node_id]
-              = model::revision_id(offset);
-        }
+        tp->second.replica_revisions.add(p_as.id, model::revision_id(offset));
+        auto revisions = tp->second.replica_revisions.get(
+          p_as.id, p_as.replicas);
         _pending_deltas.emplace_back(
           std::move(ntp),
           std::move(p_as),
           offset,
           delta::op_type::add,
           std::nullopt,
-          tp->second.replica_revisions[p_as.id]);
+          std::move(revisions));
     }
 
     notify_waiters();
@@ -321,13 +316,13 @@ topic_table::apply(cancel_moving_partition_replicas_cmd cmd, model::offset o) {
     // replace replica set with set from in progress operation
     current_assignment_it->replicas
       = in_progress_it->second.get_previous_replicas();
-    auto revisions_it = tp->second.replica_revisions.find(cmd.key.tp.partition);
     vassert(
-      revisions_it != tp->second.replica_revisions.end(),
+      tp->second.replica_revisions.contains(cmd.key.tp.partition),
       "partition {} replica revisions map must exists",
       cmd.key);
 
-    revisions_it->second = in_progress_it->second.get_replicas_revisions();
+    tp->second.replica_revisions.set(
+      cmd.key.tp.partition, in_progress_it->second.get_replicas_revisions());
 
     /// Update all non_replicable topics to have the same 'in-progress' state
     auto found = _topics_hierarchy.find(model::topic_namespace_view(cmd.key));
@@ -379,7 +374,7 @@ topic_table::apply(cancel_moving_partition_replicas_cmd cmd, model::offset o) {
       cmd.value.force ? delta::op_type::force_abort_update
                       : delta::op_type::cancel_update,
       std::move(replicas),
-      revisions_it->second);
+      in_progress_it->second.get_replicas_revisions());
 
     notify_waiters();
 
@@ -884,11 +879,12 @@ void topic_table::change_partition_replicas(
     if (are_replica_sets_equal(current_assignment.replicas, new_assignment)) {
         return;
     }
-    auto revisions_it = metadata.replica_revisions.find(ntp.tp.partition);
     vassert(
-      revisions_it != metadata.replica_revisions.end(),
+      metadata.replica_revisions.contains(ntp.tp.partition),
       "partition {}, replica revisions map must exists as partition is present",
       ntp);
+    auto revisions = metadata.replica_revisions.get(
+      ntp.tp.partition, current_assignment.replicas);
 
     _updates_in_progress.emplace(
       ntp,
@@ -898,7 +894,7 @@ void topic_table::change_partition_replicas(
         in_progress_state::update_requested,
         model::revision_id(o),
         // snapshot replicas revisions
-        revisions_it->second,
+        revisions,
         _probe));
     auto previous_assignment = current_assignment.replicas;
     // replace partition replica set
@@ -911,15 +907,16 @@ void topic_table::change_partition_replicas(
       current_assignment.replicas, previous_assignment);
 
     for (auto& r : added_replicas) {
-        revisions_it->second[r.node_id] = model::revision_id(o);
+        revisions[r.node_id] = model::revision_id(o);
     }
 
     auto removed_replicas = subtract_replica_sets_by_node_id(
       previous_assignment, current_assignment.replicas);
 
     for (auto& removed : removed_replicas) {
-        revisions_it->second.erase(removed.node_id);
+        revisions.erase(removed.node_id);
     }
+    metadata.replica_revisions.set(ntp.tp.partition, revisions);
 
     /// Update all non_replicable topics to have the same 'in-progress' state
     auto found = _topics_hierarchy.find(model::topic_namespace_view(ntp));
@@ -968,7 +965,63 @@ void topic_table::change_partition_replicas(
       o,
       delta::op_type::update,
       std::move(previous_assignment),
-      revisions_it->second);
+      std::move(revisions));
+}
+
+void topic_table::replica_revisions_t::add(
+  model::partition_id id, model::revision_id revision) {
+    const auto idx = static_cast<size_t>(id());
+    if (idx >= _initial.size()) {
+        _initial.resize(idx + 1, no_revision);
+    }
+    _initial[idx] = revision;
+    _moved.erase(id);
+}
+
+bool topic_table::replica_revisions_t::contains(model::partition_id id) const {
+    if (_moved.contains(id)) {
+        return true;
+    }
+    const auto idx = static_cast<size_t>(id());
+    return id >= model::partition_id{0} && idx < _initial.size()
+           && _initial[idx] != no_revision;
+}
+
+topic_table::replicas_revision_map topic_table::replica_revisions_t::get(
+  model::partition_id id,
+  const std::vector<model::broker_shard>& replicas) const {
+    if (auto it = _moved.find(id); it != _moved.end()) {
+        return it->second;
+    }
+    replicas_revision_map ret;
+    if (!contains(id)) {
+        return ret;
+    }
+    ret.reserve(replicas.size());
+    const auto revision = _initial[static_cast<size_t>(id())];
+    for (const auto& bs : replicas) {
+        ret.emplace(bs.node_id, revision);
+    }
+    return ret;
+}
+
+void topic_table::replica_revisions_t::set(
+  model::partition_id id, replicas_revision_map revisions) {
+    if (revisions.empty()) {
+        _moved.erase(id);
+        return;
+    }
+    const auto revision = revisions.begin()->second;
+    const bool same_revision = std::all_of(
+      revisions.begin(), revisions.end(), [revision](const auto& p) {
+          return p.second == revision;
+      });
+    if (same_revision) {
+        // all replicas are at the same revision again
+        add(id, revision);
+    } else {
+        _moved.insert_or_assign(id, std::move(revisions));
+    }
 }
 
 std::ostream&
@@ -116,11 +116,42 @@ public:
         topic_table_probe& _probe;
     };
 
+    /**
+     * Replica revisions of all partitions of a topic.
+     *
+     * All replicas of a partition get the same revision when the partition is
+     * created and they only diverge when the partition is moved. A map per
+     * partition costs a few allocations for every partition of the cluster on
+     * every shard, instead the creation revisions are kept in a flat vector
+     * indexed by partition id and maps are only kept for partitions with
+     * replicas of different revisions.
+     */
+    class replica_revisions_t {
+    public:
+        /// Adds a partition with all replicas at the given revision
+        void add(model::partition_id, model::revision_id);
+
+        bool contains(model::partition_id) const;
+
+        /// Revisions of the current replica set of a partition
+        replicas_revision_map
+        get(model::partition_id, const std::vector<model::broker_shard>&) const;
+
+        void set(model::partition_id, replicas_revision_map);
+
+        size_t moved_partitions() const { return _moved.size(); }
+
+    private:
+        static constexpr model::revision_id no_revision{-1};
+
+        std::vector<model::revision_id> _initial;
+        absl::flat_hash_map<model::partition_id, replicas_revision_map> _moved;
+    };
+
     struct topic_metadata_item {
         topic_metadata metadata;
         // replicas revisions for each partition
-        absl::node_hash_map<model::partition_id, replicas_revision_map>
-          replica_revisions;
+        replica_revisions_t replica_revisions;
 
         bool is_topic_replicable() const {
             return metadata.is_topic_replicable();
@@ -21,6 +21,7 @@
 #include "cluster/partition_leaders_table.h"
 #include "cluster/scheduling/constraints.h"
 #include "cluster/scheduling/partition_allocator.h"
+#include "cluster/scheduling/types.h"
 #include "cluster/types.h"
 #include "config/configuration.h"
 #include "model/errc.h"
@@ -41,6 +42,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <algorithm>
 #include <iterator>
@@ -451,6 +453,30 @@ make_allocation_request(const custom_assignable_topic_configuration& ca_cfg) {
     return req;
 }
 
+/*
+ * weights of the load aware placement constraints relative to the partition
+ * count based ones, running out of disk space is worse than serving more
+ * traffic than the other nodes
+ */
+static constexpr double disk_usage_weight = 1.0;
+static constexpr double throughput_weight = 0.5;
+
+/// Keeps the new replicas away from the nodes that are short of disk space
+/// or serve more traffic than the others
+void add_load_constraints(
+  allocation_request& req,
+  const allocation_load_report& report,
+  double max_disk_usage_ratio) {
+    auto disk = ss::make_lw_shared<soft_constraint_evaluator>(
+      least_disk_used(report, max_disk_usage_ratio, disk_usage_weight));
+    auto throughput = ss::make_lw_shared<soft_constraint_evaluator>(
+      least_throughput(report, throughput_weight));
+    for (auto& p : req.partitions) {
+        p.constraints.soft_constraints.push_back(disk);
+        p.constraints.soft_constraints.push_back(throughput);
+    }
+}
+
 errc topics_frontend::validate_topic_configuration(
   const custom_assignable_topic_configuration& assignable_config) {
     if (!validate_topic_name(assignable_config.cfg.tp_ns)) {
@@ -575,9 +601,20 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           assignable_config.cfg);
     }
 
+    auto load_report = co_await get_allocation_load_report(
+      assignable_config.cfg.properties.retention_bytes);
+
     auto units = co_await _allocator.invoke_on(
-      partition_allocator::shard, [assignable_config](partition_allocator& al) {
-          return al.allocate(make_allocation_request(assignable_config));
+      partition_allocator::shard,
+      [assignable_config,
+       load_report = std::move(load_report),
+       max_disk_usage_ratio = max_disk_usage_ratio()](
+        partition_allocator& al) {
+          auto report = load_report;
+          report.snapshot_allocations(al.state());
+          auto req = make_allocation_request(assignable_config);
+          add_load_constraints(req, report, max_disk_usage_ratio);
+          return al.allocate(std::move(req));
       });
 
     if (!units) {
@@ -892,12 +929,22 @@ ss::future<topic_result> topics_frontend::do_create_partition(
           p_cfg.tp_ns, errc::topic_invalid_partitions);
     }
 
+    auto load_report = co_await get_allocation_load_report(
+      tp_cfg->properties.retention_bytes);
+
     auto units = co_await _allocator.invoke_on(
       partition_allocator::shard,
       [p_cfg,
        current = tp_cfg->partition_count,
-       rf = replication_factor.value()](partition_allocator& al) {
-          return al.allocate(make_allocation_request(rf, current, p_cfg));
+       rf = replication_factor.value(),
+       load_report = std::move(load_report),
+       max_disk_usage_ratio = max_disk_usage_ratio()](
+        partition_allocator& al) {
+          auto report = load_report;
+          report.snapshot_allocations(al.state());
+          auto req = make_allocation_request(rf, current, p_cfg);
+          add_load_constraints(req, report, max_disk_usage_ratio);
+          return al.allocate(std::move(req));
       });
 
     // no assignments, error
@@ -1106,6 +1153,68 @@ ss::future<topics_frontend::capacity_info> topics_frontend::get_health_info(
     co_return info;
 }
 
+ss::future<allocation_load_report>
+topics_frontend::get_allocation_load_report(
+  tristate<size_t> retention_bytes) const {
+    allocation_load_report report;
+
+    auto health_report = co_await _hm_frontend.local().get_cluster_health(
+      cluster_report_filter{},
+      force_refresh::no,
+      model::timeout_clock::now() + _get_health_report_timeout);
+
+    if (!health_report) {
+        vlog(
+          clusterlog.info,
+          "unable to get health report, placing replicas by partition count "
+          "only - {}",
+          health_report.error().message());
+        co_return report;
+    }
+
+    uint64_t replicas = 0;
+    uint64_t replicas_size = 0;
+    uint64_t led_partitions = 0;
+    double throughput = 0;
+    for (const auto& node_report : health_report.value().node_reports) {
+        auto& load = report.nodes[node_report.id];
+        for (const auto& disk : node_report.local_state.disks) {
+            load.disk_total += disk.total;
+            load.disk_used += disk.total - disk.free;
+        }
+        for (const auto& status : node_report.topics) {
+            for (const auto& p : status.partitions) {
+                if (p.size_bytes != partition_status::invalid_size_bytes) {
+                    replicas_size += p.size_bytes;
+                    ++replicas;
+                }
+                if (p.leader_id == node_report.id) {
+                    ++led_partitions;
+                    load.throughput += static_cast<double>(p.bytes_rate)
+                                       + static_cast<double>(p.requests_rate)
+                                           * request_cost_bytes;
+                }
+            }
+            co_await ss::coroutine::maybe_yield();
+        }
+        throughput += load.throughput;
+    }
+
+    // a replica of a new partition is expected to be like the existing ones,
+    // but not bigger than the retention allows
+    if (replicas > 0) {
+        report.partition_size = replicas_size / replicas;
+    }
+    if (retention_bytes.has_value()) {
+        report.partition_size = std::min<uint64_t>(
+          report.partition_size, retention_bytes.value());
+    }
+    if (led_partitions > 0) {
+        report.partition_throughput = throughput / led_partitions;
+    }
+    co_return report;
+}
+
 partition_constraints topics_frontend::get_partition_constraints(
   model::partition_id id,
   cluster::replication_factor new_replication_factor,
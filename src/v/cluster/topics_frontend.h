@@ -17,6 +17,7 @@
 #include "cluster/errc.h"
 #include "cluster/fwd.h"
 #include "cluster/remote_topic_configuration_source.h"
+#include "cluster/scheduling/constraints.h"
 #include "cluster/scheduling/types.h"
 #include "cluster/topic_table.h"
 #include "cluster/types.h"
@@ -204,6 +205,13 @@ private:
     ss::future<capacity_info> get_health_info(
       model::topic_namespace topic, int32_t partition_count) const;
 
+    ss::future<allocation_load_report>
+      get_allocation_load_report(tristate<size_t> retention_bytes) const;
+
+    double max_disk_usage_ratio() const {
+        return (100 - _hard_max_disk_usage_ratio()) / 100.0;
+    }
+
     model::node_id _self;
     ss::sharded<controller_stm>& _stm;
     ss::sharded<partition_allocator>& _allocator;
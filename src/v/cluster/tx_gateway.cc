@@ -77,6 +77,12 @@ tx_gateway::abort_tx(abort_tx_request&& request, rpc::streaming_context&) {
       request.ntp, request.pid, request.tx_seq, request.timeout);
 }
 
+ss::future<tx_markers_reply> tx_gateway::write_tx_markers(
+  tx_markers_request&& request, rpc::streaming_context&) {
+    return _rm_partition_frontend.local().write_tx_markers_locally(
+      std::move(request));
+}
+
 ss::future<begin_group_tx_reply> tx_gateway::begin_group_tx(
   begin_group_tx_request&& request, rpc::streaming_context&) {
     return _rm_group_proxy->begin_group_tx_locally(std::move(request));
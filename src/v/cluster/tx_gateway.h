@@ -54,6 +54,9 @@ public:
     ss::future<abort_tx_reply>
     abort_tx(abort_tx_request&&, rpc::streaming_context&) override;
 
+    ss::future<tx_markers_reply>
+    write_tx_markers(tx_markers_request&&, rpc::streaming_context&) override;
+
     ss::future<begin_group_tx_reply>
     begin_group_tx(begin_group_tx_request&&, rpc::streaming_context&) override;
 
@@ -1429,21 +1429,17 @@ tx_gateway_frontend::do_abort_tm_tx(
         tx = changed_tx.value();
     }
 
-    std::vector<ss::future<abort_tx_reply>> pfs;
-    for (auto rm : tx.partitions) {
-        pfs.push_back(_rm_partition_frontend.local().abort_tx(
-          rm.ntp, tx.pid, tx.tx_seq, timeout));
-    }
+    auto pf = write_tx_markers(tx_marker_type::abort, tx, timeout);
     std::vector<ss::future<abort_group_tx_reply>> gfs;
     for (auto group : tx.groups) {
         gfs.push_back(_rm_group_proxy->abort_group_tx(
           group.group_id, tx.pid, tx.tx_seq, timeout));
     }
-    auto prs = co_await when_all_succeed(pfs.begin(), pfs.end());
+    auto prs = co_await std::move(pf);
     auto grs = co_await when_all_succeed(gfs.begin(), gfs.end());
     bool ok = true;
-    for (const auto& r : prs) {
-        ok = ok && (r.ec == tx_errc::none);
+    for (auto ec : prs) {
+        ok = ok && (ec == tx_errc::none);
     }
     for (const auto& r : grs) {
         ok = ok && (r.ec == tx_errc::none);
@@ -1481,16 +1477,7 @@ tx_gateway_frontend::do_commit_tm_tx(
             }
         }
 
-        std::vector<ss::future<prepare_tx_reply>> pfs;
-        for (auto rm : tx.partitions) {
-            pfs.push_back(_rm_partition_frontend.local().prepare_tx(
-              rm.ntp,
-              rm.etag,
-              model::tx_manager_ntp.tp.partition,
-              tx.pid,
-              tx.tx_seq,
-              timeout));
-        }
+        auto pf = write_tx_markers(tx_marker_type::prepare, tx, timeout);
 
         std::vector<ss::future<prepare_group_tx_reply>> pgfs;
         for (auto group : tx.groups) {
@@ -1516,10 +1503,10 @@ tx_gateway_frontend::do_commit_tm_tx(
 
         auto ok = true;
         auto rejected = false;
-        auto prs = co_await when_all_succeed(pfs.begin(), pfs.end());
-        for (const auto& r : prs) {
-            ok = ok && (r.ec == tx_errc::none);
-            rejected = rejected || (r.ec == tx_errc::request_rejected);
+        auto prs = co_await std::move(pf);
+        for (auto ec : prs) {
+            ok = ok && (ec == tx_errc::none);
+            rejected = rejected || (ec == tx_errc::request_rejected);
         }
         auto pgrs = co_await when_all_succeed(pgfs.begin(), pgfs.end());
         for (const auto& r : pgrs) {
@@ -1575,19 +1562,15 @@ tx_gateway_frontend::do_commit_tm_tx(
         gfs.push_back(_rm_group_proxy->commit_group_tx(
           group.group_id, tx.pid, tx.tx_seq, timeout));
     }
-    std::vector<ss::future<commit_tx_reply>> cfs;
-    for (auto rm : tx.partitions) {
-        cfs.push_back(_rm_partition_frontend.local().commit_tx(
-          rm.ntp, tx.pid, tx.tx_seq, timeout));
-    }
+    auto cf = write_tx_markers(tx_marker_type::commit, tx, timeout);
     auto ok = true;
     auto grs = co_await when_all_succeed(gfs.begin(), gfs.end());
     for (const auto& r : grs) {
         ok = ok && (r.ec == tx_errc::none);
     }
-    auto crs = co_await when_all_succeed(cfs.begin(), cfs.end());
-    for (const auto& r : crs) {
-        ok = ok && (r.ec == tx_errc::none);
+    auto crs = co_await std::move(cf);
+    for (auto ec : crs) {
+        ok = ok && (ec == tx_errc::none);
     }
     if (!ok) {
         co_return tx_errc::unknown_server_error;
@@ -1595,6 +1578,27 @@ tx_gateway_frontend::do_commit_tm_tx(
     co_return tx;
 }
 
+ss::future<std::vector<tx_errc>> tx_gateway_frontend::write_tx_markers(
+  tx_marker_type type,
+  const tm_transaction& tx,
+  model::timeout_clock::duration timeout) {
+    std::vector<tx_marker_partition> partitions;
+    partitions.reserve(tx.partitions.size());
+    for (const auto& rm : tx.partitions) {
+        tx_marker_partition partition;
+        partition.ntp = rm.ntp;
+        partition.etag = rm.etag;
+        partitions.push_back(std::move(partition));
+    }
+    return _rm_partition_frontend.local().write_tx_markers(
+      type,
+      model::tx_manager_ntp.tp.partition,
+      tx.pid,
+      tx.tx_seq,
+      std::move(partitions),
+      timeout);
+}
+
 ss::future<tx_errc> tx_gateway_frontend::recommit_tm_tx(
   tm_transaction tx, model::timeout_clock::duration timeout) {
     std::vector<ss::future<commit_group_tx_reply>> gfs;
@@ -1602,20 +1606,16 @@ ss::future<tx_errc> tx_gateway_frontend::recommit_tm_tx(
         gfs.push_back(_rm_group_proxy->commit_group_tx(
           group.group_id, tx.pid, tx.tx_seq, timeout));
     }
-    std::vector<ss::future<commit_tx_reply>> cfs;
-    for (auto rm : tx.partitions) {
-        cfs.push_back(_rm_partition_frontend.local().commit_tx(
-          rm.ntp, tx.pid, tx.tx_seq, timeout));
-    }
+    auto cf = write_tx_markers(tx_marker_type::commit, tx, timeout);
 
     auto ok = true;
     auto grs = co_await when_all_succeed(gfs.begin(), gfs.end());
     for (const auto& r : grs) {
         ok = ok && (r.ec == tx_errc::none);
     }
-    auto crs = co_await when_all_succeed(cfs.begin(), cfs.end());
-    for (const auto& r : crs) {
-        ok = ok && (r.ec == tx_errc::none);
+    auto crs = co_await std::move(cf);
+    for (auto ec : crs) {
+        ok = ok && (ec == tx_errc::none);
     }
     if (!ok) {
         co_return tx_errc::unknown_server_error;
@@ -1625,21 +1625,17 @@ ss::future<tx_errc> tx_gateway_frontend::recommit_tm_tx(
 
 ss::future<tx_errc> tx_gateway_frontend::reabort_tm_tx(
   tm_transaction tx, model::timeout_clock::duration timeout) {
-    std::vector<ss::future<abort_tx_reply>> pfs;
-    for (auto rm : tx.partitions) {
-        pfs.push_back(_rm_partition_frontend.local().abort_tx(
-          rm.ntp, tx.pid, tx.tx_seq, timeout));
-    }
+    auto pf = write_tx_markers(tx_marker_type::abort, tx, timeout);
     std::vector<ss::future<abort_group_tx_reply>> gfs;
     for (auto group : tx.groups) {
         gfs.push_back(_rm_group_proxy->abort_group_tx(
           group.group_id, tx.pid, tx.tx_seq, timeout));
     }
-    auto prs = co_await when_all_succeed(pfs.begin(), pfs.end());
+    auto prs = co_await std::move(pf);
     auto grs = co_await when_all_succeed(gfs.begin(), gfs.end());
     auto ok = true;
-    for (const auto& r : prs) {
-        ok = ok && (r.ec == tx_errc::none);
+    for (auto ec : prs) {
+        ok = ok && (ec == tx_errc::none);
     }
     for (const auto& r : grs) {
         ok = ok && (r.ec == tx_errc::none);
@@ -181,6 +181,10 @@ private:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
+    /// Writes the markers to all partitions of the transaction, see
+    /// rm_partition_frontend::write_tx_markers
+    ss::future<std::vector<tx_errc>> write_tx_markers(
+      tx_marker_type, const tm_transaction&, model::timeout_clock::duration);
     ss::future<tx_errc>
       recommit_tm_tx(tm_transaction, model::timeout_clock::duration);
     ss::future<tx_errc>
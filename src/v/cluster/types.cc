@@ -777,6 +777,36 @@ std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, tx_marker_type t) {
+    switch (t) {
+    case tx_marker_type::prepare:
+        return o << "prepare";
+    case tx_marker_type::commit:
+        return o << "commit";
+    case tx_marker_type::abort:
+        return o << "abort";
+    }
+    return o << "unknown";
+}
+
+std::ostream& operator<<(std::ostream& o, const tx_markers_request& r) {
+    fmt::print(
+      o,
+      "{{type {} tm {} pid {} tx_seq {} partitions {} timeout {}}}",
+      r.type,
+      r.tm,
+      r.pid,
+      r.tx_seq,
+      r.partitions.size(),
+      r.timeout);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const tx_markers_reply& r) {
+    fmt::print(o, "{{results {}}}", r.results.size());
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const begin_group_tx_request& r) {
     fmt::print(
       o,
@@ -550,6 +550,64 @@ struct abort_tx_reply : serde::envelope<abort_tx_reply, serde::version<0>> {
     friend std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r);
 };
 
+enum class tx_marker_type : int8_t { prepare, commit, abort };
+
+std::ostream& operator<<(std::ostream&, tx_marker_type);
+
+struct tx_marker_partition
+  : serde::envelope<tx_marker_partition, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    model::ntp ntp;
+    // expected term of the partition's leader, used only by prepare
+    model::term_id etag;
+
+    friend bool
+    operator==(const tx_marker_partition&, const tx_marker_partition&)
+      = default;
+
+    auto serde_fields() { return std::tie(ntp, etag); }
+};
+
+/// Prepare, commit or abort markers of a transaction for all of its
+/// partitions led by the receiving node
+struct tx_markers_request
+  : serde::envelope<tx_markers_request, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    tx_marker_type type;
+    model::partition_id tm;
+    model::producer_identity pid;
+    model::tx_seq tx_seq;
+    std::vector<tx_marker_partition> partitions;
+    model::timeout_clock::duration timeout;
+
+    friend bool operator==(const tx_markers_request&, const tx_markers_request&)
+      = default;
+
+    auto serde_fields() {
+        return std::tie(type, tm, pid, tx_seq, partitions, timeout);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const tx_markers_request& r);
+};
+
+struct tx_markers_reply
+  : serde::envelope<tx_markers_reply, serde::version<0>> {
+    using rpc_adl_exempt = std::true_type;
+
+    // in the order of the request's partitions
+    std::vector<tx_errc> results;
+
+    friend bool operator==(const tx_markers_reply&, const tx_markers_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(results); }
+
+    friend std::ostream& operator<<(std::ostream& o, const tx_markers_reply& r);
+};
+
 struct begin_group_tx_request
   : serde::envelope<begin_group_tx_request, serde::version<0>> {
     model::ntp ntp;
@@ -53,4 +53,44 @@ iobuf compressor::uncompress(const iobuf& io, type t) {
     }
 }
 
+ss::future<iobuf> compressor::compress_async(const iobuf& io, type t) {
+    switch (t) {
+    case type::none:
+        return ss::make_exception_future<iobuf>(std::runtime_error(
+          "compressor: nothing to compress for 'none'"));
+    case type::gzip:
+        return internal::gzip_compressor::compress_async(io);
+    case type::snappy:
+        return internal::snappy_java_compressor::compress_async(io);
+    case type::lz4:
+        return internal::lz4_frame_compressor::compress_async(io);
+    case type::zstd:
+        return internal::zstd_compressor::compress_async(io);
+    default:
+        vassert(false, "Cannot compress type {}", t);
+    }
+}
+ss::future<iobuf>
+compressor::uncompress_async(const iobuf& io, type t, size_t max_size) {
+    if (io.empty()) {
+        return ss::make_exception_future<iobuf>(std::runtime_error(fmt::format(
+          "Asked to decomrpess:{} an empty buffer:{}", (int)t, io)));
+    }
+    switch (t) {
+    case type::none:
+        return ss::make_exception_future<iobuf>(std::runtime_error(
+          "compressor: nothing to uncompress for 'none'"));
+    case type::gzip:
+        return internal::gzip_compressor::uncompress_async(io, max_size);
+    case type::snappy:
+        return internal::snappy_java_compressor::uncompress_async(io, max_size);
+    case type::lz4:
+        return internal::lz4_frame_compressor::uncompress_async(io, max_size);
+    case type::zstd:
+        return internal::zstd_compressor::uncompress_async(io, max_size);
+    default:
+        vassert(false, "Cannot uncompress type {}", t);
+    }
+}
+
 } // namespace compression
@@ -12,15 +12,47 @@
 #pragma once
 #include "bytes/iobuf.h"
 #include "model/compression.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+
+#include <fmt/format.h>
+
+#include <limits>
+#include <stdexcept>
+
 namespace compression {
 
 using type = model::compression;
+
+/// Default limit of the uncompressed size of the async decompression
+inline constexpr size_t no_output_limit = std::numeric_limits<size_t>::max();
+
+/// Thrown by the async decompression when the uncompressed data is larger than
+/// the limit. Decompression stops once the limit is reached, so the memory
+/// allocated for the output is bounded by it.
+class output_limit_exceeded final : public std::runtime_error {
+public:
+    explicit output_limit_exceeded(size_t limit)
+      : std::runtime_error(
+        fmt::format("uncompressed size exceeds the limit of {} bytes", limit)) {
+    }
+};
+
 // a very simple compressor. Exposes virtually no knobs and uses
 // the defaults for all compressors. In the future, we can make these
 // a virtual interface so we can instantiate them
 struct compressor {
     static iobuf compress(const iobuf&, type);
     static iobuf uncompress(const iobuf&, type);
+
+    // same as above, but the input is processed in chunks of at most 128KiB
+    // with preemption points in between, so large buffers don't stall the
+    // reactor. the input must outlive the returned future. decompression
+    // fails with output_limit_exceeded if the output is larger than max_size.
+    static ss::future<iobuf> compress_async(const iobuf&, type);
+    static ss::future<iobuf> uncompress_async(
+      const iobuf&, type, size_t max_size = no_output_limit);
 };
 
 } // namespace compression
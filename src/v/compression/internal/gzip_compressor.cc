@@ -10,12 +10,14 @@
 #include "compression/internal/gzip_compressor.h"
 
 #include "bytes/bytes.h"
+#include "compression/internal/stream_codec.h"
 #include "vassert.h"
 
 #include <seastar/core/temporary_buffer.hh>
 
 #include <fmt/core.h>
 
+#include <memory>
 #include <zlib.h>
 
 namespace compression::internal {
@@ -39,41 +41,58 @@ inline z_stream default_zstream() {
     return zs;
 }
 
-class gzip_compression_codec {
-public:
-    gzip_compression_codec() noexcept = default;
-    gzip_compression_codec(const gzip_compression_codec&) = delete;
-    gzip_compression_codec& operator=(const gzip_compression_codec&) = delete;
-    gzip_compression_codec(gzip_compression_codec&&) noexcept = delete;
-    gzip_compression_codec&
-    operator=(gzip_compression_codec&&) noexcept = delete;
-
-    void reset() {
-        vassert(!_init, "Double initialized gzip decompression codec");
-        _stream = default_zstream();
-        throw_if_zstream_error(
-          "gzip compress deflateInit2 error: {}",
-          deflateInit2(
-            &_stream,
-            Z_DEFAULT_COMPRESSION,
-            Z_DEFLATED,
-            15 + 16,
-            8 /*512 byte*/,
-            Z_DEFAULT_STRATEGY));
-        _init = true;
-    }
-    z_stream& stream() { return _stream; }
-    ~gzip_compression_codec() {
-        if (_init) {
-            _init = false;
-            deflateEnd(&_stream);
-        }
+struct deflate_stream_deleter {
+    void operator()(z_stream* s) const {
+        deflateEnd(s);
+        delete s; // NOLINT
     }
+};
+using deflate_stream = std::unique_ptr<z_stream, deflate_stream_deleter>;
 
-private:
-    bool _init{false};
-    z_stream _stream;
+struct inflate_stream_deleter {
+    void operator()(z_stream* s) const {
+        inflateEnd(s);
+        delete s; // NOLINT
+    }
 };
+using inflate_stream = std::unique_ptr<z_stream, inflate_stream_deleter>;
+
+static deflate_stream make_deflate_stream() {
+    // zlib keeps a pointer to the stream, it must be initialized in place
+    auto zs = std::make_unique<z_stream>(default_zstream());
+    throw_if_zstream_error(
+      "gzip compress deflateInit2 error: {}",
+      deflateInit2(
+        zs.get(),
+        Z_DEFAULT_COMPRESSION,
+        Z_DEFLATED,
+        15 + 16,
+        8 /*512 byte*/,
+        Z_DEFAULT_STRATEGY));
+    return deflate_stream(zs.release());
+}
+
+static inflate_stream make_inflate_stream() {
+    auto zs = std::make_unique<z_stream>(default_zstream());
+    throw_if_zstream_error(
+      "gzip error with inflateInit2:{}", inflateInit2(zs.get(), 15 + 32));
+    return inflate_stream(zs.release());
+}
+
+static context_pool<deflate_stream>::lease acquire_deflate_stream() {
+    static thread_local context_pool<deflate_stream> pool;
+    return pool.acquire(make_deflate_stream, [](z_stream* zs) {
+        throw_if_zstream_error("gzip deflateReset error: {}", deflateReset(zs));
+    });
+}
+
+static context_pool<inflate_stream>::lease acquire_inflate_stream() {
+    static thread_local context_pool<inflate_stream> pool;
+    return pool.acquire(make_inflate_stream, [](z_stream* zs) {
+        throw_if_zstream_error("gzip inflateReset error: {}", inflateReset(zs));
+    });
+}
+
 class gzip_decompression_codec {
 public:
     gzip_decompression_codec(const char* src, size_t src_size) noexcept
@@ -124,42 +143,78 @@ private:
 };
 
 iobuf gzip_compressor::compress(const iobuf& b) {
-    ss::temporary_buffer<char> obuf;
-    {
-        gzip_compression_codec def;
-        def.reset();
-        z_stream& strm = def.stream();
-        /* Calculate maximum compressed size and
-         * allocate an output buffer accordingly, being
-         * prefixed with the Message header. */
-        const size_t output_size = deflateBound(&strm, b.size_bytes());
-        obuf = ss::temporary_buffer<char>(output_size);
+    auto def = acquire_deflate_stream();
+    z_stream& strm = *def.get();
+    /* Calculate maximum compressed size and
+     * allocate an output buffer accordingly, being
+     * prefixed with the Message header. */
+    const size_t output_size = deflateBound(&strm, b.size_bytes());
+    ss::temporary_buffer<char> obuf(output_size);
+
+    // NOLINTNEXTLINE
+    strm.next_out = (unsigned char*)obuf.get_write();
+    strm.avail_out = output_size;
 
+    /* Iterate through each segment and compress it. */
+    for (auto& io : b) {
+        // zlib is not const correct
         // NOLINTNEXTLINE
-        strm.next_out = (unsigned char*)obuf.get_write();
-        strm.avail_out = output_size;
-
-        /* Iterate through each segment and compress it. */
-        for (auto& io : b) {
-            // zlib is not const correct
-            // NOLINTNEXTLINE
-            strm.next_in = (unsigned char*)io.get();
-            strm.avail_in = io.size();
-            throw_if_zstream_error(
-              "gzip error compressing chunk: {}", deflate(&strm, Z_NO_FLUSH));
-        }
-        /* Finish the compression */
-        if (int ret = deflate(&strm, Z_FINISH); ret != Z_STREAM_END) {
-            throw_if_zstream_error("gzip error finishing compression: {}", ret);
-        }
-        obuf.trim(def.stream().total_out);
-        // trigger deflateEnd
+        strm.next_in = (unsigned char*)io.get();
+        strm.avail_in = io.size();
+        throw_if_zstream_error(
+          "gzip error compressing chunk: {}", deflate(&strm, Z_NO_FLUSH));
+    }
+    /* Finish the compression */
+    if (int ret = deflate(&strm, Z_FINISH); ret != Z_STREAM_END) {
+        throw_if_zstream_error("gzip error finishing compression: {}", ret);
     }
+    obuf.trim(strm.total_out);
+    std::move(def).release();
     iobuf ret;
     ret.append(std::move(obuf));
     return ret;
 }
 
+ss::future<iobuf> gzip_compressor::compress_async(const iobuf& b) {
+    auto def = acquire_deflate_stream();
+    output_chunks out;
+
+    auto step = [&def, &out](int flush) {
+        z_stream& strm = *def.get();
+        const size_t available = out.available();
+        // NOLINTNEXTLINE
+        strm.next_out = (unsigned char*)out.data();
+        strm.avail_out = available;
+        int ret = deflate(&strm, flush);
+        out.commit(available - strm.avail_out);
+        return ret;
+    };
+
+    co_await for_each_chunk(b, [&def, &step](const char* src, size_t n) {
+        z_stream& strm = *def.get();
+        // zlib is not const correct
+        // NOLINTNEXTLINE
+        strm.next_in = (unsigned char*)src;
+        strm.avail_in = n;
+        while (strm.avail_in > 0) {
+            throw_if_zstream_error(
+              "gzip error compressing chunk: {}", step(Z_NO_FLUSH));
+        }
+    });
+
+    /* Finish the compression */
+    int ret = Z_OK;
+    while (ret == Z_OK) {
+        ret = step(Z_FINISH);
+    }
+    if (ret != Z_STREAM_END) {
+        throw_zstream_error("gzip error finishing compression: {}", ret);
+    }
+
+    std::move(def).release();
+    co_return std::move(out).release();
+}
+
 void gzip_decompression_codec::inflate_to(char* output, size_t out_size) {
     size_t consumed_bytes = 0;
     int code = 0;
@@ -219,4 +274,53 @@ iobuf gzip_compressor::uncompress(const iobuf& b) {
       reinterpret_cast<const char*>(linearized.data()),
       linearized.size());
 }
+
+ss::future<iobuf>
+gzip_compressor::uncompress_async(const iobuf& b, size_t max_size) {
+    auto inf = acquire_inflate_stream();
+    output_chunks out(max_size);
+
+    int code = Z_OK;
+    auto step = [&inf, &out, &code] {
+        z_stream& strm = *inf.get();
+        const size_t available = out.available();
+        // NOLINTNEXTLINE
+        strm.next_out = (unsigned char*)out.data();
+        strm.avail_out = available;
+        code = inflate(&strm, Z_NO_FLUSH);
+        switch (code) {
+        case Z_STREAM_ERROR:
+        case Z_NEED_DICT:
+        case Z_DATA_ERROR:
+        case Z_MEM_ERROR:
+            throw_zstream_error("gzip uncmpress error:{}", code);
+        default: /*do nothing*/;
+        }
+        const size_t produced = available - strm.avail_out;
+        out.commit(produced);
+        return produced;
+    };
+
+    co_await for_each_chunk(
+      b, [&inf, &step, &code](const char* src, size_t n) {
+          z_stream& strm = *inf.get();
+          // zlib is not const correct
+          // NOLINTNEXTLINE
+          strm.next_in = (unsigned char*)src;
+          strm.avail_in = n;
+          // like the synchronous version, ignore data after the end of stream
+          while (strm.avail_in > 0 && code != Z_STREAM_END) {
+              step();
+          }
+      });
+
+    // flush the output which didn't fit in the last chunk
+    while (code != Z_STREAM_END && step() > 0) {
+    }
+
+    if (code == Z_STREAM_END) {
+        std::move(inf).release();
+    }
+    co_return std::move(out).release();
+}
 } // namespace compression::internal
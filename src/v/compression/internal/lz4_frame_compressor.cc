@@ -10,6 +10,7 @@
 #include "compression/internal/lz4_frame_compressor.h"
 
 #include "bytes/bytes.h"
+#include "compression/internal/stream_codec.h"
 #include "compression/logger.h"
 #include "static_deleter_fn.h"
 #include "units.h"
@@ -67,15 +68,34 @@ static lz4_decompression_ctx make_decompression_context() {
     return lz4_decompression_ctx(c);
 }
 
-iobuf lz4_frame_compressor::compress(const iobuf& b) {
-    auto ctx_ptr = make_compression_context();
-    LZ4F_compressionContext_t ctx = ctx_ptr.get();
+static context_pool<lz4_compression_ctx>::lease
+acquire_compression_context() {
+    static thread_local context_pool<lz4_compression_ctx> pool;
+    // LZ4F_compressBegin resets the context
+    return pool.acquire(make_compression_context, [](LZ4F_cctx*) {});
+}
+
+static context_pool<lz4_decompression_ctx>::lease
+acquire_decompression_context() {
+    static thread_local context_pool<lz4_decompression_ctx> pool;
+    return pool.acquire(
+      make_decompression_context, &LZ4F_resetDecompressionContext);
+}
+
+static LZ4F_preferences_t make_preferences(size_t content_size) {
     /* Required by Kafka */
     LZ4F_preferences_t prefs;
     std::memset(&prefs, 0, sizeof(prefs));
     prefs.compressionLevel = 1; // default
     prefs.frameInfo = {
-      .blockMode = LZ4F_blockIndependent, .contentSize = b.size_bytes()};
+      .blockMode = LZ4F_blockIndependent, .contentSize = content_size};
+    return prefs;
+}
+
+iobuf lz4_frame_compressor::compress(const iobuf& b) {
+    auto ctx_lease = acquire_compression_context();
+    LZ4F_compressionContext_t ctx = ctx_lease.get();
+    LZ4F_preferences_t prefs = make_preferences(b.size_bytes());
     const size_t output_buffer_size = LZ4F_compressBound(b.size_bytes(), &prefs)
                                       + lz4f_footer_size + lz4f_header_size;
     check_lz4_error("lz4_compressbound erorr:{}", output_buffer_size);
@@ -108,11 +128,39 @@ iobuf lz4_frame_compressor::compress(const iobuf& b) {
     check_lz4_error("lz4f_compressend:{}", code);
     consumed_bytes += code;
     obuf.trim(consumed_bytes);
+    std::move(ctx_lease).release();
     iobuf ret;
     ret.append(std::move(obuf));
     return ret;
 }
 
+ss::future<iobuf> lz4_frame_compressor::compress_async(const iobuf& b) {
+    auto ctx = acquire_compression_context();
+    LZ4F_preferences_t prefs = make_preferences(b.size_bytes());
+    output_chunks out;
+
+    size_t code = LZ4F_compressBegin(
+      ctx.get(), out.reserve(lz4f_header_size), lz4f_header_size, &prefs);
+    check_lz4_error("lz4f_compressbegin error:{}", code);
+    out.commit(code);
+
+    co_await for_each_chunk(b, [&ctx, &prefs, &out](const char* src, size_t n) {
+        const size_t bound = LZ4F_compressBound(n, &prefs);
+        size_t code = LZ4F_compressUpdate(
+          ctx.get(), out.reserve(bound), bound, src, n, nullptr);
+        check_lz4_error("lz4f_compressupdate error:{}", code);
+        out.commit(code);
+    });
+
+    const size_t bound = LZ4F_compressBound(0, &prefs) + lz4f_footer_size;
+    code = LZ4F_compressEnd(ctx.get(), out.reserve(bound), bound, nullptr);
+    check_lz4_error("lz4f_compressend:{}", code);
+    out.commit(code);
+
+    std::move(ctx).release();
+    co_return std::move(out).release();
+}
+
 inline static constexpr size_t
 compute_frame_uncompressed_size(size_t frame_size, size_t original) {
     if (frame_size == 0 || frame_size > original * 255) {
@@ -122,8 +170,8 @@ compute_frame_uncompressed_size(size_t frame_size, size_t original) {
 }
 
 static iobuf do_uncompressed(const char* src, const size_t src_size) {
-    auto ctx_ptr = make_decompression_context();
-    LZ4F_decompressionContext_t ctx = ctx_ptr.get();
+    auto ctx_lease = acquire_decompression_context();
+    LZ4F_decompressionContext_t ctx = ctx_lease.get();
     LZ4F_frameInfo_t fi;
     size_t in_sz = src_size;
     LZ4F_errorCode_t code = LZ4F_getFrameInfo(ctx, &fi, src, &in_sz);
@@ -195,6 +243,10 @@ static iobuf do_uncompressed(const char* src, const size_t src_size) {
     }
 
     obuf.trim(consumed_bytes);
+    if (code == 0) {
+        // the context is only reset after decoding a complete frame
+        std::move(ctx_lease).release();
+    }
     iobuf ret;
     ret.append(std::move(obuf));
     return ret;
@@ -213,4 +265,50 @@ iobuf lz4_frame_compressor::uncompress(const iobuf& b) {
       linearized.size());
 }
 
+ss::future<iobuf>
+lz4_frame_compressor::uncompress_async(const iobuf& b, size_t max_size) {
+    auto ctx = acquire_decompression_context();
+    output_chunks out(max_size);
+
+    // a hint of the input expected by the next call, 0 at the end of frame
+    size_t code = 1;
+    co_await for_each_chunk(b, [&ctx, &out, &code](const char* src, size_t n) {
+        while (n > 0) {
+            if (unlikely(code == 0)) {
+                throw std::runtime_error(fmt::format(
+                  "lz4 error. could not consume all input bytes in "
+                  "decompression. Unconsumed:{}",
+                  n));
+            }
+            size_t out_size = out.available();
+            size_t in_size = n;
+            code = LZ4F_decompress(
+              ctx.get(), out.data(), &out_size, src, &in_size, nullptr);
+            check_lz4_error("lz4f_decompress error: {}", code);
+            out.commit(out_size);
+            // NOLINTNEXTLINE
+            src += in_size;
+            n -= in_size;
+        }
+    });
+
+    // flush the output which didn't fit in the last chunk
+    while (code != 0) {
+        size_t out_size = out.available();
+        size_t in_size = 0;
+        code = LZ4F_decompress(
+          ctx.get(), out.data(), &out_size, nullptr, &in_size, nullptr);
+        check_lz4_error("lz4f_decompress error: {}", code);
+        if (out_size == 0) {
+            break;
+        }
+        out.commit(out_size);
+    }
+
+    if (code == 0) {
+        std::move(ctx).release();
+    }
+    co_return std::move(out).release();
+}
+
 } // namespace compression::internal
@@ -12,6 +12,7 @@
 #include "bytes/bytes.h"
 #include "bytes/details/io_iterator_consumer.h"
 #include "bytes/iobuf.h"
+#include "compression/internal/stream_codec.h"
 #include "compression/logger.h"
 #include "compression/snappy_standard_compressor.h"
 #include "likely.h"
@@ -55,12 +56,16 @@ void append_le(iobuf& o, T t) {
     // NOLINTNEXTLINE
     o.append((const char*)&x, sizeof(x));
 }
-iobuf snappy_java_compressor::compress(const iobuf& x) {
-    iobuf ret;
+static void append_header(iobuf& ret) {
     ret.append(
       snappy_magic::java_magic.data(), snappy_magic::java_magic.size());
     append_le(ret, snappy_magic::default_version);
     append_le(ret, snappy_magic::min_compatible_version);
+}
+
+iobuf snappy_java_compressor::compress(const iobuf& x) {
+    iobuf ret;
+    append_header(ret);
     // staging buffer
     ss::temporary_buffer<char> obuf(find_max_size_in_frags(x));
     for (const auto& f : x) {
@@ -73,15 +78,17 @@ iobuf snappy_java_compressor::compress(const iobuf& x) {
     }
     return ret;
 }
-iobuf snappy_java_compressor::uncompress(const iobuf& x) {
-    auto iter = details::io_iterator_consumer(x.cbegin(), x.cend());
+/// Checks the header of the snappy-java framing format. Returns false if the
+/// data isn't framed, i.e. it is compressed with plain snappy.
+static bool
+consume_header(details::io_iterator_consumer& iter, const iobuf& x) {
     if (unlikely(x.size_bytes() < snappy_magic::header_len)) {
-        return snappy_standard_compressor::uncompress(x);
+        return false;
     }
     std::array<uint8_t, snappy_magic::java_magic.size()> magic_compare{};
     iter.consume_to(magic_compare.size(), magic_compare.data());
     if (unlikely(snappy_magic::java_magic != magic_compare)) {
-        return snappy_standard_compressor::uncompress(x);
+        return false;
     }
     // NOTE: version and min_version are LITTLE_ENDIAN!
     const auto version = iter.consume_type<int32_t>();
@@ -94,19 +101,79 @@ iobuf snappy_java_compressor::uncompress(const iobuf& x) {
           version,
           min_version));
     }
+    return true;
+}
+
+static void uncompress_block(
+  details::io_iterator_consumer& iter,
+  iobuf& ret,
+  size_t max_size = no_output_limit) {
+    auto compressed_length = iter.consume_be_type<int32_t>();
+    // iobuf doesn't have a const compatible share interface so we make a
+    // copy here which is inefficient compared to a zero-copy approach.
+    auto chunk = iobuf_copy(iter, compressed_length);
+    auto output_size = snappy_standard_compressor::get_uncompressed_length(
+      chunk);
+    // the block declares its size, check it before allocating the output
+    if (output_size > max_size - ret.size_bytes()) {
+        throw output_limit_exceeded(max_size);
+    }
+    snappy_standard_compressor::uncompress_append(chunk, ret, output_size);
+}
+
+iobuf snappy_java_compressor::uncompress(const iobuf& x) {
+    auto iter = details::io_iterator_consumer(x.cbegin(), x.cend());
+    if (!consume_header(iter, x)) {
+        return snappy_standard_compressor::uncompress(x);
+    }
     // stream decoder next
     iobuf ret;
     const size_t input_bytes = x.size_bytes();
     while (iter.bytes_consumed() != input_bytes) {
-        auto compressed_length = iter.consume_be_type<int32_t>();
-        // iobuf doesn't have a const compatible share interface so we make a
-        // copy here which is inefficient compared to a zero-copy approach.
-        auto chunk = iobuf_copy(iter, compressed_length);
-        auto output_size = snappy_standard_compressor::get_uncompressed_length(
-          chunk);
-        snappy_standard_compressor::uncompress_append(chunk, ret, output_size);
+        uncompress_block(iter, ret);
     }
     return ret;
 }
 
+ss::future<iobuf> snappy_java_compressor::compress_async(const iobuf& x) {
+    // snappy is stateless, there is no codec context to reuse. the blocks are
+    // compressed straight into the output chunks instead of a staging buffer.
+    output_chunks out;
+    co_await for_each_chunk(x, [&out](const char* src, size_t n) {
+        const size_t prefix = sizeof(int32_t);
+        char* dst = out.reserve(prefix + snappy::MaxCompressedLength(n));
+        size_t omax = 0;
+        // NOLINTNEXTLINE
+        snappy::RawCompress(src, n, dst + prefix, &omax);
+        // must be int32 to be compatible && in big endian
+        auto len = ss::cpu_to_be(int32_t(omax));
+        std::memcpy(dst, &len, prefix);
+        out.commit(prefix + omax);
+    });
+
+    iobuf ret;
+    append_header(ret);
+    ret.append(std::move(out).release());
+    co_return ret;
+}
+
+ss::future<iobuf>
+snappy_java_compressor::uncompress_async(const iobuf& x, size_t max_size) {
+    auto iter = details::io_iterator_consumer(x.cbegin(), x.cend());
+    if (!consume_header(iter, x)) {
+        if (
+          snappy_standard_compressor::get_uncompressed_length(x) > max_size) {
+            throw output_limit_exceeded(max_size);
+        }
+        co_return snappy_standard_compressor::uncompress(x);
+    }
+    iobuf ret;
+    const size_t input_bytes = x.size_bytes();
+    while (iter.bytes_consumed() != input_bytes) {
+        uncompress_block(iter, ret, max_size);
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return ret;
+}
+
 } // namespace compression::internal
@@ -12,11 +12,19 @@
 #pragma once
 
 #include "bytes/iobuf.h"
+#include "compression/compression.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+
 
 namespace compression::internal {
 struct snappy_java_compressor {
     static iobuf compress(const iobuf&);
     static iobuf uncompress(const iobuf&);
+    static ss::future<iobuf> compress_async(const iobuf&);
+    static ss::future<iobuf>
+    uncompress_async(const iobuf&, size_t max_size = no_output_limit);
 };
 
 } // namespace compression::internal
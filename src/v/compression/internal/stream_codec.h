@@ -0,0 +1,163 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "bytes/details/io_allocation_size.h"
+#include "bytes/iobuf.h"
+#include "compression/compression.h"
+#include "seastarx.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/temporary_buffer.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace compression::internal {
+
+/// Amount of input consumed by the async codecs between two preemption
+/// checks, also the size of the output chunks they produce.
+inline constexpr size_t stream_chunk_size
+  = details::io_allocation_size::max_chunk_size;
+
+/// Calls `f(const char*, size_t)` for every chunk of at most
+/// `stream_chunk_size` bytes of the input and yields to the reactor in
+/// between. The input must outlive the returned future.
+template<typename Func>
+ss::future<> for_each_chunk(const iobuf& in, Func f) {
+    for (const auto& frag : in) {
+        for (size_t pos = 0; pos < frag.size(); pos += stream_chunk_size) {
+            f(frag.get() + pos, std::min(stream_chunk_size, frag.size() - pos));
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+}
+
+/// Output of a streaming codec. Collects the output in fixed size chunks
+/// instead of one buffer sized for the worst case.
+class output_chunks {
+public:
+    output_chunks() = default;
+
+    /// Fails with output_limit_exceeded once more than `max_size` bytes are
+    /// committed
+    explicit output_chunks(size_t max_size)
+      : _max_size(max_size) {}
+
+    /// Writable space of the current chunk
+    char* data() {
+        if (_buf.size() == _pos) {
+            next();
+        }
+        return _buf.get_write() + _pos;
+    }
+    size_t available() {
+        if (_buf.size() == _pos) {
+            next();
+        }
+        return _buf.size() - _pos;
+    }
+
+    /// Contiguous writable space of at least `n` bytes. Starts a new chunk,
+    /// larger than `stream_chunk_size` if needed, when the current one
+    /// doesn't have enough space left.
+    char* reserve(size_t n) {
+        if (_buf.size() - _pos < n) {
+            next(std::max(n, stream_chunk_size));
+        }
+        return _buf.get_write() + _pos;
+    }
+
+    /// Mark `n` bytes of the current chunk as written
+    void commit(size_t n) {
+        _pos += n;
+        _size += n;
+        if (_size > _max_size) {
+            throw output_limit_exceeded(_max_size);
+        }
+    }
+
+    iobuf release() && {
+        next(0);
+        return std::move(_out);
+    }
+
+private:
+    void next(size_t size = stream_chunk_size) {
+        if (_pos > 0) {
+            _buf.trim(_pos);
+            _out.append(std::move(_buf));
+        }
+        _buf = ss::temporary_buffer<char>(size);
+        _pos = 0;
+    }
+
+    iobuf _out;
+    ss::temporary_buffer<char> _buf;
+    size_t _pos{0};
+    size_t _size{0};
+    size_t _max_size{no_output_limit};
+};
+
+/// Per-shard free list of codec contexts. Creating a context is expensive for
+/// most codecs, so contexts are reused between calls. A context is owned
+/// exclusively by one (de)compression at a time, which allows the async codecs
+/// to yield while holding one.
+///
+/// `Ptr` is the owning pointer type of the context.
+template<typename Ptr>
+class context_pool {
+public:
+    static constexpr size_t max_pooled = 4;
+
+    /// Exclusive ownership of a context. The context is only returned to the
+    /// pool by `release()` so that contexts in an unknown state, e.g. after an
+    /// error, are destroyed instead of reused.
+    class lease {
+    public:
+        lease(context_pool& pool, Ptr ctx)
+          : _pool(&pool)
+          , _ctx(std::move(ctx)) {}
+
+        auto get() const { return _ctx.get(); }
+        auto operator->() const { return _ctx.get(); }
+
+        void release() && {
+            if (_pool->_free.size() < max_pooled) {
+                _pool->_free.push_back(std::move(_ctx));
+            }
+        }
+
+    private:
+        context_pool* _pool;
+        Ptr _ctx;
+    };
+
+    /// Take a pooled context or create one with `make()`. Pooled contexts are
+    /// passed to `reset(ctx)` first.
+    template<typename Make, typename Reset>
+    lease acquire(Make make, Reset reset) {
+        if (_free.empty()) {
+            return lease(*this, make());
+        }
+        auto ctx = std::move(_free.back());
+        _free.pop_back();
+        reset(ctx.get());
+        return lease(*this, std::move(ctx));
+    }
+
+private:
+    std::vector<Ptr> _free;
+};
+
+} // namespace compression::internal
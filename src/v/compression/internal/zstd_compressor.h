@@ -16,13 +16,21 @@ namespace compression::internal {
 
 struct zstd_compressor {
     static iobuf compress(const iobuf& b) {
-        stream_zstd fn;
+        // the compression context is reused between calls on a shard
+        static thread_local stream_zstd fn;
         return fn.compress(b);
     }
     static iobuf uncompress(const iobuf& b) {
         stream_zstd fn;
         return fn.uncompress(b);
     }
+    static ss::future<iobuf> compress_async(const iobuf& b) {
+        return stream_zstd::compress_async(b);
+    }
+    static ss::future<iobuf>
+    uncompress_async(const iobuf& b, size_t max_size = no_output_limit) {
+        return stream_zstd::uncompress_async(b, max_size);
+    }
 };
 
 } // namespace compression::internal
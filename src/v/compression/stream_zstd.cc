@@ -11,16 +11,20 @@
 
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "compression/internal/stream_codec.h"
 #include "compression/logger.h"
 #include "likely.h"
 #include "units.h"
 #include "vlog.h"
 
 #include <seastar/core/aligned_buffer.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <zstd.h>
 #include <zstd_errors.h>
 
@@ -39,13 +43,20 @@ static void throw_if_error(size_t rc) {
     }
 }
 
+// window of the workspace when it isn't initialized at startup
+static constexpr size_t default_window_size = 2_MiB;
+
 // workspace and decompression buffer
 static thread_local size_t dctx_workspace_size = 0;
 static thread_local std::unique_ptr<char[], ss::free_deleter> dctx_workspace;
 static thread_local ss::temporary_buffer<char> d_buffer;
 
+// largest window of the frames the workspace can decompress
+static thread_local size_t dctx_window_size = 0;
+
 void stream_zstd::init_workspace(size_t size) {
     if (!dctx_workspace) {
+        dctx_window_size = size;
         dctx_workspace_size = ZSTD_estimateDStreamSize(size);
         dctx_workspace = ss::allocate_aligned_buffer<char>(
           dctx_workspace_size, 8); // zstd requires alignment
@@ -57,11 +68,46 @@ void stream_zstd::init_workspace(size_t size) {
     }
 }
 
-void stream_zstd::reset_compressor() {
-    _compress.reset(ZSTD_createCCtx());
-    if (!_compress) {
+static stream_zstd::zstd_compress_ctx make_compress_ctx() {
+    stream_zstd::zstd_compress_ctx ctx(ZSTD_createCCtx());
+    if (!ctx) {
+        throw std::bad_alloc{};
+    }
+    return ctx;
+}
+
+static stream_zstd::zstd_decompress_ctx make_decompress_ctx() {
+    stream_zstd::zstd_decompress_ctx ctx(ZSTD_createDCtx());
+    if (!ctx) {
         throw std::bad_alloc{};
     }
+    return ctx;
+}
+
+/*
+ * The contexts of the async path allocate their buffers on demand. Limit the
+ * window like the static workspace of the synchronous path does, otherwise a
+ * frame from a client could make them allocate up to the zstd maximum.
+ */
+static stream_zstd::zstd_decompress_ctx make_bounded_decompress_ctx() {
+    auto window_size = dctx_window_size > 0 ? dctx_window_size
+                                            : default_window_size;
+    auto window_log = std::max<int>(
+      ZSTD_WINDOWLOG_ABSOLUTEMIN, std::bit_width(window_size) - 1);
+    auto ctx = make_decompress_ctx();
+    throw_if_error(
+      ZSTD_DCtx_setParameter(ctx.get(), ZSTD_d_windowLogMax, window_log));
+    return ctx;
+}
+
+void stream_zstd::reset_compressor() {
+    if (_compress) {
+        // reuse the context, allocating one per call is expensive
+        throw_if_error(
+          ZSTD_CCtx_reset(_compress.get(), ZSTD_reset_session_and_parameters));
+        return;
+    }
+    _compress = make_compress_ctx();
 }
 stream_zstd::zstd_compress_ctx& stream_zstd::compressor() {
     if (!_compress) {
@@ -78,7 +124,7 @@ ZSTD_DCtx* stream_zstd::decompressor() {
          * larger. but we also handle it here for things like tests that don't
          * exercise that startup code path.
          */
-        init_workspace(2_MiB);
+        init_workspace(default_window_size);
     }
     auto ctx = ZSTD_initStaticDCtx(dctx_workspace.get(), dctx_workspace_size);
     vassert(ctx, "Could not initialize static decompression context");
@@ -180,4 +226,90 @@ iobuf stream_zstd::do_uncompress(const iobuf& x) {
     return ret;
 }
 
+ss::future<iobuf> stream_zstd::compress_async(const iobuf& x) {
+    static thread_local internal::context_pool<zstd_compress_ctx> pool;
+    auto ctx = pool.acquire(make_compress_ctx, [](ZSTD_CCtx* c) {
+        throw_if_error(ZSTD_CCtx_reset(c, ZSTD_reset_session_and_parameters));
+    });
+    // NOTE: always enable content size. **decompression** depends on this
+    throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx.get(), x.size_bytes()));
+
+    internal::output_chunks out;
+    co_await internal::for_each_chunk(
+      x, [&ctx, &out](const char* src, size_t n) {
+          ZSTD_inBuffer in = {.src = src, .size = n, .pos = 0};
+          while (in.pos != in.size) {
+              ZSTD_outBuffer o = {
+                .dst = out.data(), .size = out.available(), .pos = 0};
+              throw_if_error(
+                ZSTD_compressStream2(ctx.get(), &o, &in, ZSTD_e_continue));
+              out.commit(o.pos);
+          }
+      });
+
+    // Must happen outside of loop to encode empty-buffer sizes
+    size_t remaining = 0;
+    do {
+        ZSTD_inBuffer in = {.src = nullptr, .size = 0, .pos = 0};
+        ZSTD_outBuffer o = {
+          .dst = out.data(), .size = out.available(), .pos = 0};
+        remaining = ZSTD_compressStream2(ctx.get(), &o, &in, ZSTD_e_end);
+        throw_if_error(remaining);
+        out.commit(o.pos);
+    } while (remaining != 0);
+
+    std::move(ctx).release();
+    co_return std::move(out).release();
+}
+
+ss::future<iobuf>
+stream_zstd::uncompress_async(const iobuf& x, size_t max_size) {
+    if (unlikely(x.empty())) {
+        throw std::runtime_error(
+          "Asked to stream_zstd::uncompress empty buffer");
+    }
+    // unlike the synchronous path the contexts can't share the static
+    // workspace, since a decompression may be suspended while using it.
+    static thread_local internal::context_pool<zstd_decompress_ctx> pool;
+    auto ctx = pool.acquire(make_bounded_decompress_ctx, [](ZSTD_DCtx* c) {
+        throw_if_error(ZSTD_DCtx_reset(c, ZSTD_reset_session_only));
+    });
+
+    internal::output_chunks out(max_size);
+    // 0 once a frame is completely decoded and flushed
+    size_t hint = 1;
+    // a small input may decode into a lot of output, so yield after every
+    // output chunk rather than after every input chunk
+    for (const auto& frag : x) {
+        ZSTD_inBuffer in = {.src = frag.get(), .size = frag.size(), .pos = 0};
+        while (in.pos != in.size) {
+            ZSTD_outBuffer o = {
+              .dst = out.data(), .size = out.available(), .pos = 0};
+            hint = ZSTD_decompressStream(ctx.get(), &o, &in);
+            throw_if_error(hint);
+            out.commit(o.pos);
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+
+    // flush the output which didn't fit in the last chunk
+    while (hint != 0) {
+        ZSTD_inBuffer in = {.src = nullptr, .size = 0, .pos = 0};
+        ZSTD_outBuffer o = {
+          .dst = out.data(), .size = out.available(), .pos = 0};
+        hint = ZSTD_decompressStream(ctx.get(), &o, &in);
+        throw_if_error(hint);
+        if (o.pos == 0) {
+            break;
+        }
+        out.commit(o.pos);
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    if (hint == 0) {
+        std::move(ctx).release();
+    }
+    co_return std::move(out).release();
+}
+
 } // namespace compression
@@ -11,8 +11,12 @@
 
 #pragma once
 #include "bytes/iobuf.h"
+#include "compression/compression.h"
+#include "seastarx.h"
 #include "static_deleter_fn.h"
 
+#include <seastar/core/future.hh>
+
 #include <memory>
 #include <zstd.h>
 
@@ -23,6 +27,10 @@ public:
       ZSTD_CCtx,
       // wrap ZSTD C API
       static_sized_deleter_fn<ZSTD_CCtx, &ZSTD_freeCCtx>>;
+    using zstd_decompress_ctx = std::unique_ptr<
+      ZSTD_DCtx,
+      // wrap ZSTD C API
+      static_sized_deleter_fn<ZSTD_DCtx, &ZSTD_freeDCtx>>;
 
     iobuf compress(const iobuf& b) { return do_compress(b); }
     iobuf uncompress(const iobuf& b) { return do_uncompress(b); }
@@ -31,6 +39,14 @@ public:
 
     static void init_workspace(size_t);
 
+    /// Same as compress/uncompress, but the input is processed in chunks with
+    /// preemption points in between. Contexts come from a per-shard pool.
+    /// The input must outlive the returned future. Decompression fails with
+    /// output_limit_exceeded if the output is larger than max_size.
+    static ss::future<iobuf> compress_async(const iobuf&);
+    static ss::future<iobuf>
+    uncompress_async(const iobuf&, size_t max_size = no_output_limit);
+
 private:
     iobuf do_compress(const iobuf&);
     iobuf do_uncompress(const iobuf&);
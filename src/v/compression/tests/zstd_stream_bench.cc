@@ -7,10 +7,12 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "compression/compression.h"
 #include "compression/stream_zstd.h"
 #include "random/generators.h"
 #include "vassert.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/testing/perf_tests.hh>
@@ -52,3 +54,56 @@ PERF_TEST(streaming_zstd_1mb, compress) { compress_test(1 << 20); }
 PERF_TEST(streaming_zstd_1mb, uncompress) { return uncompress_test(1 << 20); }
 PERF_TEST(streaming_zstd_10mb, compress) { compress_test(10 << 20); }
 PERF_TEST(streaming_zstd_10mb, uncompress) { return uncompress_test(10 << 20); }
+
+inline void compressor_test(model::compression t, size_t data_size) {
+    auto o = gen(data_size);
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(compression::compressor::compress(o, t));
+    perf_tests::stop_measuring_time();
+}
+
+inline void uncompressor_test(model::compression t, size_t data_size) {
+    auto o = compression::compressor::compress(gen(data_size), t);
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(compression::compressor::uncompress(o, t));
+    perf_tests::stop_measuring_time();
+}
+
+inline ss::future<> compressor_async_test(model::compression t, size_t size) {
+    auto o = gen(size);
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(
+      co_await compression::compressor::compress_async(o, t));
+    perf_tests::stop_measuring_time();
+}
+
+inline ss::future<> uncompressor_async_test(model::compression t, size_t size) {
+    auto o = compression::compressor::compress(gen(size), t);
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(
+      co_await compression::compressor::uncompress_async(o, t));
+    perf_tests::stop_measuring_time();
+}
+
+#define COMPRESSION_PERF_TESTS(codec, size_name, size)                         \
+    PERF_TEST(codec##_##size_name, compress) {                                 \
+        compressor_test(model::compression::codec, size);                      \
+    }                                                                          \
+    PERF_TEST(codec##_##size_name, uncompress) {                               \
+        uncompressor_test(model::compression::codec, size);                    \
+    }                                                                          \
+    PERF_TEST(codec##_##size_name, compress_async) {                           \
+        return compressor_async_test(model::compression::codec, size);         \
+    }                                                                          \
+    PERF_TEST(codec##_##size_name, uncompress_async) {                         \
+        return uncompressor_async_test(model::compression::codec, size);       \
+    }
+
+COMPRESSION_PERF_TESTS(gzip, 1mb, 1 << 20)
+COMPRESSION_PERF_TESTS(gzip, 10mb, 10 << 20)
+COMPRESSION_PERF_TESTS(snappy, 1mb, 1 << 20)
+COMPRESSION_PERF_TESTS(snappy, 10mb, 10 << 20)
+COMPRESSION_PERF_TESTS(lz4, 1mb, 1 << 20)
+COMPRESSION_PERF_TESTS(lz4, 10mb, 10 << 20)
+COMPRESSION_PERF_TESTS(zstd, 1mb, 1 << 20)
+COMPRESSION_PERF_TESTS(zstd, 10mb, 10 << 20)
@@ -19,6 +19,8 @@
 
 #include <seastar/testing/thread_test_case.hh>
 
+#include <zstd.h>
+
 static inline constexpr std::array<size_t, 16> sizes{{
   0,
   1,
@@ -105,3 +107,98 @@ SEASTAR_THREAD_TEST_CASE(gzip_test) {
     using fn = compression::internal::gzip_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
 }
+
+template<typename Codec>
+inline void roundtrip_async_compression() {
+    auto test_sizes = get_test_sizes();
+    // spans several chunks of the async codecs
+    test_sizes.push_back(3_MiB + 17);
+    for (size_t i : test_sizes) {
+        iobuf buf = gen(i);
+        auto cbuf = Codec::compress_async(buf).get();
+        BOOST_CHECK_EQUAL(Codec::uncompress(cbuf), buf);
+        BOOST_CHECK_EQUAL(Codec::uncompress_async(cbuf).get(), buf);
+        // reused contexts must not carry state from the previous call
+        BOOST_CHECK_EQUAL(
+          Codec::uncompress_async(Codec::compress(buf)).get(), buf);
+
+        // a single large fragment is split into chunks as well
+        ss::temporary_buffer<char> linear(i);
+        iobuf::iterator_consumer(buf.cbegin(), buf.cend())
+          .consume_to(i, linear.get_write());
+        iobuf single;
+        single.append(std::move(linear));
+        BOOST_CHECK_EQUAL(
+          Codec::uncompress_async(Codec::compress_async(single).get()).get(),
+          buf);
+    }
+}
+
+template<typename Codec>
+inline void async_output_limit() {
+    // highly compressible, the output is many times the input
+    const size_t size = 2_MiB;
+    iobuf buf;
+    buf.append(ss::sstring(size, 'a').data(), size);
+    auto cbuf = Codec::compress_async(buf).get();
+    BOOST_CHECK_EQUAL(Codec::uncompress_async(cbuf, size).get(), buf);
+    BOOST_CHECK_THROW(
+      Codec::uncompress_async(cbuf, size - 1).get(),
+      compression::output_limit_exceeded);
+    BOOST_CHECK_THROW(
+      Codec::uncompress_async(cbuf, 64_KiB).get(),
+      compression::output_limit_exceeded);
+}
+
+SEASTAR_THREAD_TEST_CASE(async_output_limit_test) {
+    async_output_limit<compression::internal::lz4_frame_compressor>();
+    async_output_limit<compression::internal::snappy_java_compressor>();
+    async_output_limit<compression::internal::zstd_compressor>();
+    async_output_limit<compression::internal::gzip_compressor>();
+}
+
+SEASTAR_THREAD_TEST_CASE(lz4_async_test) {
+    roundtrip_async_compression<compression::internal::lz4_frame_compressor>();
+}
+SEASTAR_THREAD_TEST_CASE(snappy_java_async_test) {
+    roundtrip_async_compression<
+      compression::internal::snappy_java_compressor>();
+}
+SEASTAR_THREAD_TEST_CASE(zstd_async_test) {
+    roundtrip_async_compression<compression::internal::zstd_compressor>();
+}
+SEASTAR_THREAD_TEST_CASE(gzip_async_test) {
+    roundtrip_async_compression<compression::internal::gzip_compressor>();
+}
+
+SEASTAR_THREAD_TEST_CASE(zstd_async_window_bounded_test) {
+    // a frame with a window larger than the one of the decompression
+    // workspace, which the async path must refuse to allocate as well
+    const size_t size = 4_MiB;
+    iobuf buf = gen(size);
+    ss::temporary_buffer<char> input(size);
+    iobuf::iterator_consumer(buf.cbegin(), buf.cend())
+      .consume_to(size, input.get_write());
+    compression::stream_zstd::zstd_compress_ctx ctx(ZSTD_createCCtx());
+    BOOST_REQUIRE(ctx);
+    BOOST_REQUIRE(!ZSTD_isError(
+      ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_windowLog, 23)));
+    ss::temporary_buffer<char> out(ZSTD_compressBound(input.size()));
+    auto n = ZSTD_compress2(
+      ctx.get(), out.get_write(), out.size(), input.get(), input.size());
+    BOOST_REQUIRE(!ZSTD_isError(n));
+    out.trim(n);
+    iobuf compressed;
+    compressed.append(std::move(out));
+
+    BOOST_CHECK_THROW(
+      compression::stream_zstd::uncompress_async(compressed).get(),
+      std::exception);
+    // frames within the window are still decompressed
+    auto small = gen(64_KiB);
+    BOOST_CHECK_EQUAL(
+      compression::stream_zstd::uncompress_async(
+        compression::stream_zstd::compress_async(small).get())
+        .get(),
+      small);
+}
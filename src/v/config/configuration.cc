@@ -266,6 +266,81 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       std::nullopt,
       {.min = 1})
+  , kafka_user_produce_byte_rate(
+      *this,
+      "kafka_user_produce_byte_rate",
+      "Produce quota of every principal (bytes per second), shared by all of "
+      "its connections to the node",
+      {.needs_restart = needs_restart::no,
+       .example = "10485760",
+       .visibility = visibility::user},
+      std::nullopt,
+      {.min = 1_KiB})
+  , kafka_user_fetch_byte_rate(
+      *this,
+      "kafka_user_fetch_byte_rate",
+      "Fetch quota of every principal (bytes per second), shared by all of "
+      "its connections to the node",
+      {.needs_restart = needs_restart::no,
+       .example = "10485760",
+       .visibility = visibility::user},
+      std::nullopt,
+      {.min = 1_KiB})
+  , kafka_client_produce_byte_rate(
+      *this,
+      "kafka_client_produce_byte_rate",
+      "Produce quota of every client id (bytes per second), shared by all of "
+      "its connections to the node",
+      {.needs_restart = needs_restart::no,
+       .example = "10485760",
+       .visibility = visibility::user},
+      std::nullopt,
+      {.min = 1_KiB})
+  , kafka_client_fetch_byte_rate(
+      *this,
+      "kafka_client_fetch_byte_rate",
+      "Fetch quota of every client id (bytes per second), shared by all of "
+      "its connections to the node",
+      {.needs_restart = needs_restart::no,
+       .example = "10485760",
+       .visibility = visibility::user},
+      std::nullopt,
+      {.min = 1_KiB})
+  , kafka_tenant_groups(
+      *this,
+      "kafka_tenant_groups",
+      "Names of the scheduling groups for the Kafka requests of tenants. Every "
+      "group gets a cpu scheduling group and an io priority class for reads. "
+      "Groups are created on startup, as many as there are scheduling groups "
+      "left",
+      {.needs_restart = needs_restart::yes,
+       .example = R"(['analytics', 'ingest'])",
+       .visibility = visibility::user},
+      {},
+      validate_kafka_tenant_groups)
+  , kafka_tenant_group_shares(
+      *this,
+      "kafka_tenant_group_shares",
+      "Shares of kafka_tenant_groups, as '<name>:<shares>' with shares in "
+      "[1, 1000]. A group without shares has the 1000 shares of the default "
+      "kafka group",
+      {.needs_restart = needs_restart::no,
+       .example = R"(['analytics:200', 'ingest:1000'])",
+       .visibility = visibility::user},
+      {},
+      validate_kafka_tenant_group_shares)
+  , kafka_tenant_group_mapping(
+      *this,
+      "kafka_tenant_group_mapping",
+      "Assigns the Kafka connections of a principal or of a listener to one "
+      "of kafka_tenant_groups, as '<group>:principal:<name>' or "
+      "'<group>:listener:<name>'. The principal takes precedence. Applies to "
+      "new connections",
+      {.needs_restart = needs_restart::no,
+       .example = R"(['analytics:principal:etl', 'ingest:listener:internal'])",
+       .visibility = visibility::user},
+      {},
+      validate_kafka_tenant_group_mapping)
   , cluster_id(
       *this,
       "cluster_id",
@@ -326,6 +401,14 @@ configuration::configuration()
       "Timeout for new member joins",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30'000ms)
+  , group_offset_commit_batch_window_ms(
+      *this,
+      "group_offset_commit_batch_window_ms",
+      "Offset commits to the same group coordinator partition that arrive "
+      "within this window are replicated together in a single batch. With 0 "
+      "only the commits that arrive before the next poll are merged",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      0ms)
   , metadata_dissemination_interval_ms(
       *this,
       "metadata_dissemination_interval_ms",
@@ -372,6 +455,13 @@ configuration::configuration()
       "Minimum size of the seq table non affected by compaction",
       {.visibility = visibility::user},
       1000)
+  , seq_table_max_in_memory(
+      *this,
+      "seq_table_max_in_memory",
+      "Maximum number of the idempotent producers of a partition kept in "
+      "memory, the least recently used ones are spilled to disk",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      10000)
   , tx_timeout_delay_ms(
       *this,
       "tx_timeout_delay_ms",
@@ -845,6 +935,15 @@ configuration::configuration()
       "Interval between iterations of controller backend housekeeping loop",
       {.visibility = visibility::tunable},
       1s)
+  , controller_backend_background_bootstrap(
+      *this,
+      "controller_backend_background_bootstrap",
+      "During startup wait only for partitions of internal topics to be "
+      "recovered before starting the APIs, partitions of other topics are "
+      "recovered in the background. The node reports itself ready once all "
+      "partitions are recovered",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      true)
   , node_management_operation_timeout_ms(
       *this,
       "node_management_operation_timeout_ms",
@@ -864,6 +963,15 @@ configuration::configuration()
       "limit applies to compressed batch size",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1_MiB)
+  , kafka_batch_recompression_max_bytes(
+      *this,
+      "kafka_batch_recompression_max_bytes",
+      "Produced batches up to this uncompressed size are converted to the "
+      "compression type of the topic before they are written. Batches of "
+      "topics with the 'producer' compression type are never converted. "
+      "Disabled if not set",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , compaction_ctrl_update_interval_ms(
       *this,
       "compaction_ctrl_update_interval_ms",
@@ -1049,6 +1157,13 @@ configuration::configuration()
       "connections used for both uploads and downloads)",
       {.visibility = visibility::user},
       20)
+  , cloud_storage_max_concurrent_recovery_downloads(
+      *this,
+      "cloud_storage_max_concurrent_recovery_downloads",
+      "Max number of log segments downloaded simultaneously per shard during "
+      "topic recovery (shared by all partitions being recovered)",
+      {.visibility = visibility::tunable},
+      5)
   , cloud_storage_disable_tls(
       *this,
       "cloud_storage_disable_tls",
@@ -1300,6 +1415,15 @@ configuration::configuration()
       "Number of partitions that can be reassigned at once",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       50)
+  , partition_autobalancing_core_imbalance_percent(
+      *this,
+      "partition_autobalancing_core_imbalance_percent",
+      "Excess of the load of a core over the average load of the cores of its "
+      "node that triggers moving partitions to the other cores of the node. "
+      "Null (the default) disables moving partitions between cores",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 1, .max = 1000})
   , enable_leader_balancer(
       *this,
       "enable_leader_balancer",
@@ -1331,6 +1455,28 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512,
       {.min = 1, .max = 2048})
+  , leader_balancer_mode(
+      *this,
+      "leader_balancer_mode",
+      "Leadership balancing strategy: greedy_balanced_shards balances the "
+      "number of leaders per shard, throughput_balanced_shards balances the "
+      "produce and fetch load of the leaders per shard",
+      {.needs_restart = needs_restart::no,
+       .example = "throughput_balanced_shards",
+       .visibility = visibility::user},
+      model::leader_balancer_mode::greedy_balanced_shards,
+      {
+        model::leader_balancer_mode::greedy_balanced_shards,
+        model::leader_balancer_mode::throughput_balanced_shards,
+      })
+  , leader_balancer_transfers_per_tick(
+      *this,
+      "leader_balancer_transfers_per_tick",
+      "Maximum number of leadership transfers started by a tick of the "
+      "throughput aware leadership balancer",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      32,
+      {.min = 1, .max = 2048})
   , internal_topic_replication_factor(
       *this,
       "internal_topic_replication_factor",
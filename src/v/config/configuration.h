@@ -84,6 +84,13 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> quota_manager_gc_sec;
     bounded_property<uint32_t> target_quota_byte_rate;
     bounded_property<std::optional<uint32_t>> kafka_admin_topic_api_rate;
+    bounded_property<std::optional<size_t>> kafka_user_produce_byte_rate;
+    bounded_property<std::optional<size_t>> kafka_user_fetch_byte_rate;
+    bounded_property<std::optional<size_t>> kafka_client_produce_byte_rate;
+    bounded_property<std::optional<size_t>> kafka_client_fetch_byte_rate;
+    property<std::vector<ss::sstring>> kafka_tenant_groups;
+    property<std::vector<ss::sstring>> kafka_tenant_group_shares;
+    property<std::vector<ss::sstring>> kafka_tenant_group_mapping;
     property<std::optional<ss::sstring>> cluster_id;
     property<bool> disable_metrics;
     property<bool> disable_public_metrics;
@@ -92,6 +99,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> group_max_session_timeout_ms;
     property<std::chrono::milliseconds> group_initial_rebalance_delay;
     property<std::chrono::milliseconds> group_new_member_join_timeout;
+    property<std::chrono::milliseconds> group_offset_commit_batch_window_ms;
     property<std::chrono::milliseconds> metadata_dissemination_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_retry_delay_ms;
     property<int16_t> metadata_dissemination_retries;
@@ -100,6 +108,7 @@ struct configuration final : public config_store {
       tm_violation_recovery_policy;
     property<std::chrono::milliseconds> rm_sync_timeout_ms;
     property<uint32_t> seq_table_min_size;
+    property<uint32_t> seq_table_max_in_memory;
     property<std::chrono::milliseconds> tx_timeout_delay_ms;
     enum_property<model::violation_recovery_policy>
       rm_violation_recovery_policy;
@@ -181,9 +190,11 @@ struct configuration final : public config_store {
       kafka_mtls_principal_mapping_rules;
     property<std::chrono::milliseconds>
       controller_backend_housekeeping_interval_ms;
+    property<bool> controller_backend_background_bootstrap;
     property<std::chrono::milliseconds> node_management_operation_timeout_ms;
     property<uint32_t> kafka_request_max_bytes;
     property<uint32_t> kafka_batch_max_bytes;
+    property<std::optional<uint32_t>> kafka_batch_recompression_max_bytes;
     // Compaction controller
     property<std::chrono::milliseconds> compaction_ctrl_update_interval_ms;
     property<double> compaction_ctrl_p_coeff;
@@ -217,6 +228,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds>
       cloud_storage_upload_loop_max_backoff_ms;
     property<int16_t> cloud_storage_max_connections;
+    property<int16_t> cloud_storage_max_concurrent_recovery_downloads;
     property<bool> cloud_storage_disable_tls;
     property<int16_t> cloud_storage_api_endpoint_port;
     property<std::optional<ss::sstring>> cloud_storage_trust_file;
@@ -277,12 +289,16 @@ struct configuration final : public config_store {
       partition_autobalancing_tick_interval_ms;
     property<size_t> partition_autobalancing_movement_batch_size_bytes;
     property<size_t> partition_autobalancing_concurrent_moves;
+    bounded_property<std::optional<uint32_t>>
+      partition_autobalancing_core_imbalance_percent;
 
     property<bool> enable_leader_balancer;
     property<std::chrono::milliseconds> leader_balancer_idle_timeout;
     property<std::chrono::milliseconds> leader_balancer_mute_timeout;
     property<std::chrono::milliseconds> leader_balancer_node_mute_timeout;
     bounded_property<size_t> leader_balancer_transfer_limit_per_shard;
+    enum_property<model::leader_balancer_mode> leader_balancer_mode;
+    bounded_property<size_t> leader_balancer_transfers_per_tick;
     property<int> internal_topic_replication_factor;
     property<std::chrono::milliseconds> health_manager_tick_interval;
 
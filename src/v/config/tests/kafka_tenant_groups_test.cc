@@ -0,0 +1,61 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/validators.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+SEASTAR_THREAD_TEST_CASE(parse_kafka_tenant_group_shares) {
+    auto group = config::parse_kafka_tenant_group_shares("analytics:200");
+    BOOST_REQUIRE(group);
+    BOOST_REQUIRE_EQUAL(group->first, "analytics");
+    BOOST_REQUIRE_EQUAL(group->second, 200);
+
+    BOOST_REQUIRE(!config::parse_kafka_tenant_group_shares("analytics"));
+    BOOST_REQUIRE(!config::parse_kafka_tenant_group_shares("analytics:"));
+    BOOST_REQUIRE(!config::parse_kafka_tenant_group_shares(":200"));
+    BOOST_REQUIRE(!config::parse_kafka_tenant_group_shares("analytics:0"));
+    BOOST_REQUIRE(!config::parse_kafka_tenant_group_shares("analytics:1001"));
+    BOOST_REQUIRE(!config::parse_kafka_tenant_group_shares("a b:100"));
+
+    BOOST_REQUIRE(
+      !config::validate_kafka_tenant_group_shares({"a:1", "b:1000"}));
+    BOOST_REQUIRE(config::validate_kafka_tenant_group_shares({"a:1", "a:10"}));
+}
+
+SEASTAR_THREAD_TEST_CASE(validate_kafka_tenant_groups) {
+    BOOST_REQUIRE(!config::validate_kafka_tenant_groups({}));
+    BOOST_REQUIRE(!config::validate_kafka_tenant_groups({"a", "b-1", "c_2"}));
+    BOOST_REQUIRE(config::validate_kafka_tenant_groups({"a", "a"}));
+    BOOST_REQUIRE(config::validate_kafka_tenant_groups({"a:1"}));
+    BOOST_REQUIRE(config::validate_kafka_tenant_groups({""}));
+}
+
+SEASTAR_THREAD_TEST_CASE(parse_kafka_tenant_rule) {
+    auto rule = config::parse_kafka_tenant_rule("analytics:principal:etl");
+    BOOST_REQUIRE(rule);
+    BOOST_REQUIRE_EQUAL(rule->group, "analytics");
+    BOOST_REQUIRE(rule->kind == config::kafka_tenant_kind::principal);
+    BOOST_REQUIRE_EQUAL(rule->name, "etl");
+
+    // the name may contain colons
+    rule = config::parse_kafka_tenant_rule("ingest:listener:a:b");
+    BOOST_REQUIRE(rule);
+    BOOST_REQUIRE(rule->kind == config::kafka_tenant_kind::listener);
+    BOOST_REQUIRE_EQUAL(rule->name, "a:b");
+
+    BOOST_REQUIRE(!config::parse_kafka_tenant_rule("ingest:listener:"));
+    BOOST_REQUIRE(!config::parse_kafka_tenant_rule("ingest:user:etl"));
+    BOOST_REQUIRE(!config::parse_kafka_tenant_rule(":principal:etl"));
+
+    BOOST_REQUIRE(config::validate_kafka_tenant_group_mapping(
+      {"a:principal:etl", "b:principal:etl"}));
+    BOOST_REQUIRE(!config::validate_kafka_tenant_group_mapping(
+      {"a:principal:etl", "b:listener:etl"}));
+}
@@ -13,9 +13,12 @@
 
 #include "net/inet_address_wrapper.h"
 
+#include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_set.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cctype>
 #include <optional>
 
 namespace config {
@@ -67,4 +70,118 @@ validate_connection_rate(const std::vector<ss::sstring>& ips_with_limit) {
     return std::nullopt;
 }
 
+bool is_valid_kafka_tenant_group_name(std::string_view name) {
+    auto valid_char = [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_'
+               || c == '-';
+    };
+    return !name.empty() && std::all_of(name.begin(), name.end(), valid_char);
+}
+
+std::optional<ss::sstring>
+validate_kafka_tenant_groups(const std::vector<ss::sstring>& names) {
+    absl::flat_hash_set<ss::sstring> seen;
+    for (const auto& name : names) {
+        if (!is_valid_kafka_tenant_group_name(name)) {
+            return fmt::format(
+              "Invalid kafka tenant group name {}, expected alphanumeric "
+              "characters, '_' or '-'",
+              name);
+        }
+        if (!seen.insert(name).second) {
+            return fmt::format("Duplicate kafka tenant group: {}", name);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<std::pair<ss::sstring, uint32_t>>
+parse_kafka_tenant_group_shares(const ss::sstring& raw_option) {
+    auto del_pos = raw_option.find(":");
+    if (
+      del_pos == 0 || del_pos == ss::sstring::npos
+      || del_pos == raw_option.size() - 1) {
+        return std::nullopt;
+    }
+
+    auto name = raw_option.substr(0, del_pos);
+    if (!is_valid_kafka_tenant_group_name(name)) {
+        return std::nullopt;
+    }
+
+    unsigned long shares = 0;
+    try {
+        shares = std::stoul(raw_option.substr(del_pos + 1));
+    } catch (...) {
+        return std::nullopt;
+    }
+    if (shares < 1 || shares > 1000) {
+        return std::nullopt;
+    }
+    return std::make_pair(name, static_cast<uint32_t>(shares));
+}
+
+std::optional<ss::sstring>
+validate_kafka_tenant_group_shares(const std::vector<ss::sstring>& shares) {
+    absl::flat_hash_set<ss::sstring> names;
+    for (const auto& group : shares) {
+        auto parsed = parse_kafka_tenant_group_shares(group);
+        if (!parsed) {
+            return fmt::format(
+              "Can not parse kafka tenant group shares {}, expected "
+              "<name>:<shares> with shares in [1, 1000]",
+              group);
+        }
+        if (!names.insert(parsed->first).second) {
+            return fmt::format(
+              "Duplicate kafka tenant group: {}", parsed->first);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<kafka_tenant_rule>
+parse_kafka_tenant_rule(const ss::sstring& raw_option) {
+    auto group_end = raw_option.find(":");
+    if (group_end == 0 || group_end == ss::sstring::npos) {
+        return std::nullopt;
+    }
+    auto kind_end = raw_option.find(":", group_end + 1);
+    if (kind_end == ss::sstring::npos || kind_end == raw_option.size() - 1) {
+        return std::nullopt;
+    }
+
+    kafka_tenant_rule rule;
+    rule.group = raw_option.substr(0, group_end);
+    auto kind = raw_option.substr(group_end + 1, kind_end - group_end - 1);
+    if (kind == "principal") {
+        rule.kind = kafka_tenant_kind::principal;
+    } else if (kind == "listener") {
+        rule.kind = kafka_tenant_kind::listener;
+    } else {
+        return std::nullopt;
+    }
+    rule.name = raw_option.substr(kind_end + 1);
+    return rule;
+}
+
+std::optional<ss::sstring>
+validate_kafka_tenant_group_mapping(const std::vector<ss::sstring>& rules) {
+    absl::flat_hash_set<std::pair<kafka_tenant_kind, ss::sstring>> tenants;
+    for (const auto& raw_rule : rules) {
+        auto rule = parse_kafka_tenant_rule(raw_rule);
+        if (!rule) {
+            return fmt::format(
+              "Can not parse kafka tenant group mapping {}, expected "
+              "<group>:principal:<name> or <group>:listener:<name>",
+              raw_rule);
+        }
+        if (!tenants.emplace(rule->kind, rule->name).second) {
+            return fmt::format(
+              "Duplicate kafka tenant group mapping for {}", rule->name);
+        }
+    }
+    return std::nullopt;
+}
+
 }; // namespace config
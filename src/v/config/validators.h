@@ -16,6 +16,7 @@
 #include <seastar/core/sstring.hh>
 
 #include <optional>
+#include <string_view>
 
 namespace config {
 
@@ -25,4 +26,36 @@ parse_connection_rate_override(const ss::sstring& raw_option);
 std::optional<ss::sstring>
 validate_connection_rate(const std::vector<ss::sstring>& ips_with_limit);
 
+// the name is a part of the names of the scheduling group, the io priority
+// class and of a metric label
+bool is_valid_kafka_tenant_group_name(std::string_view);
+
+// the number of groups is bounded by the scheduling groups left by redpanda,
+// which is only known on startup (see scheduling_groups)
+std::optional<ss::sstring>
+validate_kafka_tenant_groups(const std::vector<ss::sstring>& names);
+
+// <name>:<shares>
+std::optional<std::pair<ss::sstring, uint32_t>>
+parse_kafka_tenant_group_shares(const ss::sstring& raw_option);
+
+std::optional<ss::sstring>
+validate_kafka_tenant_group_shares(const std::vector<ss::sstring>& shares);
+
+enum class kafka_tenant_kind { principal, listener };
+
+struct kafka_tenant_rule {
+    ss::sstring group;
+    kafka_tenant_kind kind;
+    ss::sstring name;
+};
+
+// <group>:principal:<name> or <group>:listener:<name>, the name may contain
+// colons
+std::optional<kafka_tenant_rule>
+parse_kafka_tenant_rule(const ss::sstring& raw_option);
+
+std::optional<ss::sstring>
+validate_kafka_tenant_group_mapping(const std::vector<ss::sstring>& rules);
+
 }; // namespace config
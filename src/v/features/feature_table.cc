@@ -51,6 +51,12 @@ std::string_view to_string_view(feature f) {
         return "replication_factor_change";
     case feature::ephemeral_secrets:
         return "ephemeral_secrets";
+    case feature::incremental_health_reports:
+        return "incremental_health_reports";
+    case feature::rm_stm_spill_seqs:
+        return "rm_stm_spill_seqs";
+    case feature::tx_batched_markers:
+        return "tx_batched_markers";
     case feature::test_alpha:
         return "__test_alpha";
     }
@@ -79,7 +85,7 @@ std::string_view to_string_view(feature_state::state s) {
 
 // The version that this redpanda node will report: increment this
 // on protocol changes to raft0 structures, like adding new services.
-static constexpr cluster_version latest_version = cluster_version{7};
+static constexpr cluster_version latest_version = cluster_version{8};
 
 feature_table::feature_table() {
     // Intentionally undocumented environment variable, only for use
@@ -46,6 +46,9 @@ enum class feature : std::uint64_t {
     node_id_assignment = 0x1000,
     replication_factor_change = 0x2000,
     ephemeral_secrets = 0x4000,
+    incremental_health_reports = 0x8000,
+    rm_stm_spill_seqs = 0x10000,
+    tx_batched_markers = 0x20000,
 
     // Dummy features for testing only
     test_alpha = uint64_t(1) << 63,
@@ -188,6 +191,24 @@ constexpr static std::array feature_schema{
     feature::ephemeral_secrets,
     feature_spec::available_policy::always,
     feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster_version{8},
+    "incremental_health_reports",
+    feature::incremental_health_reports,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster_version{8},
+    "rm_stm_spill_seqs",
+    feature::rm_stm_spill_seqs,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster_version{8},
+    "tx_batched_markers",
+    feature::tx_batched_markers,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
   feature_spec{
     cluster_version{2001},
     "__test_alpha",
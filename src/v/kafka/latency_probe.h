@@ -18,6 +18,8 @@
 
 #include <seastar/core/metrics.hh>
 
+#include <chrono>
+
 namespace kafka {
 class latency_probe {
 public:
@@ -45,6 +47,15 @@ public:
              sm::description("Produce Latency"),
              labels,
              [this] { return _produce_latency.seastar_histogram_logform(); })
+             .aggregate(aggregate_labels),
+           sm::make_histogram(
+             "response_hol_blocking_us",
+             sm::description("Time a ready response waited for the responses "
+                             "to earlier requests on its connection"),
+             labels,
+             [this] {
+                 return _response_hol_blocking.seastar_histogram_logform();
+             })
              .aggregate(aggregate_labels)});
     }
 
@@ -84,9 +95,14 @@ public:
         return _fetch_latency.auto_measure();
     }
 
+    void record_response_hol_blocking(std::chrono::microseconds blocked) {
+        _response_hol_blocking.record(blocked.count());
+    }
+
 private:
     hdr_hist _produce_latency;
     hdr_hist _fetch_latency;
+    hdr_hist _response_hol_blocking;
     ss::metrics::metric_groups _metrics;
     ss::metrics::metric_groups _public_metrics{
       ssx::metrics::public_metrics_handle};
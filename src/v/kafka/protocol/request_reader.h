@@ -22,11 +22,14 @@
 
 #include <seastar/core/byteorder.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/core/temporary_buffer.hh>
 
 #include <fmt/format.h>
 
 #include <optional>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace kafka {
 
@@ -74,6 +77,44 @@ public:
         return {do_read_flex_string(n)};
     }
 
+    /*
+     * The string_view readers don't copy the string out of the request
+     * buffer, the returned views are valid for as long as the reader. A
+     * string that spans buffer fragments is linearized into memory owned by
+     * the reader.
+     */
+    std::string_view read_string_view() {
+        auto n = read_int16();
+        if (unlikely(n < 0)) {
+            throw std::out_of_range("Asked to read a negative byte string");
+        }
+        return do_read_string_view(n);
+    }
+
+    std::string_view read_flex_string_view() {
+        auto n = read_unsigned_varint();
+        if (unlikely(n == 0)) {
+            throw std::out_of_range("Asked to read a 0 byte flex string");
+        }
+        return do_read_string_view(n - 1);
+    }
+
+    std::optional<std::string_view> read_nullable_string_view() {
+        auto n = read_int16();
+        if (n < 0) {
+            return std::nullopt;
+        }
+        return do_read_string_view(n);
+    }
+
+    std::optional<std::string_view> read_nullable_flex_string_view() {
+        auto n = read_unsigned_varint();
+        if (n == 0) {
+            return std::nullopt;
+        }
+        return do_read_string_view(n - 1);
+    }
+
     uuid read_uuid() {
         return uuid(_parser.consume_type<uuid::underlying_t>());
     }
@@ -226,6 +267,35 @@ private:
         return _parser.read_string(n - 1);
     }
 
+    std::string_view do_read_string_view(size_t n) {
+        std::string_view view;
+        ss::temporary_buffer<char> linearized;
+        size_t copied = 0;
+        auto consumed = _parser.consume(
+          n, [&view, &linearized, &copied, n](const char* src, size_t max) {
+              if (max == n) {
+                  view = std::string_view(src, max);
+                  return ss::stop_iteration::no;
+              }
+              if (linearized.empty()) {
+                  linearized = ss::temporary_buffer<char>(n);
+              }
+              std::copy_n(src, max, linearized.get_write() + copied);
+              copied += max;
+              return ss::stop_iteration::no;
+          });
+        if (unlikely(consumed != n)) {
+            throw std::out_of_range(fmt::format(
+              "Asked to read a string of {} bytes, {} left", n, consumed));
+        }
+        if (!linearized.empty()) {
+            view = std::string_view(linearized.get(), linearized.size());
+            _linearized.push_back(std::move(linearized));
+        }
+        validate_utf8(view);
+        return view;
+    }
+
     template<
       typename ElementParser,
       typename T = std::invoke_result_t<ElementParser, request_reader&>>
@@ -245,6 +315,8 @@ private:
     }
 
     iobuf_parser _parser;
+    // strings read as views that spanned buffer fragments
+    std::vector<ss::temporary_buffer<char>> _linearized;
 };
 
 ss::future<std::optional<size_t>> parse_size(ss::input_stream<char>&);
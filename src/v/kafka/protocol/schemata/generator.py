@@ -56,6 +56,15 @@ import enum
 # control how the types in a kafka message schema translate to redpanda types.
 # the mappings are in order of preference. that is, a match in path_type_map
 # will override a match in the entity_type_map.
+#
+# Decoding into views
+# -------------------
+#
+# strings mapped to the string_view type (e.g. a topic name mapped to
+# model::topic_view) are decoded without copying them out of the request
+# buffer. the decoded struct then refers to the request_reader it was decoded
+# from and must not outlive it. this is meant for the fields of requests that
+# the handlers only look up, an owned copy is made where the value is kept.
 
 # nested dictionary path within a json document
 path_type_map = {
@@ -279,6 +288,11 @@ path_type_map = {
             }
         }
     },
+    "MetadataRequestData": {
+        "Topics": {
+            "Name": ("model::topic_view", "string_view"),
+        }
+    },
     "OffsetForLeaderEpochResponseData": {
         "Topics": {
             "Partitions": {
@@ -312,6 +326,9 @@ field_name_type_map = {
 basic_type_map = dict(
     string=("ss::sstring", "read_string()", "read_nullable_string()",
             "read_flex_string()", "read_nullable_flex_string()"),
+    string_view=("std::string_view", "read_string_view()",
+                 "read_nullable_string_view()", "read_flex_string_view()",
+                 "read_nullable_flex_string_view()"),
     bytes=("bytes", "read_bytes()", None, "read_flex_bytes()", None),
     bool=("bool", "read_bool()"),
     int8=("int8_t", "read_int8()"),
@@ -1379,7 +1396,8 @@ std::ostream& operator<<(std::ostream& o, const {{ struct.name }}&) {
 # remove scalar type `iobuf` from the set of types used to validate schema. the
 # type is not a native kafka type, but is still represented in the code
 # generator for some scenarios involving overloads / customizing output.
-ALLOWED_SCALAR_TYPES = list(set(SCALAR_TYPES) - set(["iobuf"]))
+ALLOWED_SCALAR_TYPES = list(
+    set(SCALAR_TYPES) - set(["iobuf", "string_view"]))
 ALLOWED_TYPES = \
     ALLOWED_SCALAR_TYPES + \
     [f"[]{t}" for t in ALLOWED_SCALAR_TYPES + STRUCT_TYPES] + TAGGED_WITH_FIELDS
@@ -226,3 +226,43 @@ SEASTAR_THREAD_TEST_CASE(serde_flex_types) {
         BOOST_CHECK_EQUAL(iobuf_to_bytes(*result), iobuf_to_bytes(copy));
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(string_views) {
+    std::vector<ss::sstring> strings;
+    iobuf buf;
+    kafka::response_writer writer(buf);
+    for (int i = 0; i < 50; ++i) {
+        strings.push_back(random_generators::gen_alphanum_string(i));
+        writer.write(strings.back());
+        writer.write_flex(strings.back());
+    }
+    writer.write(std::optional<std::string_view>());
+    writer.write_flex(std::optional<std::string_view>());
+
+    /// Split the buffer into 7 byte fragments, so that some of the strings
+    /// span fragments and have to be linearized
+    auto serialized = iobuf_to_bytes(buf);
+    iobuf fragmented;
+    for (size_t i = 0; i < serialized.size(); i += 7) {
+        iobuf fragment;
+        fragment.append(
+          serialized.data() + i, std::min<size_t>(7, serialized.size() - i));
+        fragmented.append_fragments(std::move(fragment));
+    }
+
+    kafka::request_reader reader(std::move(fragmented));
+    std::vector<std::string_view> views;
+    for (int i = 0; i < 50; ++i) {
+        views.push_back(reader.read_string_view());
+        views.push_back(reader.read_flex_string_view());
+    }
+    BOOST_REQUIRE(!reader.read_nullable_string_view());
+    BOOST_REQUIRE(!reader.read_nullable_flex_string_view());
+    BOOST_REQUIRE_EQUAL(reader.bytes_left(), 0);
+
+    /// The views stay valid while the reader is alive
+    for (int i = 0; i < 50; ++i) {
+        BOOST_REQUIRE_EQUAL(views[2 * i], std::string_view(strings[i]));
+        BOOST_REQUIRE_EQUAL(views[2 * i + 1], std::string_view(strings[i]));
+    }
+}
@@ -123,11 +123,12 @@ void check_kafka_binary_format(
   api_key key, api_version version, is_kafka_request is_request) {
     decltype(T::data) r;
     auto result = invoke_franz_harness(key, version, is_request);
+    // fields decoded as views refer to the reader
+    kafka::request_reader rdr(bytes_to_iobuf(result));
     {
         if constexpr (HasPrimitiveDecode<decltype(r)>) {
             r.decode(bytes_to_iobuf(result), version);
         } else {
-            kafka::request_reader rdr(bytes_to_iobuf(result));
             r.decode(rdr, version);
         }
     }
@@ -0,0 +1,128 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/protocol/request_reader.h"
+#include "kafka/protocol/response_writer.h"
+#include "storage/record_batch_builder.h"
+#include "units.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+/*
+ * Decoding of the requests naming many topics and partitions. The allocs
+ * column of the results is the number of allocations per decoded request.
+ */
+
+namespace {
+
+constexpr int topic_count = 100;
+constexpr int partitions_per_topic = 10;
+
+// long enough to not fit the small string buffer
+model::topic make_topic_name(int i) {
+    return model::topic(fmt::format("decode-bench-topic-{:04}", i));
+}
+
+template<typename T>
+iobuf encode(T& request, kafka::api_version version) {
+    iobuf buf;
+    kafka::response_writer writer(buf);
+    request.encode(writer, version);
+    return buf;
+}
+
+iobuf make_metadata_request(kafka::api_version version) {
+    // the request refers to the names
+    std::vector<model::topic> names;
+    names.reserve(topic_count * partitions_per_topic);
+    kafka::metadata_request request;
+    request.data.topics.emplace();
+    for (int i = 0; i < topic_count * partitions_per_topic; ++i) {
+        names.push_back(make_topic_name(i));
+        request.data.topics->push_back(
+          kafka::metadata_request_topic{names.back()});
+    }
+    return encode(request, version);
+}
+
+iobuf make_produce_request(kafka::api_version version) {
+    std::vector<kafka::produce_request::topic> topics;
+    for (int t = 0; t < topic_count; ++t) {
+        kafka::produce_request::topic topic;
+        topic.name = make_topic_name(t);
+        for (int p = 0; p < partitions_per_topic; ++p) {
+            storage::record_batch_builder builder(
+              model::record_batch_type::raft_data, model::offset(0));
+            iobuf value;
+            value.append("value", 5);
+            builder.add_raw_kv(iobuf{}, std::move(value));
+
+            kafka::produce_request::partition partition;
+            partition.partition_index = model::partition_id(p);
+            partition.records.emplace(std::move(builder).build());
+            topic.partitions.push_back(std::move(partition));
+        }
+        topics.push_back(std::move(topic));
+    }
+    kafka::produce_request request(std::nullopt, -1, std::move(topics));
+    return encode(request, version);
+}
+
+iobuf make_fetch_request(kafka::api_version version) {
+    kafka::fetch_request request;
+    for (int t = 0; t < topic_count; ++t) {
+        kafka::fetch_request::topic topic{.name = make_topic_name(t)};
+        for (int p = 0; p < partitions_per_topic; ++p) {
+            topic.fetch_partitions.push_back(kafka::fetch_request::partition{
+              .partition_index = model::partition_id(p),
+              .fetch_offset = model::offset(p * 10),
+              .max_bytes = 1_MiB,
+            });
+        }
+        request.data.topics.push_back(std::move(topic));
+    }
+    return encode(request, version);
+}
+
+struct request_decode_fixture {
+    static constexpr auto metadata_version = kafka::api_version(7);
+    static constexpr auto produce_version = kafka::api_version(7);
+    static constexpr auto fetch_version = kafka::api_version(11);
+
+    iobuf metadata = make_metadata_request(metadata_version);
+    iobuf produce = make_produce_request(produce_version);
+    iobuf fetch = make_fetch_request(fetch_version);
+
+    template<typename T>
+    void decode(iobuf& buf, kafka::api_version version) {
+        kafka::request_reader reader(buf.share(0, buf.size_bytes()));
+        T request;
+        perf_tests::start_measuring_time();
+        request.decode(reader, version);
+        perf_tests::do_not_optimize(request);
+        perf_tests::stop_measuring_time();
+    }
+};
+
+} // namespace
+
+PERF_TEST_F(request_decode_fixture, metadata) {
+    decode<kafka::metadata_request>(metadata, metadata_version);
+}
+
+PERF_TEST_F(request_decode_fixture, produce) {
+    decode<kafka::produce_request>(produce, produce_version);
+}
+
+PERF_TEST_F(request_decode_fixture, fetch) {
+    decode<kafka::fetch_request>(fetch, fetch_version);
+}
@@ -12,6 +12,8 @@
 
 #include "bytes/iobuf.h"
 #include "config/configuration.h"
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/produce.h"
 #include "kafka/protocol/sasl_authenticate.h"
 #include "kafka/server/handlers/handler_interface.h"
 #include "kafka/server/protocol.h"
@@ -29,6 +31,7 @@
 #include <seastar/core/scattered_message.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sleep.hh>
+#include <seastar/core/with_scheduling_group.hh>
 #include <seastar/core/with_timeout.hh>
 
 #include <chrono>
@@ -38,6 +41,25 @@ using namespace std::chrono_literals;
 
 namespace kafka {
 
+connection_context::~connection_context() noexcept {
+    if (_response_stats.blocked_responses > 0) {
+        vlog(
+          klog.debug,
+          "{}:{} sent {} responses in {} writes, {} blocked by earlier "
+          "responses for {}us (max {}us)",
+          client_host(),
+          client_port(),
+          _response_stats.responses,
+          _response_stats.writes,
+          _response_stats.blocked_responses,
+          _response_stats.blocked_time.count(),
+          _response_stats.max_blocked_time.count());
+    }
+    if (_tenant) {
+        --_tenant->connections;
+    }
+}
+
 ss::future<> connection_context::process_one_request() {
     return parse_size(_rs.conn->input())
       .then([this](std::optional<size_t> sz) mutable {
@@ -193,6 +215,19 @@ bool connection_context::is_finished_parsing() const {
     return _rs.conn->input().eof() || _rs.abort_requested();
 }
 
+std::optional<quota_manager::byte_quota_type>
+connection_context::byte_quota_type_of(api_key key) {
+    using type = quota_manager::byte_quota_type;
+    auto& quotas = _proto.quota_mgr();
+    if (key == produce_api::key && quotas.byte_quota_enabled(type::produce)) {
+        return type::produce;
+    }
+    if (key == fetch_api::key && quotas.byte_quota_enabled(type::fetch)) {
+        return type::fetch;
+    }
+    return std::nullopt;
+}
+
 ss::future<session_resources> connection_context::throttle_request(
   const request_header& hdr, size_t request_size) {
     // update the throughput tracker for this client using the
@@ -209,36 +244,50 @@ ss::future<session_resources> connection_context::throttle_request(
     auto delay = _proto.quota_mgr().record_tp_and_throttle(
       hdr.client_id, request_size);
     auto tracker = std::make_unique<request_tracker>(_rs.probe());
-    auto fut = ss::now();
+    const auto key = hdr.key;
+    auto track = track_latency(key);
+
+    // produce requests are charged their size before they are processed and
+    // fetch requests the size of their response once it is ready. both wait
+    // while the byte quotas of the principal or of the client are exceeded.
+    auto quota_type = byte_quota_type_of(key);
+    std::optional<quota_manager::byte_quota_owner> quota_owner;
+    if (quota_type) {
+        quota_owner = quota_manager::byte_quota_owner{
+          .principal = get_principal().name(),
+          .client_id = hdr.client_id
+                         ? std::make_optional<ss::sstring>(*hdr.client_id)
+                         : std::nullopt,
+        };
+    }
+
     if (!delay.first_violation) {
-        fut = ss::sleep_abortable(delay.duration, _rs.abort_source());
+        co_await ss::sleep_abortable(delay.duration, _rs.abort_source());
     }
-    auto track = track_latency(hdr.key);
-    return fut
-      .then([this, key = hdr.key, request_size] {
-          return reserve_request_units(key, request_size);
-      })
-      .then([this, delay, track, tracker = std::move(tracker)](
-              ssx::semaphore_units units) mutable {
-          return server().get_request_unit().then(
-            [this,
-             delay,
-             mem_units = std::move(units),
-             track,
-             tracker = std::move(tracker)](
-              ssx::semaphore_units qd_units) mutable {
-                session_resources r{
-                  .backpressure_delay = delay.duration,
-                  .memlocks = std::move(mem_units),
-                  .queue_units = std::move(qd_units),
-                  .tracker = std::move(tracker),
-                };
-                if (track) {
-                    r.method_latency = _rs.hist().auto_measure();
-                }
-                return r;
-            });
-      });
+    auto backpressure_delay = delay.duration;
+    if (quota_type) {
+        auto produced = *quota_type == quota_manager::byte_quota_type::produce
+                          ? request_size
+                          : 0;
+        backpressure_delay += co_await _proto.quota_mgr().throttle_bytes(
+          *quota_type, *quota_owner, produced, _rs.abort_source());
+    }
+
+    auto mem_units = co_await reserve_request_units(key, request_size);
+    auto qd_units = co_await server().get_request_unit();
+    session_resources r{
+      .backpressure_delay = backpressure_delay,
+      .memlocks = std::move(mem_units),
+      .queue_units = std::move(qd_units),
+      .tracker = std::move(tracker),
+    };
+    if (track) {
+        r.method_latency = _rs.hist().auto_measure();
+    }
+    if (quota_type == quota_manager::byte_quota_type::fetch) {
+        r.fetch_quota_owner = std::move(quota_owner);
+    }
+    co_return r;
 }
 
 ss::future<ssx::semaphore_units>
@@ -265,8 +314,41 @@ connection_context::reserve_request_units(api_key key, size_t size) {
     return fut;
 }
 
+void connection_context::maybe_assign_tenant_group() {
+    // the principal is known once the authentication completes
+    if (_tenant_assigned || (_sasl && !_sasl->complete())) {
+        return;
+    }
+    _tenant_assigned = true;
+    _tenant = _proto.tenant_groups().find(listener(), get_principal());
+    if (_tenant) {
+        ++_tenant->connections;
+        vlog(
+          klog.debug,
+          "Assigned connection {} to tenant group {}",
+          _rs.conn->addr,
+          _tenant->name);
+    }
+}
+
 ss::future<>
 connection_context::dispatch_method_once(request_header hdr, size_t size) {
+    maybe_assign_tenant_group();
+    if (!_tenant) {
+        return do_dispatch_method_once(std::move(hdr), size);
+    }
+    ++_tenant->requests;
+    _tenant->request_bytes += size;
+    // the continuations of the request, including the second stage and the
+    // work submitted to other cores, inherit the scheduling group
+    return ss::with_scheduling_group(
+      _tenant->sg, [this, hdr = std::move(hdr), size]() mutable {
+          return do_dispatch_method_once(std::move(hdr), size);
+      });
+}
+
+ss::future<>
+connection_context::do_dispatch_method_once(request_header hdr, size_t size) {
     return throttle_request(hdr, size).then([this, hdr = std::move(hdr), size](
                                               session_resources
                                                 sres_in) mutable {
@@ -362,9 +444,20 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
                                  sres = std::move(sres),
                                  seq,
                                  correlation](response_ptr r) mutable {
+                                    if (sres->fetch_quota_owner) {
+                                        _proto.quota_mgr().record_bytes(
+                                          quota_manager::byte_quota_type::fetch,
+                                          *sres->fetch_quota_owner,
+                                          r->buf().size_bytes());
+                                    }
                                     r->set_correlation(correlation);
                                     response_and_resources randr{
-                                      std::move(r), std::move(sres)};
+                                      .response = std::move(r),
+                                      .resources = std::move(sres),
+                                      .ready_at
+                                      = std::chrono::steady_clock::now(),
+                                      .blocked = seq != _next_response,
+                                    };
                                     _responses.insert({seq, std::move(randr)});
                                     return maybe_process_responses();
                                 });
@@ -423,33 +516,49 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
  */
 ss::future<> connection_context::maybe_process_responses() {
     return ss::repeat([this]() mutable {
-        auto it = _responses.find(_next_response);
-        if (it == _responses.end()) {
-            return ss::make_ready_future<ss::stop_iteration>(
-              ss::stop_iteration::yes);
-        }
-        // found one; increment counter
-        _next_response = _next_response + sequence_id(1);
+        const auto now = std::chrono::steady_clock::now();
+        response_batch batch(_response_stats);
+        std::vector<session_resources::pointer> resources;
+        while (true) {
+            auto it = _responses.find(_next_response);
+            if (it == _responses.end() || !batch.fits(*it->second.response)) {
+                break;
+            }
+            // found one; increment counter
+            _next_response = _next_response + sequence_id(1);
 
-        auto resp_and_res = std::move(it->second);
+            auto resp_and_res = std::move(it->second);
+            _responses.erase(it);
 
-        _responses.erase(it);
+            std::optional<std::chrono::microseconds> blocked;
+            if (resp_and_res.blocked) {
+                blocked = std::chrono::duration_cast<std::chrono::microseconds>(
+                  now - resp_and_res.ready_at);
+                _proto.probe().record_response_hol_blocking(*blocked);
+            }
+            batch.append(std::move(resp_and_res.response), blocked);
+            resources.push_back(std::move(resp_and_res.resources));
+        }
 
-        if (resp_and_res.response->is_noop()) {
+        if (resources.empty()) {
+            return ss::make_ready_future<ss::stop_iteration>(
+              ss::stop_iteration::yes);
+        }
+        if (batch.empty()) {
+            // only noop responses
             return ss::make_ready_future<ss::stop_iteration>(
               ss::stop_iteration::no);
         }
 
-        auto msg = response_as_scattered(std::move(resp_and_res.response));
         try {
-            return _rs.conn->write(std::move(msg))
+            return _rs.conn->write(std::move(batch).release())
               .then([] {
                   return ss::make_ready_future<ss::stop_iteration>(
                     ss::stop_iteration::no);
               })
               // release the resources only once it has been written to the
               // connection.
-              .finally([resources = std::move(resp_and_res.resources)] {});
+              .finally([resources = std::move(resources)] {});
         } catch (...) {
             vlog(
               klog.debug,
@@ -11,9 +11,13 @@
 #pragma once
 #include "config/property.h"
 #include "kafka/server/protocol.h"
+#include "kafka/server/quota_manager.h"
 #include "kafka/server/response.h"
+#include "kafka/server/response_batch.h"
+#include "kafka/server/tenant_groups.h"
 #include "kafka/types.h"
 #include "net/server.h"
+#include "resource_mgmt/io_priority.h"
 #include "seastarx.h"
 #include "security/acl.h"
 #include "security/mtls.h"
@@ -28,6 +32,8 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <chrono>
+#include <limits>
 #include <memory>
 
 namespace kafka {
@@ -79,6 +85,8 @@ struct session_resources {
     ssx::semaphore_units queue_units;
     std::unique_ptr<hdr_hist::measurement> method_latency;
     std::unique_ptr<request_tracker> tracker;
+    // set when the size of the response counts towards the fetch byte quotas
+    std::optional<quota_manager::byte_quota_owner> fetch_quota_owner;
 };
 
 class connection_context final
@@ -101,7 +109,7 @@ public:
       , _mtls_state(std::move(mtls_state))
       , _max_request_size(std::move(max_request_size)) {}
 
-    ~connection_context() noexcept = default;
+    ~connection_context() noexcept;
     connection_context(const connection_context&) = delete;
     connection_context(connection_context&&) = delete;
     connection_context& operator=(const connection_context&) = delete;
@@ -119,15 +127,6 @@ public:
             return true;
         }
 
-        auto get_principal = [this]() {
-            if (_mtls_state) {
-                return _mtls_state->principal();
-            } else if (_sasl) {
-                return _sasl->principal();
-            }
-            // anonymous user
-            return security::acl_principal{security::principal_type::user, {}};
-        };
         return authorized_user(get_principal(), operation, name, quiet);
     }
 
@@ -189,6 +188,10 @@ public:
 
     ss::future<> process_one_request();
     bool is_finished_parsing() const;
+    // io priority class of the partition reads of the connection
+    ss::io_priority_class io_priority() const {
+        return _tenant ? _tenant->io_priority : kafka_read_priority();
+    }
     ss::net::inet_address client_host() const { return _client_addr; }
     uint16_t client_port() const {
         return _rs.conn ? _rs.conn->addr.port() : 0;
@@ -212,6 +215,10 @@ private:
     throttle_request(const request_header&, size_t sz);
 
     ss::future<> dispatch_method_once(request_header, size_t sz);
+    ss::future<> do_dispatch_method_once(request_header, size_t sz);
+
+    // assigns the connection to its tenant group once it is authenticated
+    void maybe_assign_tenant_group();
 
     /**
      * Process zero or more ready responses in request order.
@@ -223,6 +230,9 @@ private:
      * which are not yet ready: they will be processed by a future
      * invocation.
      *
+     * The in-order responses that are ready are written together, as a single
+     * scattered message.
+     *
      * @return ss::future<> a future which as described above.
      */
     ss::future<> maybe_process_responses();
@@ -237,8 +247,24 @@ private:
     struct response_and_resources {
         response_ptr response;
         session_resources::pointer resources;
+        std::chrono::steady_clock::time_point ready_at;
+        // a response to an earlier request wasn't ready yet
+        bool blocked{false};
     };
 
+    security::acl_principal get_principal() {
+        if (_mtls_state) {
+            return _mtls_state->principal();
+        } else if (_sasl && _sasl->has_mechanism()) {
+            return _sasl->principal();
+        }
+        // anonymous user
+        return security::acl_principal{security::principal_type::user, {}};
+    }
+
+    // the byte quotas the request counts towards, if any are configured
+    std::optional<quota_manager::byte_quota_type> byte_quota_type_of(api_key);
+
     using sequence_id = named_type<uint64_t, struct kafka_protocol_sequence>;
     using map_t = absl::flat_hash_map<sequence_id, response_and_resources>;
 
@@ -297,6 +323,9 @@ private:
     sequence_id _next_response;
     sequence_id _seq_idx;
     map_t _responses;
+    response_stats _response_stats;
+    tenant_groups::group* _tenant{nullptr};
+    bool _tenant_assigned{false};
     std::optional<security::sasl_server> _sasl;
     const ss::net::inet_address _client_addr;
     const bool _enable_authorizer;
@@ -19,8 +19,10 @@ class coordinator_ntp_mapper;
 class fetch_session_cache;
 class group_manager;
 class group_router;
+class metadata_response_cache;
 class quota_manager;
 class request_context;
+class tenant_groups;
 class rm_group_frontend;
 class rm_group_proxy_impl;
 
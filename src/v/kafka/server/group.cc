@@ -53,7 +53,8 @@ group::group(
   ss::lw_shared_ptr<cluster::partition> partition,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   group_metadata_serializer serializer,
-  enable_group_metrics group_metrics)
+  enable_group_metrics group_metrics,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher)
   : _id(std::move(id))
   , _state(s)
   , _state_timestamp(model::timestamp::now())
@@ -62,6 +63,7 @@ group::group(
   , _new_member_added(false)
   , _conf(conf)
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _recovery_policy(
       config::shard_local_cfg().rm_violation_recovery_policy.value())
@@ -86,12 +88,14 @@ group::group(
   ss::lw_shared_ptr<cluster::partition> partition,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   group_metadata_serializer serializer,
-  enable_group_metrics group_metrics)
+  enable_group_metrics group_metrics,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher)
   : _id(std::move(id))
   , _num_members_joining(0)
   , _new_member_added(false)
   , _conf(conf)
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _recovery_policy(
       config::shard_local_cfg().rm_violation_recovery_policy.value())
@@ -1606,8 +1610,17 @@ void group::complete_offset_commit(
     auto p_it = _pending_offset_commits.find(tp);
     if (p_it != _pending_offset_commits.end()) {
         // save the tp commit if it hasn't yet been seen, or we are completing
-        // for an instance that is newer based on log offset
-        try_upsert_offset(tp, md);
+        // for an instance that is newer based on log offset. commits that
+        // were coalesced into one batch share the log offset and complete in
+        // the order they were made, so the last one wins as it does on replay.
+        auto o_it = _offsets.find(tp);
+        if (
+          o_it != _offsets.end()
+          && o_it->second->metadata.log_offset == md.log_offset) {
+            o_it->second->metadata = md;
+        } else {
+            try_upsert_offset(tp, md);
+        }
 
         // clear pending for this tp
         if (p_it->second.offset == md.offset) {
@@ -1749,10 +1762,7 @@ group::begin_tx(cluster::begin_group_tx_request r) {
           r.pid,
           std::move(fence));
         auto reader = model::make_memory_record_batch_reader(std::move(batch));
-        auto e = co_await _partition->raft()->replicate(
-          _term,
-          std::move(reader),
-          raft::replicate_options(raft::consistency_level::quorum_ack));
+        auto e = co_await replicate_direct(std::move(reader));
 
         if (!e) {
             vlog(
@@ -1867,10 +1877,7 @@ group::prepare_tx(cluster::prepare_group_tx_request r) {
       std::move(tx_entry));
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
-    auto e = co_await _partition->raft()->replicate(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    auto e = co_await replicate_direct(std::move(reader));
 
     if (!e) {
         // Situation: replication has passed but the replicate method returns
@@ -2055,6 +2062,23 @@ kafka::error_code map_store_offset_error_code(std::error_code ec) {
 
 void group::update_store_offset_builder(
   cluster::simple_batch_builder& builder,
+  const model::topic& name,
+  model::partition_id partition,
+  model::offset committed_offset,
+  leader_epoch committed_leader_epoch,
+  const ss::sstring& metadata,
+  model::timestamp commit_timestamp) {
+    auto kv = offset_commit_kv(
+      name,
+      partition,
+      committed_offset,
+      committed_leader_epoch,
+      metadata,
+      commit_timestamp);
+    builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
+}
+
+group_metadata_serializer::key_value group::offset_commit_kv(
   const model::topic& name,
   model::partition_id partition,
   model::offset committed_offset,
@@ -2071,28 +2095,43 @@ void group::update_store_offset_builder(
       .commit_timestamp = commit_timestamp,
     };
 
-    auto kv = _md_serializer.to_kv(
+    return _md_serializer.to_kv(
       offset_metadata_kv{.key = std::move(key), .value = std::move(value)});
-    builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
 }
 
-group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
+raft::replicate_stages group::replicate_offset_commits(
+  std::vector<offset_commit_batcher::record> rs) {
+    if (_commit_batcher) {
+        return _commit_batcher->replicate(_term, std::move(rs));
+    }
     cluster::simple_batch_builder builder(
       model::record_batch_type::raft_data, model::offset(0));
+    for (auto& r : rs) {
+        builder.add_raw_kv(std::move(r.key), std::move(r.value));
+    }
+    return _partition->raft()->replicate_in_stages(
+      _term,
+      model::make_memory_record_batch_reader(std::move(builder).build()),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+}
+
+group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
+    std::vector<offset_commit_batcher::record> records;
 
     std::vector<std::pair<model::topic_partition, offset_metadata>>
       offset_commits;
 
     for (const auto& t : r.data.topics) {
         for (const auto& p : t.partitions) {
-            update_store_offset_builder(
-              builder,
+            auto kv = offset_commit_kv(
               t.name,
               p.partition_index,
               p.committed_offset,
               p.committed_leader_epoch,
               p.committed_metadata.value_or(""),
               model::timestamp(p.commit_timestamp));
+            records.push_back(offset_commit_batcher::record{
+              .key = std::move(kv.key), .value = std::move(*kv.value)});
 
             model::topic_partition tp(t.name, p.partition_index);
             offset_metadata md{
@@ -2109,13 +2148,7 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
         }
     }
 
-    auto batch = std::move(builder).build();
-    auto reader = model::make_memory_record_batch_reader(std::move(batch));
-
-    auto replicate_stages = _partition->raft()->replicate_in_stages(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    auto replicate_stages = replicate_offset_commits(std::move(records));
 
     auto f = replicate_stages.replicate_finished.then(
       [this, req = std::move(r), commits = std::move(offset_commits)](
@@ -2502,10 +2535,7 @@ ss::future<error_code> group::remove() {
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
     try {
-        auto result = co_await _partition->raft()->replicate(
-          _term,
-          std::move(reader),
-          raft::replicate_options(raft::consistency_level::quorum_ack));
+        auto result = co_await replicate_direct(std::move(reader));
         if (result) {
             vlog(
               klog.trace,
@@ -2583,10 +2613,7 @@ group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
     try {
-        auto result = co_await _partition->raft()->replicate(
-          _term,
-          std::move(reader),
-          raft::replicate_options(raft::consistency_level::quorum_ack));
+        auto result = co_await replicate_direct(std::move(reader));
         if (result) {
             vlog(
               klog.trace,
@@ -2611,9 +2638,19 @@ group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
 
 ss::future<result<raft::replicate_result>>
 group::store_group(model::record_batch batch) {
-    return _partition->raft()->replicate(
-      _term,
-      model::make_memory_record_batch_reader(std::move(batch)),
+    return replicate_direct(
+      model::make_memory_record_batch_reader(std::move(batch)));
+}
+
+ss::future<result<raft::replicate_result>>
+group::replicate_direct(model::record_batch_reader reader) {
+    auto term = _term;
+    if (_commit_batcher) {
+        co_await _commit_batcher->flush_enqueued();
+    }
+    co_return co_await _partition->raft()->replicate(
+      term,
+      std::move(reader),
       raft::replicate_options(raft::consistency_level::quorum_ack));
 }
 
@@ -2762,10 +2799,7 @@ ss::future<cluster::abort_group_tx_reply> group::do_abort(
       std::move(tx));
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
-    auto e = co_await _partition->raft()->replicate(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    auto e = co_await replicate_direct(std::move(reader));
 
     if (!e) {
         co_return make_abort_tx_reply(cluster::tx_errc::unknown_server_error);
@@ -2830,10 +2864,7 @@ group::do_commit(kafka::group_id group_id, model::producer_identity pid) {
 
     auto reader = model::make_memory_record_batch_reader(std::move(batches));
 
-    auto e = co_await _partition->raft()->replicate(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    auto e = co_await replicate_direct(std::move(reader));
 
     if (!e) {
         co_return make_commit_tx_reply(cluster::tx_errc::unknown_server_error);
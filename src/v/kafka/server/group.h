@@ -22,6 +22,7 @@
 #include "kafka/server/group_metadata.h"
 #include "kafka/server/logger.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -189,7 +190,8 @@ public:
       ss::lw_shared_ptr<cluster::partition> partition,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       group_metadata_serializer,
-      enable_group_metrics);
+      enable_group_metrics,
+      ss::lw_shared_ptr<offset_commit_batcher> = nullptr);
 
     // constructor used when loading state from log
     group(
@@ -199,7 +201,8 @@ public:
       ss::lw_shared_ptr<cluster::partition> partition,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       group_metadata_serializer,
-      enable_group_metrics);
+      enable_group_metrics,
+      ss::lw_shared_ptr<offset_commit_batcher> = nullptr);
 
     /// Get the group id.
     const kafka::group_id& id() const { return _id; }
@@ -761,6 +764,23 @@ private:
       const ss::sstring& metadata,
       model::timestamp commited_timestemp);
 
+    group_metadata_serializer::key_value offset_commit_kv(
+      const model::topic& name,
+      model::partition_id partition,
+      model::offset commited_offset,
+      leader_epoch commited_leader_epoch,
+      const ss::sstring& metadata,
+      model::timestamp commited_timestemp);
+
+    raft::replicate_stages
+      replicate_offset_commits(std::vector<offset_commit_batcher::record>);
+
+    // replicates records of the group which don't go through the offset
+    // commit batcher. offset commits queued before are enqueued in raft
+    // first, so that e.g. an offset tombstone lands after them.
+    ss::future<result<raft::replicate_result>>
+      replicate_direct(model::record_batch_reader);
+
     ss::future<cluster::abort_group_tx_reply> do_abort(
       kafka::group_id group_id,
       model::producer_identity pid,
@@ -798,6 +818,7 @@ private:
     bool _new_member_added;
     config::configuration& _conf;
     ss::lw_shared_ptr<cluster::partition> _partition;
+    ss::lw_shared_ptr<offset_commit_batcher> _commit_batcher;
     absl::node_hash_map<
       model::topic_partition,
       std::unique_ptr<offset_metadata_with_probe>>
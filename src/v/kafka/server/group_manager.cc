@@ -127,6 +127,9 @@ ss::future<> group_manager::stop() {
         for (auto& [_, group] : _groups) {
             co_await group->shutdown();
         }
+        for (auto& [_, p] : _partitions) {
+            co_await p->commit_batcher->stop();
+        }
         _partitions.clear();
     });
 }
@@ -157,12 +160,14 @@ void group_manager::detach_partition(const model::ntp& ntp) {
         _partitions.rehash(0);
 
         co_await shutdown_groups(std::move(groups_for_shutdown));
+        co_await p->commit_batcher->stop();
     });
 }
 
 void group_manager::attach_partition(ss::lw_shared_ptr<cluster::partition> p) {
     klog.debug("attaching group metadata partition {}", p->ntp());
-    auto attached = ss::make_lw_shared<attached_partition>(p);
+    auto attached = ss::make_lw_shared<attached_partition>(
+      p, _conf.group_offset_commit_batch_window_ms());
     auto res = _partitions.try_emplace(p->ntp(), attached);
     // TODO: this is not a forever assertion. this should just generally never
     // happen _now_ because we don't support partition migration / removal.
@@ -433,7 +438,8 @@ ss::future<> group_manager::recover_partition(
                   p->partition,
                   _tx_frontend,
                   _serializer_factory(),
-                  _enable_group_metrics);
+                  _enable_group_metrics,
+                  p->commit_batcher);
                 group->reset_tx_state(term);
                 _groups.emplace(group_id, group);
                 group->reschedule_all_member_heartbeats();
@@ -468,7 +474,8 @@ ss::future<> group_manager::recover_partition(
               p->partition,
               _tx_frontend,
               _serializer_factory(),
-              _enable_group_metrics);
+              _enable_group_metrics,
+              p->commit_batcher);
             group->reset_tx_state(term);
             _groups.emplace(group_id, group);
         }
@@ -567,7 +574,8 @@ group::join_group_stages group_manager::join_group(join_group_request&& r) {
           p,
           _tx_frontend,
           _serializer_factory(),
-          _enable_group_metrics);
+          _enable_group_metrics,
+          it->second->commit_batcher);
         group->reset_tx_state(it->second->term);
         _groups.emplace(r.data.group_id, group);
         _groups.rehash(0);
@@ -714,7 +722,8 @@ group_manager::txn_offset_commit(txn_offset_commit_request&& r) {
                 p->partition,
                 _tx_frontend,
                 _serializer_factory(),
-                _enable_group_metrics);
+                _enable_group_metrics,
+                p->commit_batcher);
               group->reset_tx_state(p->term);
               _groups.emplace(r.data.group_id, group);
               _groups.rehash(0);
@@ -799,7 +808,8 @@ group_manager::begin_tx(cluster::begin_group_tx_request&& r) {
                 p->partition,
                 _tx_frontend,
                 _serializer_factory(),
-                _enable_group_metrics);
+                _enable_group_metrics,
+                p->commit_batcher);
               group->reset_tx_state(p->term);
               _groups.emplace(r.group_id, group);
               _groups.rehash(0);
@@ -906,7 +916,8 @@ group_manager::offset_commit(offset_commit_request&& r) {
               p->partition,
               _tx_frontend,
               _serializer_factory(),
-              _enable_group_metrics);
+              _enable_group_metrics,
+              p->commit_batcher);
             group->reset_tx_state(p->term);
             _groups.emplace(r.data.group_id, group);
             _groups.rehash(0);
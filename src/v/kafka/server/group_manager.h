@@ -26,6 +26,7 @@
 #include "kafka/server/group_recovery_consumer.h"
 #include "kafka/server/group_stm.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
 #include "raft/group_manager.h"
@@ -203,10 +204,15 @@ private:
         ss::lw_shared_ptr<cluster::partition> partition;
         ss::basic_rwlock<> catchup_lock;
         model::term_id term{-1};
+        ss::lw_shared_ptr<offset_commit_batcher> commit_batcher;
 
-        explicit attached_partition(ss::lw_shared_ptr<cluster::partition> p)
+        attached_partition(
+          ss::lw_shared_ptr<cluster::partition> p,
+          std::chrono::milliseconds commit_window)
           : loading(true)
-          , partition(std::move(p)) {}
+          , partition(std::move(p))
+          , commit_batcher(ss::make_lw_shared<offset_commit_batcher>(
+              partition, commit_window)) {}
     };
 
     cluster::notification_id_type _leader_notify_handle;
@@ -84,7 +84,7 @@ static ss::future<read_result> read_from_partition(
       config.max_offset,
       0,
       config.max_bytes,
-      kafka_read_priority(),
+      config.io_priority,
       std::nullopt,
       std::nullopt,
       std::nullopt);
@@ -482,6 +482,7 @@ class simple_fetch_planner final : public fetch_planner::impl {
                 .strict_max_bytes = octx.response_size > 0,
                 .skip_read = bytes_left_in_plan == 0 && max_bytes == 0,
                 .current_leader_epoch = fp.current_leader_epoch,
+                .io_priority = octx.rctx.io_priority(),
               };
 
               plan.fetches_per_shard[*shard].push_back(
@@ -13,6 +13,7 @@
 #include "kafka/protocol/fetch.h"
 #include "kafka/server/handlers/handler.h"
 #include "kafka/types.h"
+#include "resource_mgmt/io_priority.h"
 #include "utils/intrusive_list_helpers.h"
 
 namespace kafka {
@@ -169,6 +170,7 @@ struct fetch_config {
     bool strict_max_bytes{false};
     bool skip_read{false};
     kafka::leader_epoch current_leader_epoch;
+    ss::io_priority_class io_priority{kafka_read_priority()};
 
     friend std::ostream& operator<<(std::ostream& o, const fetch_config& cfg) {
         fmt::print(
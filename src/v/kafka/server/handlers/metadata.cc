@@ -20,6 +20,8 @@
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_response_cache.h"
+#include "kafka/server/request_context.h"
 #include "kafka/server/response.h"
 #include "kafka/types.h"
 #include "likely.h"
@@ -209,9 +211,52 @@ static metadata_response::topic make_topic_response(
     return res;
 }
 
-static ss::future<std::vector<metadata_response::topic>>
+/**
+ * Encoded response topic of an existing topic, or std::nullopt if the topic
+ * doesn't exist. Served from the response cache unless the topic carries per
+ * request fields.
+ */
+static std::optional<iobuf> make_encoded_topic_response(
+  request_context& ctx,
+  metadata_request& rq,
+  model::topic_namespace_view tp_ns) {
+    const auto version = ctx.header().version;
+    if (!rq.data.include_topic_authorized_operations) {
+        return ctx.metadata_response_cache().get(tp_ns, version);
+    }
+    auto md = ctx.metadata_cache().get_topic_metadata(tp_ns);
+    if (!md) {
+        return std::nullopt;
+    }
+    auto res = make_topic_response(ctx, rq, std::move(*md));
+    return metadata_response_cache::encode(res, version);
+}
+
+/**
+ * The requested topics are decoded as views into the request, the name is
+ * copied only if it has to be kept.
+ */
+static std::optional<iobuf> make_encoded_topic_response(
+  request_context& ctx, metadata_request& rq, model::topic_view tp) {
+    if (!rq.data.include_topic_authorized_operations) {
+        return ctx.metadata_response_cache().get(tp, ctx.header().version);
+    }
+    model::topic topic(tp);
+    return make_encoded_topic_response(
+      ctx, rq, model::topic_namespace_view(model::kafka_namespace, topic));
+}
+
+static iobuf
+encode_topic_response(request_context& ctx, metadata_response::topic t) {
+    return metadata_response_cache::encode(t, ctx.header().version);
+}
+
+/**
+ * Returns the encoded topics of the response
+ */
+static ss::future<std::vector<iobuf>>
 get_topic_metadata(request_context& ctx, metadata_request& request) {
-    std::vector<metadata_response::topic> res;
+    std::vector<iobuf> res;
 
     // request can be served from whatever happens to be in the cache
     if (request.list_all_topics) {
@@ -232,11 +277,12 @@ get_topic_metadata(request_context& ctx, metadata_request& request) {
                   authz_quiet{true})) {
                 continue;
             }
-            res.push_back(make_topic_response(ctx, request, md.metadata));
+            if (auto t = make_encoded_topic_response(ctx, request, tp_ns); t) {
+                res.push_back(std::move(*t));
+            }
         }
 
-        return ss::make_ready_future<std::vector<metadata_response::topic>>(
-          std::move(res));
+        return ss::make_ready_future<std::vector<iobuf>>(std::move(res));
     }
 
     std::vector<ss::future<metadata_response::topic>> new_topics;
@@ -247,46 +293,104 @@ get_topic_metadata(request_context& ctx, metadata_request& request) {
          */
         if (!ctx.authorized(security::acl_operation::describe, topic.name)) {
             // not authorized, return authorization error
-            res.push_back(make_error_topic_response(
-              std::move(topic.name), error_code::topic_authorization_failed));
+            res.push_back(encode_topic_response(
+              ctx,
+              make_error_topic_response(
+                model::topic(topic.name),
+                error_code::topic_authorization_failed)));
             continue;
         }
-        if (auto md = ctx.metadata_cache().get_topic_metadata(
-              model::topic_namespace_view(model::kafka_namespace, topic.name));
-            md) {
-            auto src_topic_response = make_topic_response(
-              ctx, request, std::move(*md));
-            src_topic_response.name = std::move(topic.name);
-            res.push_back(std::move(src_topic_response));
+        if (auto t = make_encoded_topic_response(ctx, request, topic.name); t) {
+            res.push_back(std::move(*t));
             continue;
         }
 
         if (
           !config::shard_local_cfg().auto_create_topics_enabled
           || !request.data.allow_auto_topic_creation) {
-            res.push_back(make_error_topic_response(
-              std::move(topic.name), error_code::unknown_topic_or_partition));
+            res.push_back(encode_topic_response(
+              ctx,
+              make_error_topic_response(
+                model::topic(topic.name),
+                error_code::unknown_topic_or_partition)));
             continue;
         }
         /**
          * check if authorized to create
          */
         if (!ctx.authorized(security::acl_operation::create, topic.name)) {
-            res.push_back(make_error_topic_response(
-              std::move(topic.name), error_code::topic_authorization_failed));
+            res.push_back(encode_topic_response(
+              ctx,
+              make_error_topic_response(
+                model::topic(topic.name),
+                error_code::topic_authorization_failed)));
             continue;
         }
-        new_topics.push_back(create_topic(ctx, std::move(topic.name)));
+        new_topics.push_back(create_topic(ctx, model::topic(topic.name)));
     }
 
     return ss::when_all_succeed(new_topics.begin(), new_topics.end())
-      .then([res = std::move(res)](
+      .then([&ctx, res = std::move(res)](
               std::vector<metadata_response::topic> topics) mutable {
-          res.insert(res.end(), topics.begin(), topics.end());
-          return res;
+          for (auto& t : topics) {
+              res.push_back(encode_topic_response(ctx, std::move(t)));
+          }
+          return std::move(res);
       });
 }
 
+/**
+ * Metadata responses are assembled from encoded topics, most of them shared
+ * with the response cache, so the generated encoder isn't used. Only the non
+ * flexible versions are handled, as are all versions the handler supports.
+ */
+static response_ptr encode_response(
+  request_context& ctx, metadata_response& reply, std::vector<iobuf> topics) {
+    static_assert(
+      metadata_handler::max_supported() < 8,
+      "metadata response encoder doesn't handle flexible versions and "
+      "authorized operations");
+    const auto version = ctx.header().version;
+    vlog(
+      klog.trace,
+      "[{}:{}] sending {}:{} for {}, response {} with {} topics",
+      ctx.connection()->client_host(),
+      ctx.connection()->client_port(),
+      metadata_api::key,
+      metadata_api::name,
+      ctx.header().client_id,
+      reply,
+      topics.size());
+
+    auto resp = std::make_unique<response>(flex_enabled::no);
+    auto& writer = resp->writer();
+    if (version >= api_version(3)) {
+        writer.write(
+          std::max(reply.data.throttle_time_ms, ctx.throttle_delay_ms()));
+    }
+    writer.write_array(
+      reply.data.brokers,
+      [version](metadata_response::broker& b, response_writer& writer) {
+          writer.write(b.node_id);
+          writer.write(b.host);
+          writer.write(b.port);
+          if (version >= api_version(1)) {
+              writer.write(b.rack);
+          }
+      });
+    if (version >= api_version(2)) {
+        writer.write(reply.data.cluster_id);
+    }
+    if (version >= api_version(1)) {
+        writer.write(reply.data.controller_id);
+    }
+    writer.write(int32_t(topics.size()));
+    for (auto& t : topics) {
+        writer.write_direct(std::move(t));
+    }
+    return resp;
+}
+
 /**
  * During configuration changes, it may not be possible to identify
  * the correct listener on a broker based on our local listener's
@@ -412,17 +516,9 @@ ss::future<response_ptr> metadata_handler::handle(
     metadata_request request;
     request.decode(ctx.reader(), ctx.header().version);
 
-    reply.data.topics = co_await get_topic_metadata(ctx, request);
-
-    if (
-      request.data.include_cluster_authorized_operations
-      && ctx.authorized(
-        security::acl_operation::describe, security::default_cluster_name)) {
-        reply.data.cluster_authorized_operations = details::to_bit_field(
-          details::authorized_operations(ctx, security::default_cluster_name));
-    }
+    auto topics = co_await get_topic_metadata(ctx, request);
 
-    co_return co_await ctx.respond(std::move(reply));
+    co_return encode_response(ctx, reply, std::move(topics));
 }
 
 size_t
@@ -9,6 +9,8 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "cluster/fwd.h"
+#include "cluster/types.h"
 #include "kafka/protocol/metadata.h"
 #include "kafka/server/handlers/handler.h"
 
@@ -24,6 +26,10 @@ namespace kafka {
  */
 memory_estimate_fn metadata_memory_estimator;
 
+/// Build the response topic of an existing topic
+metadata_response::topic make_topic_response_from_topic_metadata(
+  const cluster::metadata_cache&, cluster::topic_metadata&&);
+
 using metadata_handler
   = single_stage_handler<metadata_api, 0, 7, metadata_memory_estimator>;
 
@@ -13,6 +13,7 @@
 #include "cluster/metadata_cache.h"
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
+#include "compression/compression.h"
 #include "config/configuration.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
@@ -26,6 +27,7 @@
 #include "raft/errc.h"
 #include "raft/types.h"
 #include "ssx/future-util.h"
+#include "storage/parser_utils.h"
 #include "utils/remote.h"
 #include "utils/to_string.h"
 #include "vlog.h"
@@ -34,11 +36,13 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/with_scheduling_group.hh>
 #include <seastar/util/log.hh>
 
 #include <boost/container_hash/extensions.hpp>
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <memory>
@@ -229,53 +233,109 @@ ss::future<produce_response::partition> finalize_request_with_error_code(
 }
 
 /**
- * \brief handle writing to a single topic partition.
+ * Codec that a produced batch is converted to before it is written, if
+ * broker-side recompression is enabled and applies to the batch.
  */
-static partition_produce_stages produce_topic_partition(
-  produce_ctx& octx,
-  produce_request::topic& topic,
-  produce_request::partition& part) {
-    auto ntp = model::ntp(
-      model::kafka_namespace, topic.name, part.partition_index);
-
-    /*
-     * A single produce request may contain record batches for many
-     * different partitions that are managed different cores.
-     */
-    auto shard = octx.rctx.shards().shard_for(ntp);
-
-    if (!shard) {
-        return make_ready_stage(produce_response::partition{
-          .partition_index = ntp.tp.partition,
-          .error_code = error_code::unknown_topic_or_partition});
+static std::optional<model::compression> recompression_target(
+  const model::record_batch& batch, model::compression topic_compression) {
+    const auto max_bytes
+      = config::shard_local_cfg().kafka_batch_recompression_max_bytes();
+    if (!max_bytes || topic_compression == model::compression::producer) {
+        return std::nullopt;
     }
+    const auto& hdr = batch.header();
+    // control batches are never compressed
+    if (
+      hdr.attrs.is_control() || hdr.attrs.compression() == topic_compression) {
+        return std::nullopt;
+    }
+    return topic_compression;
+}
 
-    // steal the batch from the adapter
-    auto batch = std::move(part.records->adapter.batch.value());
-
-    auto topic_cfg = octx.rctx.metadata_cache().get_topic_cfg(
-      model::topic_namespace_view(model::kafka_namespace, topic.name));
-
-    if (!topic_cfg) {
-        return make_ready_stage(produce_response::partition{
-          .partition_index = ntp.tp.partition,
-          .error_code = error_code::unknown_topic_or_partition});
+/**
+ * Convert a batch to another codec. The header of the original batch is kept,
+ * so offsets, timestamps and producer metadata are preserved. The size and the
+ * checksums are recomputed. Returns std::nullopt if the uncompressed batch is
+ * larger than kafka_batch_recompression_max_bytes, decompression stops at that
+ * limit, or if the converted batch is larger than batch_max_bytes.
+ */
+static ss::future<std::optional<model::record_batch>> recompress_batch(
+  const model::record_batch& batch,
+  model::compression target,
+  uint32_t batch_max_bytes) {
+    const auto max_bytes
+      = config::shard_local_cfg().kafka_batch_recompression_max_bytes();
+    std::optional<model::record_batch> converted;
+    if (!batch.compressed()) {
+        if (max_bytes && batch.size_bytes() > *max_bytes) {
+            co_return std::nullopt;
+        }
+        converted = co_await storage::internal::compress_batch(target, batch);
+    } else {
+        // the limit applies to the whole batch, header included
+        size_t max_records = compression::no_output_limit;
+        if (max_bytes) {
+            max_records = *max_bytes
+                          - std::min<size_t>(
+                            *max_bytes, model::packed_record_batch_header_size);
+        }
+        std::optional<model::record_batch> uncompressed;
+        try {
+            uncompressed = co_await storage::internal::decompress_batch(
+              batch, max_records);
+        } catch (const compression::output_limit_exceeded&) {
+            co_return std::nullopt;
+        }
+        if (target == model::compression::none) {
+            converted = std::move(uncompressed);
+        } else {
+            converted = co_await storage::internal::compress_batch(
+              target, std::move(*uncompressed));
+        }
     }
-    /*
-     * grab timestamp type topic configuration option out of the
-     * metadata cache. For append time setting we have to recalculate
-     * the CRC.
-     */
-    const auto timestamp_type = topic_cfg->properties.timestamp_type.value_or(
-      octx.rctx.metadata_cache().get_default_timestamp_type());
-    const auto batch_max_bytes = topic_cfg->properties.batch_max_bytes.value_or(
-      octx.rctx.metadata_cache().get_default_batch_max_bytes());
+    // the conversion may grow the batch, e.g. when it is decompressed for a
+    // topic without compression. a batch the producer sent within
+    // batch_max_bytes is then written as is instead of being rejected.
+    if (static_cast<uint32_t>(converted->size_bytes()) > batch_max_bytes) {
+        co_return std::nullopt;
+    }
+    co_return converted;
+}
 
-    if (timestamp_type == model::timestamp_type::append_time) {
-        batch.set_max_timestamp(
-          model::timestamp_type::append_time, model::timestamp::now());
+/**
+ * Recompress the batch if possible, otherwise the original batch is returned
+ * and written as the producer sent it.
+ */
+static ss::future<model::record_batch> maybe_recompress_batch(
+  model::record_batch batch,
+  model::compression target,
+  model::ntp ntp,
+  uint32_t batch_max_bytes) {
+    try {
+        auto converted = co_await recompress_batch(
+          batch, target, batch_max_bytes);
+        if (converted) {
+            co_return std::move(*converted);
+        }
+    } catch (...) {
+        vlog(
+          klog.warn,
+          "Unable to recompress batch for {}, it is written as is: {}",
+          ntp,
+          std::current_exception());
     }
+    co_return std::move(batch);
+}
 
+/**
+ * \brief dispatch a batch to the shard owning the partition.
+ */
+static partition_produce_stages dispatch_partition_batch(
+  produce_ctx& octx,
+  model::ntp ntp,
+  ss::shard_id shard,
+  model::record_batch batch,
+  uint32_t batch_max_bytes) {
     const auto& hdr = batch.header();
     auto bid = model::batch_identity::from(hdr);
     auto batch_size = batch.size_bytes();
@@ -289,7 +349,7 @@ static partition_produce_stages produce_topic_partition(
     auto f
       = octx.rctx.partition_manager()
           .invoke_on(
-            *shard,
+            shard,
             octx.ssg,
             [reader = std::move(reader),
              ntp = std::move(ntp),
@@ -382,6 +442,116 @@ static partition_produce_stages produce_topic_partition(
     };
 }
 
+/**
+ * \brief handle writing to a single topic partition.
+ */
+static partition_produce_stages produce_topic_partition(
+  produce_ctx& octx,
+  produce_request::topic& topic,
+  produce_request::partition& part) {
+    auto ntp = model::ntp(
+      model::kafka_namespace, topic.name, part.partition_index);
+
+    /*
+     * A single produce request may contain record batches for many
+     * different partitions that are managed different cores.
+     */
+    auto shard = octx.rctx.shards().shard_for(ntp);
+
+    if (!shard) {
+        return make_ready_stage(produce_response::partition{
+          .partition_index = ntp.tp.partition,
+          .error_code = error_code::unknown_topic_or_partition});
+    }
+
+    // steal the batch from the adapter
+    auto batch = std::move(part.records->adapter.batch.value());
+
+    auto topic_cfg = octx.rctx.metadata_cache().get_topic_cfg(
+      model::topic_namespace_view(model::kafka_namespace, topic.name));
+
+    if (!topic_cfg) {
+        return make_ready_stage(produce_response::partition{
+          .partition_index = ntp.tp.partition,
+          .error_code = error_code::unknown_topic_or_partition});
+    }
+    /*
+     * grab timestamp type topic configuration option out of the
+     * metadata cache. For append time setting we have to recalculate
+     * the CRC.
+     */
+    const auto timestamp_type = topic_cfg->properties.timestamp_type.value_or(
+      octx.rctx.metadata_cache().get_default_timestamp_type());
+    const auto batch_max_bytes = topic_cfg->properties.batch_max_bytes.value_or(
+      octx.rctx.metadata_cache().get_default_batch_max_bytes());
+
+    if (timestamp_type == model::timestamp_type::append_time) {
+        batch.set_max_timestamp(
+          model::timestamp_type::append_time, model::timestamp::now());
+    }
+
+    const auto topic_compression = topic_cfg->properties.compression.value_or(
+      octx.rctx.metadata_cache().get_default_compression());
+    auto target = recompression_target(batch, topic_compression);
+    if (!target) {
+        return dispatch_partition_batch(
+          octx, std::move(ntp), *shard, std::move(batch), batch_max_bytes);
+    }
+
+    /*
+     * transcoding is cpu intensive, so it runs in its own scheduling group.
+     * the partition is dispatched only after the batch has been converted,
+     * which keeps the order of batches within the connection.
+     */
+    auto dispatch = std::make_unique<ss::promise<>>();
+    auto dispatch_f = dispatch->get_future();
+    auto f = ss::with_scheduling_group(
+               octx.rctx.recompression_sg(),
+               [batch = std::move(batch),
+                target,
+                ntp,
+                batch_max_bytes]() mutable {
+                   return maybe_recompress_batch(
+                     std::move(batch),
+                     *target,
+                     std::move(ntp),
+                     batch_max_bytes);
+               })
+               .then_wrapped(
+                 [&octx,
+                  ntp = std::move(ntp),
+                  shard = *shard,
+                  batch_max_bytes,
+                  dispatch = std::move(dispatch)](
+                   ss::future<model::record_batch> f) mutable {
+                     if (f.failed()) {
+                         vlog(
+                           klog.warn,
+                           "Unable to recompress batch for {}: {}",
+                           ntp,
+                           f.get_exception());
+                         dispatch->set_value();
+                         return ss::make_ready_future<
+                           produce_response::partition>(
+                           produce_response::partition{
+                             .partition_index = ntp.tp.partition,
+                             .error_code = error_code::corrupt_message});
+                     }
+                     auto stages = dispatch_partition_batch(
+                       octx,
+                       std::move(ntp),
+                       shard,
+                       f.get0(),
+                       batch_max_bytes);
+                     stages.dispatched.forward_to(std::move(*dispatch));
+                     return std::move(stages.produced);
+                 });
+    return partition_produce_stages{
+      .dispatched = std::move(dispatch_f),
+      .produced = std::move(f),
+    };
+}
+
 /**
  * \brief Dispatch and collect topic partition produce responses
  */
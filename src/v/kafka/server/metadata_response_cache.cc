@@ -0,0 +1,167 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/metadata_response_cache.h"
+
+#include "cluster/metadata_cache.h"
+#include "kafka/protocol/response_writer.h"
+#include "kafka/server/handlers/metadata.h"
+
+#include <algorithm>
+
+namespace kafka {
+
+metadata_response_cache::metadata_response_cache(
+  cluster::metadata_cache& md_cache)
+  : _md_cache(md_cache) {
+    _topic_notification = _md_cache.register_topic_delta_notification(
+      [this](const std::vector<cluster::topic_table_delta>& deltas) {
+          for (const auto& d : deltas) {
+              invalidate(model::topic_namespace_view(d.ntp));
+          }
+      });
+    _leader_notification = _md_cache.register_leadership_change_notification(
+      [this](model::ntp ntp, model::term_id, std::optional<model::node_id>) {
+          invalidate(model::topic_namespace_view(ntp));
+      });
+}
+
+metadata_response_cache::~metadata_response_cache() {
+    _md_cache.unregister_topic_delta_notification(_topic_notification);
+    _md_cache.unregister_leadership_change_notification(_leader_notification);
+}
+
+void metadata_response_cache::invalidate(model::topic_namespace_view tp_ns) {
+    if (auto it = _topics.find(tp_ns); it != _topics.end()) {
+        _topics.erase(it);
+    }
+}
+
+std::optional<std::vector<metadata_response_cache::partition_leader>>
+metadata_response_cache::current_leaders(
+  model::topic_namespace_view tp_ns, const cluster::topic_metadata& md) const {
+    std::vector<partition_leader> leaders;
+    leaders.reserve(md.get_assignments().size());
+    for (const auto& p_as : md.get_assignments()) {
+        auto lt = _md_cache.get_leader_term(tp_ns, p_as.id);
+        if (!lt || !lt->leader) {
+            return std::nullopt;
+        }
+        leaders.push_back(partition_leader{
+          .id = p_as.id, .leader = *lt->leader, .term = lt->term});
+    }
+    return leaders;
+}
+
+bool metadata_response_cache::is_current(
+  model::topic_namespace_view tp_ns, const entry& e) const {
+    return std::all_of(
+      e.leaders.begin(),
+      e.leaders.end(),
+      [this, tp_ns](const partition_leader& pl) {
+          auto lt = _md_cache.get_leader_term(tp_ns, pl.id);
+          return lt && lt->leader == pl.leader && lt->term == pl.term;
+      });
+}
+
+std::optional<iobuf>
+metadata_response_cache::find(topics_t::iterator& it, api_version version) {
+    if (it == _topics.end()) {
+        return std::nullopt;
+    }
+    if (!is_current(model::topic_namespace_view(it->first), it->second)) {
+        _topics.erase(it);
+        it = _topics.end();
+        return std::nullopt;
+    }
+    if (auto& buf = it->second.encoded[version()]; buf) {
+        return buf->share(0, buf->size_bytes());
+    }
+    return std::nullopt;
+}
+
+std::optional<iobuf> metadata_response_cache::get(
+  model::topic_namespace_view tp_ns, api_version version) {
+    const bool cacheable = version <= max_cached_version;
+    auto it = _topics.find(tp_ns);
+    if (cacheable) {
+        if (auto buf = find(it, version); buf) {
+            return buf;
+        }
+    }
+
+    auto md = _md_cache.get_topic_metadata(tp_ns);
+    if (!md) {
+        return std::nullopt;
+    }
+    auto leaders = current_leaders(tp_ns, *md);
+    auto topic = make_topic_response_from_topic_metadata(
+      _md_cache, std::move(*md));
+    auto buf = encode(topic, version);
+    if (!cacheable || !leaders) {
+        return buf;
+    }
+    if (it == _topics.end()) {
+        it = _topics.emplace(model::topic_namespace(tp_ns), entry{}).first;
+    }
+    it->second.leaders = std::move(*leaders);
+    auto& cached = it->second.encoded[version()];
+    cached = std::move(buf);
+    return cached->share(0, cached->size_bytes());
+}
+
+std::optional<iobuf>
+metadata_response_cache::get(model::topic_view tp, api_version version) {
+    if (version <= max_cached_version) {
+        auto it = _topics.find(topic_key(model::kafka_namespace(), tp()));
+        if (auto buf = find(it, version); buf) {
+            return buf;
+        }
+    }
+    model::topic topic(tp);
+    return get(
+      model::topic_namespace_view(model::kafka_namespace, topic), version);
+}
+
+iobuf metadata_response_cache::encode(
+  metadata_response::topic& topic, api_version version) {
+    iobuf buf;
+    response_writer writer(buf);
+    writer.write(topic.error_code);
+    writer.write(topic.name);
+    if (version >= api_version(1)) {
+        writer.write(topic.is_internal);
+    }
+    writer.write_array(
+      topic.partitions,
+      [version](metadata_response::partition& p, response_writer& writer) {
+          writer.write(p.error_code);
+          writer.write(p.partition_index);
+          writer.write(p.leader_id);
+          if (version >= api_version(7)) {
+              writer.write(p.leader_epoch);
+          }
+          auto write_node = [](auto& n, response_writer& writer) {
+              writer.write(n);
+          };
+          writer.write_array(p.replica_nodes, write_node);
+          writer.write_array(p.isr_nodes, write_node);
+          if (version >= api_version(5)) {
+              writer.write_array(p.offline_replicas, write_node);
+          }
+      });
+    if (version >= api_version(8)) {
+        writer.write(topic.topic_authorized_operations);
+    }
+    return buf;
+}
+
+} // namespace kafka
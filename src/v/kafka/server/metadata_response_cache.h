@@ -0,0 +1,151 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cluster/fwd.h"
+#include "cluster/types.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/types.h"
+#include "model/metadata.h"
+
+#include <absl/container/node_hash_map.h>
+#include <absl/hash/hash.h>
+
+#include <array>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * \brief Per shard cache of encoded metadata response topics.
+ *
+ * Building and encoding the topics is most of the work done by a metadata
+ * request, and clients asking for all topics of a large cluster repeat it for
+ * every partition over and over again. The cache keeps the encoded topic
+ * entries of the response, keyed by topic and request version, and responses
+ * are assembled by sharing the cached fragments.
+ *
+ * The replica sets come from the topic table and the leaders from the
+ * partition leaders table, an entry is dropped whenever either of them
+ * changes for any partition of its topic. The leadership notifications are
+ * only sent when the leader node changes, so every entry also keeps the
+ * leader and term of its partitions and is dropped on lookup when any of them
+ * is no longer current: a new term of the same leader, a lost leader or
+ * reset leaders.
+ *
+ * Topics with a partition without a leader are never cached: the leader
+ * reported for such a partition is a guess (see get_leader_term) that may be
+ * a random replica, and a cached guess would be returned until the next
+ * leadership change instead of a new guess on every request.
+ */
+class metadata_response_cache {
+public:
+    /// Versions of the topic entry that are cached. Later versions contain
+    /// per request fields.
+    static constexpr api_version max_cached_version = api_version(7);
+
+    explicit metadata_response_cache(cluster::metadata_cache&);
+    ~metadata_response_cache();
+
+    metadata_response_cache(const metadata_response_cache&) = delete;
+    metadata_response_cache& operator=(const metadata_response_cache&) = delete;
+    metadata_response_cache(metadata_response_cache&&) = delete;
+    metadata_response_cache& operator=(metadata_response_cache&&) = delete;
+
+    /// Encoded response topic, or std::nullopt if the topic doesn't exist
+    std::optional<iobuf> get(model::topic_namespace_view, api_version);
+
+    /// Encoded response topic of the kafka namespace. The name is copied only
+    /// when the entry isn't cached, so topics decoded as views into the
+    /// request are looked up without allocating.
+    std::optional<iobuf> get(model::topic_view, api_version);
+
+    /// Encode a topic of a metadata response in the given version
+    static iobuf encode(metadata_response::topic&, api_version);
+
+    size_t size() const { return _topics.size(); }
+
+private:
+    using versions
+      = std::array<std::optional<iobuf>, max_cached_version() + 1>;
+
+    struct partition_leader {
+        model::partition_id id;
+        model::node_id leader;
+        model::term_id term;
+    };
+
+    struct entry {
+        // leaders the cached versions were encoded with
+        std::vector<partition_leader> leaders;
+        versions encoded;
+    };
+
+    // the entries are hashed by the views of the names so that they can be
+    // looked up by the owned names as well as by the views
+    struct topic_key {
+        topic_key(std::string_view ns, std::string_view tp)
+          : ns(ns)
+          , tp(tp) {}
+        topic_key(const model::topic_namespace& tp_ns) // NOLINT
+          : topic_key(tp_ns.ns(), tp_ns.tp()) {}
+        topic_key(model::topic_namespace_view tp_ns) // NOLINT
+          : topic_key(tp_ns.ns(), tp_ns.tp()) {}
+
+        bool operator==(const topic_key&) const = default;
+
+        std::string_view ns;
+        std::string_view tp;
+    };
+
+    struct topic_key_hash {
+        using is_transparent = void;
+
+        size_t operator()(topic_key k) const {
+            return absl::Hash<std::pair<std::string_view, std::string_view>>{}(
+              {k.ns, k.tp});
+        }
+    };
+
+    struct topic_key_eq {
+        using is_transparent = void;
+
+        bool operator()(topic_key lhs, topic_key rhs) const {
+            return lhs == rhs;
+        }
+    };
+
+    using topics_t = absl::node_hash_map<
+      model::topic_namespace,
+      entry,
+      topic_key_hash,
+      topic_key_eq>;
+
+    void invalidate(model::topic_namespace_view);
+    /// Leaders of the topic partitions, std::nullopt if any of them is not
+    /// known
+    std::optional<std::vector<partition_leader>> current_leaders(
+      model::topic_namespace_view, const cluster::topic_metadata&) const;
+    bool is_current(model::topic_namespace_view, const entry&) const;
+    /// Cached version of a valid entry, a stale entry is dropped
+    std::optional<iobuf> find(topics_t::iterator&, api_version);
+
+    cluster::metadata_cache& _md_cache;
+    cluster::notification_id_type _topic_notification;
+    cluster::notification_id_type _leader_notification;
+    topics_t _topics;
+};
+
+} // namespace kafka
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/offset_commit_batcher.h"
+
+#include "cluster/partition.h"
+#include "cluster/simple_batch_builder.h"
+#include "kafka/server/logger.h"
+#include "model/record_batch_reader.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+namespace kafka {
+
+offset_commit_batcher::offset_commit_batcher(
+  ss::lw_shared_ptr<cluster::partition> p, std::chrono::milliseconds window)
+  : _partition(std::move(p))
+  , _window(window) {
+    _timer.set_callback([this] { flush(); });
+}
+
+raft::replicate_stages offset_commit_batcher::replicate(
+  model::term_id term, std::vector<record> records) {
+    if (_gate.is_closed()) {
+        return raft::replicate_stages(raft::errc::shutting_down);
+    }
+    // a batch is replicated in the term of the commits it contains
+    if (_pending && _pending->term != term) {
+        flush();
+    }
+    if (!_pending) {
+        _pending = std::make_unique<pending_batch>(term);
+        _timer.arm(_window);
+    }
+
+    for (auto& r : records) {
+        _pending->size_bytes += r.key.size_bytes() + r.value.size_bytes();
+        auto [it, inserted] = _pending->index.try_emplace(
+          iobuf_to_bytes(r.key), _pending->records.size());
+        if (inserted) {
+            _pending->records.push_back(std::move(r));
+        } else {
+            // last write wins
+            _pending->records[it->second] = std::move(r);
+        }
+    }
+
+    auto f = _pending->done.get_shared_future();
+    if (_pending->size_bytes >= max_batch_bytes) {
+        flush();
+    }
+    return raft::replicate_stages(ss::now(), std::move(f));
+}
+
+void offset_commit_batcher::flush() {
+    _timer.cancel();
+    if (!_pending) {
+        return;
+    }
+    auto pending = std::exchange(_pending, nullptr);
+
+    cluster::simple_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    for (auto& r : pending->records) {
+        builder.add_raw_kv(std::move(r.key), std::move(r.value));
+    }
+    vlog(
+      klog.trace,
+      "Replicating {} coalesced offset commit records on {}",
+      pending->records.size(),
+      _partition->ntp());
+
+    auto stages = _partition->raft()->replicate_in_stages(
+      pending->term,
+      model::make_memory_record_batch_reader(std::move(builder).build()),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+
+    ss::promise<> enqueued;
+    _enqueued = ss::shared_future<>(_enqueued.get_future().then(
+      [f = enqueued.get_future()]() mutable { return std::move(f); }));
+
+    ssx::spawn_with_gate(
+      _gate,
+      [stages = std::move(stages),
+       pending = std::move(pending),
+       enqueued = std::move(enqueued)]() mutable {
+          // a failure to enqueue is also reported by replicate_finished
+          return std::move(stages.request_enqueued)
+            .handle_exception([](const std::exception_ptr&) {})
+            .then([enqueued = std::move(enqueued)]() mutable {
+                enqueued.set_value();
+            })
+            .then([f = std::move(stages.replicate_finished)]() mutable {
+                return std::move(f);
+            })
+            .then_wrapped([pending = std::move(pending)](
+                            ss::future<result<raft::replicate_result>> f) {
+                if (f.failed()) {
+                    pending->done.set_exception(f.get_exception());
+                } else {
+                    pending->done.set_value(f.get0());
+                }
+            });
+      });
+}
+
+ss::future<> offset_commit_batcher::flush_enqueued() {
+    flush();
+    return _enqueued.get_future();
+}
+
+ss::future<> offset_commit_batcher::stop() {
+    flush();
+    return _gate.close();
+}
+
+} // namespace kafka
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "cluster/fwd.h"
+#include "model/fundamental.h"
+#include "raft/types.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace kafka {
+
+/*
+ * \brief Coalesces offset commits of the groups coordinated by a partition.
+ *
+ * Every OffsetCommit request results in a handful of small records. Instead of
+ * replicating them one request at a time, the records of all the commits that
+ * arrive within `window` are merged into a single record batch. A record whose
+ * key is already queued replaces the queued one, so the batch holds the last
+ * write of every key.
+ *
+ * The order of the commits is fixed once they are queued: batches are handed
+ * to raft in the order in which they were opened. For this reason the
+ * `request_enqueued` stage of a queued commit is ready immediately, while
+ * `replicate_finished` resolves with the result of the whole batch. Records
+ * replicated to the partition without the batcher must be ordered after the
+ * commits queued before them, see `flush_enqueued()`.
+ */
+class offset_commit_batcher {
+public:
+    struct record {
+        iobuf key;
+        iobuf value;
+    };
+
+    /// Flush the pending batch early when it grows beyond this size
+    static constexpr size_t max_batch_bytes = 512_KiB;
+
+    offset_commit_batcher(
+      ss::lw_shared_ptr<cluster::partition>, std::chrono::milliseconds window);
+
+    /// Queue the records of one offset commit made in `term`
+    raft::replicate_stages replicate(model::term_id, std::vector<record>);
+
+    /// Hands the pending commits to raft. Resolves once all the commits
+    /// queued so far are enqueued in raft, records replicated after that are
+    /// ordered after them.
+    ss::future<> flush_enqueued();
+
+    /// Replicates any pending commits and waits for them to finish
+    ss::future<> stop();
+
+private:
+    struct pending_batch {
+        explicit pending_batch(model::term_id t)
+          : term(t) {}
+
+        model::term_id term;
+        std::vector<record> records;
+        // serialized key -> index in records
+        absl::flat_hash_map<bytes, size_t> index;
+        size_t size_bytes{0};
+        ss::shared_promise<result<raft::replicate_result>> done;
+    };
+
+    void flush();
+
+    ss::lw_shared_ptr<cluster::partition> _partition;
+    std::chrono::milliseconds _window;
+    std::unique_ptr<pending_batch> _pending;
+    // ready once the last flushed batch, and so every batch flushed before
+    // it, is enqueued in raft
+    ss::shared_future<> _enqueued{ss::make_ready_future<>()};
+    ss::timer<> _timer;
+    ss::gate _gate;
+};
+
+} // namespace kafka
@@ -45,11 +45,13 @@ namespace kafka {
 
 protocol::protocol(
   ss::smp_service_group smp,
+  ss::scheduling_group recompression_sg,
   ss::sharded<cluster::metadata_cache>& meta,
   ss::sharded<cluster::topics_frontend>& tf,
   ss::sharded<cluster::config_frontend>& cf,
   ss::sharded<features::feature_table>& ft,
   ss::sharded<quota_manager>& quota,
+  ss::sharded<kafka::tenant_groups>& tenants,
   ss::sharded<kafka::group_router>& router,
   ss::sharded<cluster::shard_table>& tbl,
   ss::sharded<cluster::partition_manager>& pm,
@@ -64,11 +66,13 @@ protocol::protocol(
   ss::sharded<v8_engine::data_policy_table>& data_policy_table,
   std::optional<qdc_monitor::config> qdc_config) noexcept
   : _smp_group(smp)
+  , _recompression_sg(recompression_sg)
   , _topics_frontend(tf)
   , _config_frontend(cf)
   , _feature_table(ft)
   , _metadata_cache(meta)
   , _quota_mgr(quota)
+  , _tenant_groups(tenants)
   , _group_router(router)
   , _shard_table(tbl)
   , _partition_manager(pm)
@@ -85,6 +89,8 @@ protocol::protocol(
   , _tx_gateway_frontend(tx_gateway_frontend)
   , _coproc_partition_manager(coproc_partition_manager)
   , _data_policy_table(data_policy_table)
+  , _metadata_response_cache(
+      std::make_unique<kafka::metadata_response_cache>(meta.local()))
   , _mtls_principal_mapper(
       config::shard_local_cfg().kafka_mtls_principal_mapping_rules.bind()) {
     if (qdc_config) {
@@ -18,6 +18,7 @@
 #include "kafka/latency_probe.h"
 #include "kafka/server/fetch_metadata_cache.hh"
 #include "kafka/server/fwd.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/queue_depth_monitor.h"
 #include "net/server.h"
 #include "security/authorizer.h"
@@ -27,6 +28,7 @@
 #include "v8_engine/data_policy_table.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
@@ -36,11 +38,13 @@ class protocol final : public net::server::protocol {
 public:
     protocol(
       ss::smp_service_group,
+      ss::scheduling_group recompression_sg,
       ss::sharded<cluster::metadata_cache>&,
       ss::sharded<cluster::topics_frontend>&,
       ss::sharded<cluster::config_frontend>&,
       ss::sharded<features::feature_table>&,
       ss::sharded<quota_manager>&,
+      ss::sharded<kafka::tenant_groups>&,
       ss::sharded<kafka::group_router>&,
       ss::sharded<cluster::shard_table>&,
       ss::sharded<cluster::partition_manager>&,
@@ -67,6 +71,7 @@ public:
     ss::future<> apply(net::server::resources) final;
 
     ss::smp_service_group smp_group() const { return _smp_group; }
+    ss::scheduling_group recompression_sg() const { return _recompression_sg; }
     cluster::topics_frontend& topics_frontend() {
         return _topics_frontend.local();
     }
@@ -99,6 +104,7 @@ public:
         return _fetch_session_cache.local();
     }
     quota_manager& quota_mgr() { return _quota_mgr.local(); }
+    kafka::tenant_groups& tenant_groups() { return _tenant_groups.local(); }
     bool is_idempotence_enabled() const { return _is_idempotence_enabled; }
     bool are_transactions_enabled() const { return _are_transactions_enabled; }
 
@@ -136,15 +142,21 @@ public:
         return _fetch_metadata_cache;
     }
 
+    kafka::metadata_response_cache& metadata_response_cache() {
+        return *_metadata_response_cache;
+    }
+
     latency_probe& probe() { return _probe; }
 
 private:
     ss::smp_service_group _smp_group;
+    ss::scheduling_group _recompression_sg;
     ss::sharded<cluster::topics_frontend>& _topics_frontend;
     ss::sharded<cluster::config_frontend>& _config_frontend;
     ss::sharded<features::feature_table>& _feature_table;
     ss::sharded<cluster::metadata_cache>& _metadata_cache;
     ss::sharded<quota_manager>& _quota_mgr;
+    ss::sharded<kafka::tenant_groups>& _tenant_groups;
     ss::sharded<kafka::group_router>& _group_router;
     ss::sharded<cluster::shard_table>& _shard_table;
     ss::sharded<cluster::partition_manager>& _partition_manager;
@@ -161,6 +173,7 @@ private:
     ss::sharded<v8_engine::data_policy_table>& _data_policy_table;
     std::optional<qdc_monitor> _qdc_mon;
     kafka::fetch_metadata_cache _fetch_metadata_cache;
+    std::unique_ptr<kafka::metadata_response_cache> _metadata_response_cache;
     security::tls::principal_mapper _mtls_principal_mapper;
 
     latency_probe _probe;
@@ -95,6 +95,13 @@ parse_header(ss::input_stream<char>& src) {
 }
 
 ss::scattered_message<char> response_as_scattered(response_ptr response) {
+    ss::scattered_message<char> msg;
+    append_response(msg, std::move(response));
+    return msg;
+}
+
+size_t
+append_response(ss::scattered_message<char>& msg, response_ptr response) {
     /*
      * response header:
      *   - int32_t: size (correlation + response size)
@@ -118,7 +125,6 @@ ss::scattered_message<char> response_as_scattered(response_ptr response) {
 
     auto& buf = response->buf();
     buf.prepend(std::move(header));
-    ss::scattered_message<char> msg;
     auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
     int32_t chunk_no = 0;
     in.consume(
@@ -135,7 +141,7 @@ ss::scattered_message<char> response_as_scattered(response_ptr response) {
       });
     // MUST be the foreign ptr not the iobuf
     msg.on_delete([response = std::move(response)] {});
-    return msg;
+    return chunk_no;
 }
 
 } // namespace kafka
@@ -29,4 +29,8 @@ ss::future<std::optional<request_header>> parse_header(ss::input_stream<char>&);
 
 ss::scattered_message<char> response_as_scattered(response_ptr response);
 
+/// Appends the framed response to the message, which keeps the response alive
+/// until it is sent. Returns the number of the appended fragments.
+size_t append_response(ss::scattered_message<char>&, response_ptr response);
+
 } // namespace kafka
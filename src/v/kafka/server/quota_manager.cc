@@ -11,11 +11,17 @@
 
 #include "config/configuration.h"
 #include "kafka/server/logger.h"
+#include "ssx/future-util.h"
+#include "units.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/smp.hh>
+
 #include <fmt/chrono.h>
 
 #include <chrono>
+#include <numeric>
 
 using namespace std::chrono_literals;
 
@@ -23,15 +29,41 @@ namespace kafka {
 using clock = quota_manager::clock;
 using throttle_delay = quota_manager::throttle_delay;
 
-quota_manager::~quota_manager() { _gc_timer.cancel(); }
+namespace {
+
+// the token bucket has to get some tokens on every refresh
+constexpr size_t min_shard_byte_rate = 1_KiB;
+
+// a shard that recorded no bytes keeps this fraction of its fair share of a
+// byte quota, so that the first requests it gets aren't throttled to a halt
+constexpr double idle_shard_share = 0.1;
+
+size_t shard_byte_rate(double rate) {
+    return std::max(min_shard_byte_rate, static_cast<size_t>(rate));
+}
+
+} // namespace
+
+quota_manager::~quota_manager() {
+    _gc_timer.cancel();
+    _balancer_timer.cancel();
+}
 
 ss::future<> quota_manager::stop() {
     _gc_timer.cancel();
-    return ss::make_ready_future<>();
+    _balancer_timer.cancel();
+    co_await _gate.close();
+    // fails the requests waiting for a byte quota
+    for (auto& [_, q] : _byte_quotas) {
+        q->bucket.shutdown();
+    }
 }
 
 ss::future<> quota_manager::start() {
     _gc_timer.arm_periodic(_gc_freq);
+    if (ss::this_shard_id() == quota_manager_shard && ss::smp::count > 1) {
+        _balancer_timer.arm(_default_window_width());
+    }
     return ss::make_ready_future<>();
 }
 
@@ -174,6 +206,191 @@ void quota_manager::gc(clock::duration full_window) {
       _quotas, [now, expire_age](const std::pair<ss::sstring, quota>& q) {
           return (now - q.second.last_seen) > expire_age;
       });
+    // requests waiting for an erased byte quota keep it alive
+    absl::erase_if(_byte_quotas, [now, expire_age](const auto& q) {
+        return (now - q.second->last_seen) > expire_age;
+    });
+}
+
+quota_manager::byte_quota::byte_quota(size_t rate)
+  : bucket(rate, "kafka/byte-quota")
+  , rate(rate) {}
+
+void quota_manager::byte_quota::record(
+  size_t bytes, clock::duration max_delay) {
+    recorded += bytes;
+    // fail-safe: a single large request can't put the quota into a debt that
+    // takes longer than max_delay to pay off
+    auto max_debt = rate
+                    * std::chrono::duration_cast<std::chrono::milliseconds>(
+                        max_delay)
+                        .count()
+                    / 1000;
+    bucket.record(std::min<size_t>(bytes, max_debt));
+}
+
+std::optional<size_t> quota_manager::byte_rate(
+  byte_quota_entity entity, byte_quota_type type) const {
+    switch (entity) {
+    case byte_quota_entity::user:
+        return type == byte_quota_type::produce ? _user_produce_rate()
+                                                : _user_fetch_rate();
+    case byte_quota_entity::client:
+        return type == byte_quota_type::produce ? _client_produce_rate()
+                                                : _client_fetch_rate();
+    }
+    __builtin_unreachable();
+}
+
+bool quota_manager::byte_quota_enabled(byte_quota_type type) const {
+    return byte_rate(byte_quota_entity::user, type).has_value()
+           || byte_rate(byte_quota_entity::client, type).has_value();
+}
+
+std::vector<ss::lw_shared_ptr<quota_manager::byte_quota>>
+quota_manager::get_byte_quotas(
+  byte_quota_type type, const byte_quota_owner& owner, clock::time_point now) {
+    std::vector<ss::lw_shared_ptr<byte_quota>> ret;
+    auto get = [this, type, now, &ret](
+                 byte_quota_entity entity, std::string_view name) {
+        auto rate = byte_rate(entity, type);
+        if (!rate) {
+            return;
+        }
+        auto [it, inserted] = _byte_quotas.try_emplace(
+          byte_quota_key{entity, type, ss::sstring(name)});
+        if (inserted) {
+            // a fair share until the next rebalance
+            it->second = ss::make_lw_shared<byte_quota>(
+              shard_byte_rate(static_cast<double>(*rate) / ss::smp::count));
+        }
+        it->second->last_seen = now;
+        ret.push_back(it->second);
+    };
+    get(byte_quota_entity::user, owner.principal);
+    // requests without a client id share the quota of the anonymous group
+    get(
+      byte_quota_entity::client,
+      owner.client_id ? std::string_view(*owner.client_id) : "");
+    return ret;
+}
+
+ss::future<clock::duration> quota_manager::throttle_bytes(
+  byte_quota_type type,
+  byte_quota_owner owner,
+  size_t bytes,
+  ss::abort_source& as) {
+    auto start = clock::now();
+    auto quotas = get_byte_quotas(type, owner, start);
+    for (auto& q : quotas) {
+        q->record(bytes, _max_delay());
+    }
+    for (auto& q : quotas) {
+        co_await q->bucket.throttle(0, as);
+    }
+    auto now = clock::now();
+    for (auto& q : quotas) {
+        q->last_seen = now;
+    }
+    co_return now - start;
+}
+
+void quota_manager::record_bytes(
+  byte_quota_type type, const byte_quota_owner& owner, size_t bytes) {
+    for (auto& q : get_byte_quotas(type, owner, clock::now())) {
+        q->record(bytes, _max_delay());
+    }
+}
+
+void quota_manager::update_byte_rate(
+  byte_quota_entity entity, byte_quota_type type) {
+    auto rate = byte_rate(entity, type);
+    absl::erase_if(_byte_quotas, [entity, type, rate](auto& q) {
+        if (q.first.entity != entity || q.first.type != type) {
+            return false;
+        }
+        if (!rate) {
+            q.second->bucket.refill();
+            return true;
+        }
+        // a fair share of the new rate until the next rebalance
+        q.second->rate = shard_byte_rate(
+          static_cast<double>(*rate) / ss::smp::count);
+        q.second->bucket.update_rate(q.second->rate);
+        return false;
+    });
+}
+
+void quota_manager::rebalance_byte_quotas() {
+    ssx::spawn_with_gate(_gate, [this] {
+        return do_rebalance_byte_quotas()
+          .handle_exception([](const std::exception_ptr& e) {
+              vlog(klog.warn, "Failed to rebalance byte quotas: {}", e);
+          })
+          .finally([this] {
+              if (!_gate.is_closed()) {
+                  _balancer_timer.arm(_default_window_width());
+              }
+          });
+    });
+}
+
+ss::future<> quota_manager::do_rebalance_byte_quotas() {
+    if (
+      !byte_quota_enabled(byte_quota_type::produce)
+      && !byte_quota_enabled(byte_quota_type::fetch)) {
+        co_return;
+    }
+
+    auto usage = co_await container().map(
+      [](quota_manager& qm) { return qm.take_byte_usage(); });
+
+    // the bytes recorded by every shard, replaced by the rates below
+    byte_rates_t rates;
+    for (size_t shard = 0; shard < usage.size(); ++shard) {
+        for (const auto& [key, bytes] : usage[shard]) {
+            auto [it, _] = rates.try_emplace(key, usage.size(), 0);
+            it->second[shard] = bytes;
+        }
+    }
+    absl::erase_if(rates, [this](const auto& r) {
+        return !byte_rate(r.first.entity, r.first.type);
+    });
+
+    for (auto& [key, shard_rates] : rates) {
+        auto rate = static_cast<double>(*byte_rate(key.entity, key.type));
+        auto total = static_cast<double>(std::accumulate(
+          shard_rates.begin(), shard_rates.end(), uint64_t(0)));
+        // +1 splits the rate evenly when no bytes were recorded
+        auto idle = idle_shard_share * total / shard_rates.size() + 1;
+        auto weights = total + idle * shard_rates.size();
+        for (auto& r : shard_rates) {
+            r = shard_byte_rate(rate * (r + idle) / weights);
+        }
+    }
+
+    co_await container().invoke_on_all(
+      [&rates](quota_manager& qm) { qm.apply_byte_rates(rates); });
+}
+
+quota_manager::byte_usage_t quota_manager::take_byte_usage() {
+    byte_usage_t usage;
+    usage.reserve(_byte_quotas.size());
+    for (auto& [key, q] : _byte_quotas) {
+        usage.emplace(key, std::exchange(q->recorded, 0));
+    }
+    return usage;
+}
+
+void quota_manager::apply_byte_rates(const byte_rates_t& rates) {
+    for (auto& [key, q] : _byte_quotas) {
+        auto it = rates.find(key);
+        if (it == rates.end()) {
+            continue;
+        }
+        q->rate = it->second[ss::this_shard_id()];
+        q->bucket.update_rate(q->rate);
+    }
 }
 
 } // namespace kafka
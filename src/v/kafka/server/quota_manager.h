@@ -14,9 +14,13 @@
 #include "kafka/server/token_bucket_rate_tracker.h"
 #include "resource_mgmt/rate.h"
 #include "seastarx.h"
+#include "utils/token_bucket.h"
 
+#include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/core/timer.hh>
@@ -26,6 +30,7 @@
 #include <chrono>
 #include <optional>
 #include <string_view>
+#include <vector>
 
 namespace kafka {
 
@@ -34,21 +39,17 @@ static constexpr ss::shard_id quota_manager_shard = 0;
 
 // quota_manager tracks quota usage
 //
+// the total throughput is tracked per client_id and per shard. in addition
+// produce and fetch byte quotas can be configured per principal and per
+// client_id. these are node wide: every shard has a token bucket with a share
+// of the rate, and the home shard periodically collects the bytes recorded by
+// the shards and splits the rate between them proportionally, so that a
+// client connected to many shards gets its quota and no more.
+//
 // TODO:
 //   - we will want to eventually add support for configuring the quotas and
 //   quota settings as runtime through the kafka api and other mechanisms.
 //
-//   - currently only total throughput per client_id is tracked. in the future
-//   we will want to support additional quotas and accouting granularities to be
-//   at parity with kafka. for example:
-//
-//      - splitting out rates separately for produce and fetch
-//      - accounting per user vs per client (these are separate in kafka)
-//
-//   - it may eventually be beneficial to periodically reduce stats across
-//   shards or track stats globally to produce a more accurate per-node
-//   representation of a statistic (e.g. bandwidth).
-//
 class quota_manager : public ss::peering_sharded_service<quota_manager> {
 public:
     using clock = ss::lowres_clock;
@@ -58,6 +59,14 @@ public:
         clock::duration duration;
     };
 
+    enum class byte_quota_type : uint8_t { produce, fetch };
+
+    // the principal and the client_id the bytes of a request are accounted to
+    struct byte_quota_owner {
+        ss::sstring principal;
+        std::optional<ss::sstring> client_id;
+    };
+
     quota_manager()
       : _default_num_windows(
         config::shard_local_cfg().default_num_windows.bind())
@@ -68,11 +77,33 @@ public:
           config::shard_local_cfg().kafka_admin_topic_api_rate.bind())
       , _gc_freq(config::shard_local_cfg().quota_manager_gc_sec())
       , _max_delay(
-          config::shard_local_cfg().max_kafka_throttle_delay_ms.bind()) {
+          config::shard_local_cfg().max_kafka_throttle_delay_ms.bind())
+      , _user_produce_rate(
+          config::shard_local_cfg().kafka_user_produce_byte_rate.bind())
+      , _user_fetch_rate(
+          config::shard_local_cfg().kafka_user_fetch_byte_rate.bind())
+      , _client_produce_rate(
+          config::shard_local_cfg().kafka_client_produce_byte_rate.bind())
+      , _client_fetch_rate(
+          config::shard_local_cfg().kafka_client_fetch_byte_rate.bind()) {
         _gc_timer.set_callback([this] {
             auto full_window = _default_num_windows() * _default_window_width();
             gc(full_window);
         });
+        _balancer_timer.set_callback([this] { rebalance_byte_quotas(); });
+        _user_produce_rate.watch([this] {
+            update_byte_rate(byte_quota_entity::user, byte_quota_type::produce);
+        });
+        _user_fetch_rate.watch([this] {
+            update_byte_rate(byte_quota_entity::user, byte_quota_type::fetch);
+        });
+        _client_produce_rate.watch([this] {
+            update_byte_rate(
+              byte_quota_entity::client, byte_quota_type::produce);
+        });
+        _client_fetch_rate.watch([this] {
+            update_byte_rate(byte_quota_entity::client, byte_quota_type::fetch);
+        });
     }
 
     quota_manager(const quota_manager&) = delete;
@@ -104,7 +135,22 @@ public:
       uint32_t mutations,
       clock::time_point now = clock::now());
 
+    // whether a byte quota of the type is configured
+    bool byte_quota_enabled(byte_quota_type) const;
+
+    // record bytes against the byte quotas of the owner and wait until the
+    // quotas are no longer exceeded. returns the time spent waiting.
+    ss::future<clock::duration> throttle_bytes(
+      byte_quota_type, byte_quota_owner, size_t bytes, ss::abort_source&);
+
+    // record bytes against the byte quotas of the owner without waiting. used
+    // when the size is known after the request is processed (e.g. the size
+    // of a fetch response), the next throttle_bytes() call waits for them.
+    void record_bytes(byte_quota_type, const byte_quota_owner&, size_t bytes);
+
 private:
+    friend struct quota_manager_test_fixture;
+
     std::chrono::milliseconds do_record_partition_mutations(
       std::optional<std::string_view> client_id,
       uint32_t mutations,
@@ -122,6 +168,43 @@ private:
     };
     using underlying_t = absl::flat_hash_map<ss::sstring, quota>;
 
+    enum class byte_quota_entity : uint8_t { user, client };
+
+    struct byte_quota_key {
+        byte_quota_entity entity;
+        byte_quota_type type;
+        ss::sstring name;
+
+        bool operator==(const byte_quota_key&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const byte_quota_key& k) {
+            return H::combine(
+              std::move(h), k.entity, k.type, std::string_view(k.name));
+        }
+    };
+
+    // the shard local part of a node wide byte quota
+    struct byte_quota {
+        explicit byte_quota(size_t rate);
+
+        void record(size_t bytes, clock::duration max_delay);
+
+        token_bucket<clock> bucket;
+        // the share of the node wide rate of this shard
+        size_t rate;
+        clock::time_point last_seen;
+        // bytes recorded since the last rebalance
+        uint64_t recorded{0};
+    };
+    using byte_quotas_t
+      = absl::flat_hash_map<byte_quota_key, ss::lw_shared_ptr<byte_quota>>;
+    // bytes recorded by a shard, per quota
+    using byte_usage_t = absl::flat_hash_map<byte_quota_key, uint64_t>;
+    // the rate of every shard, per quota
+    using byte_rates_t
+      = absl::flat_hash_map<byte_quota_key, std::vector<size_t>>;
+
 private:
     // erase inactive tracked quotas. windows are considered inactive if they
     // have not received any updates in ten window's worth of time.
@@ -130,6 +213,21 @@ private:
     underlying_t::iterator maybe_add_and_retrieve_quota(
       const std::optional<std::string_view>&, const clock::time_point&);
 
+    std::optional<size_t> byte_rate(byte_quota_entity, byte_quota_type) const;
+    std::vector<ss::lw_shared_ptr<byte_quota>> get_byte_quotas(
+      byte_quota_type, const byte_quota_owner&, clock::time_point now);
+
+    // applies a changed byte rate to the tracked quotas. the requests waiting
+    // for a quota that is no longer configured are let through.
+    void update_byte_rate(byte_quota_entity, byte_quota_type);
+
+    // runs on the home shard, splits the rates of the byte quotas between the
+    // shards by the bytes they recorded since the previous round
+    void rebalance_byte_quotas();
+    ss::future<> do_rebalance_byte_quotas();
+    byte_usage_t take_byte_usage();
+    void apply_byte_rates(const byte_rates_t&);
+
 private:
     config::binding<int16_t> _default_num_windows;
     config::binding<std::chrono::milliseconds> _default_window_width;
@@ -142,6 +240,14 @@ private:
     ss::timer<> _gc_timer;
     clock::duration _gc_freq;
     config::binding<std::chrono::milliseconds> _max_delay;
+
+    config::binding<std::optional<size_t>> _user_produce_rate;
+    config::binding<std::optional<size_t>> _user_fetch_rate;
+    config::binding<std::optional<size_t>> _client_produce_rate;
+    config::binding<std::optional<size_t>> _client_fetch_rate;
+    byte_quotas_t _byte_quotas;
+    ss::timer<> _balancer_timer;
+    ss::gate _gate;
 };
 
 } // namespace kafka
@@ -95,9 +95,15 @@ ss::future<storage::translating_reader> replicated_partition::make_reader(
         ss::future<storage_t>
         do_load_slice(model::timeout_clock::time_point t) final {
             return _underlying->do_load_slice(t).then([this](storage_t recs) {
-                for (auto& batch : get_batches(recs)) {
-                    batch.header().base_offset = _translator->from_log_offset(
-                      batch.base_offset());
+                auto& batches = get_batches(recs);
+                std::vector<model::offset> offsets;
+                offsets.reserve(batches.size());
+                for (const auto& batch : batches) {
+                    offsets.push_back(batch.base_offset());
+                }
+                _translator->from_log_offsets(offsets);
+                for (size_t i = 0; i < batches.size(); ++i) {
+                    batches[i].header().base_offset = offsets[i];
                 }
                 return recs;
             });
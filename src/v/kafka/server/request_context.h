@@ -88,6 +88,12 @@ public:
 
     latency_probe& probe() { return _conn->server().probe(); }
 
+    ss::io_priority_class io_priority() const { return _conn->io_priority(); }
+
+    ss::scheduling_group recompression_sg() const {
+        return _conn->server().recompression_sg();
+    }
+
     const cluster::metadata_cache& metadata_cache() const {
         return _conn->server().metadata_cache();
     }
@@ -151,6 +157,10 @@ public:
         return _conn->server().get_fetch_metadata_cache();
     }
 
+    kafka::metadata_response_cache& metadata_response_cache() {
+        return _conn->server().metadata_response_cache();
+    }
+
     template<typename ResponseType>
     requires requires(
       ResponseType r, response_writer& writer, api_version version) {
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/response_batch.h"
+
+#include "kafka/server/protocol_utils.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace kafka {
+
+bool response_batch::fits(const response& r) const {
+    if (r.is_noop() || _fragments == 0) {
+        return true;
+    }
+    // the header and the tagged fields are prepended to the response
+    auto n = std::distance(r.buf().cbegin(), r.buf().cend()) + 2;
+    return _fragments + n <= _max_fragments;
+}
+
+void response_batch::append(
+  response_ptr r, std::optional<std::chrono::microseconds> blocked) {
+    if (blocked) {
+        ++_stats.blocked_responses;
+        _stats.blocked_time += *blocked;
+        _stats.max_blocked_time = std::max(_stats.max_blocked_time, *blocked);
+    }
+    if (r->is_noop()) {
+        return;
+    }
+    _fragments += append_response(_msg, std::move(r));
+    ++_stats.responses;
+}
+
+ss::scattered_message<char> response_batch::release() && {
+    ++_stats.writes;
+    return std::move(_msg);
+}
+
+} // namespace kafka
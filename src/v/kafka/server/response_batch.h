@@ -0,0 +1,76 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "kafka/server/response.h"
+#include "seastarx.h"
+
+#include <seastar/core/scattered_message.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace kafka {
+
+/**
+ * Responses are sent in request order, a ready response is blocked until the
+ * responses to the earlier requests of the connection are ready.
+ */
+struct response_stats {
+    uint64_t responses{0};
+    uint64_t writes{0};
+    // responses that were ready before an earlier one
+    uint64_t blocked_responses{0};
+    std::chrono::microseconds blocked_time{0};
+    std::chrono::microseconds max_blocked_time{0};
+};
+
+/**
+ * In-order responses of a connection that are written together, as a single
+ * scattered message. Noop responses are accounted for but not written.
+ */
+class response_batch {
+public:
+    /// Limit of the fragments of a batch, a single response can be larger
+    static constexpr size_t default_max_fragments
+      = std::numeric_limits<int16_t>::max();
+
+    explicit response_batch(
+      response_stats& stats, size_t max_fragments = default_max_fragments)
+      : _stats(stats)
+      , _max_fragments(max_fragments) {}
+
+    /// Whether the response can be added without going over the fragments
+    /// limit. The first response of a batch always fits.
+    bool fits(const response& r) const;
+
+    /// Adds the next response in order, blocked is the time it was ready
+    /// for while an earlier response wasn't
+    void append(response_ptr, std::optional<std::chrono::microseconds> blocked);
+
+    /// Nothing to write, e.g. only noop responses were added
+    bool empty() const { return _msg.size() == 0; }
+    size_t fragments() const { return _fragments; }
+
+    /// The message to write to the connection
+    ss::scattered_message<char> release() &&;
+
+private:
+    response_stats& _stats;
+    size_t _max_fragments;
+    size_t _fragments{0};
+    ss::scattered_message<char> _msg;
+};
+
+} // namespace kafka
@@ -0,0 +1,178 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/tenant_groups.h"
+
+#include "config/configuration.h"
+#include "config/validators.h"
+#include "kafka/server/logger.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+#include <seastar/core/metrics.hh>
+#include <seastar/core/smp.hh>
+
+#include <algorithm>
+#include <chrono>
+
+namespace kafka {
+
+tenant_groups::tenant_groups(
+  const std::vector<std::pair<ss::sstring, ss::scheduling_group>>& sgs)
+  : _shares_cfg(config::shard_local_cfg().kafka_tenant_group_shares.bind())
+  , _mapping_cfg(config::shard_local_cfg().kafka_tenant_group_mapping.bind()) {
+    _groups.reserve(sgs.size());
+    for (const auto& [name, sg] : sgs) {
+        // registered with the shares of kafka_read, start() sets the
+        // configured ones
+        _groups.push_back(group{
+          .name = name,
+          .sg = sg,
+          .io_priority = ss::io_priority_class::register_one(
+            "kafka_read_" + name, default_shares),
+          .shares = default_shares,
+        });
+    }
+    _shares_cfg.watch([this] { update_shares(); });
+    _mapping_cfg.watch([this] { update_mapping(); });
+}
+
+ss::future<> tenant_groups::start() {
+    update_shares();
+    update_mapping();
+    setup_metrics();
+    return ss::now();
+}
+
+ss::future<> tenant_groups::stop() {
+    _metrics.clear();
+    return _gate.close();
+}
+
+tenant_groups::group* tenant_groups::find(
+  std::string_view listener, const security::acl_principal& principal) {
+    if (!principal.name().empty()) {
+        auto it = _by_principal.find(principal.name());
+        if (it != _by_principal.end()) {
+            return it->second;
+        }
+    }
+    auto it = _by_listener.find(ss::sstring(listener));
+    return it == _by_listener.end() ? nullptr : it->second;
+}
+
+tenant_groups::group* tenant_groups::find_group(std::string_view name) {
+    auto it = std::find_if(
+      _groups.begin(), _groups.end(), [name](const group& g) {
+          return g.name == name;
+      });
+    return it == _groups.end() ? nullptr : &*it;
+}
+
+void tenant_groups::update_shares() {
+    absl::flat_hash_map<ss::sstring, uint32_t> configured;
+    for (const auto& raw_group : _shares_cfg()) {
+        // validated by the property
+        auto parsed = config::parse_kafka_tenant_group_shares(raw_group);
+        if (!parsed) {
+            continue;
+        }
+        if (!find_group(parsed->first) && ss::this_shard_id() == 0) {
+            vlog(
+              klog.warn,
+              "Ignoring {}, no such Kafka tenant group: {}",
+              raw_group,
+              parsed->first);
+        }
+        configured.emplace(std::move(parsed->first), parsed->second);
+    }
+    // a group without configured shares has the ones of the kafka group
+    for (auto& g : _groups) {
+        auto it = configured.find(g.name);
+        auto shares = it == configured.end() ? default_shares : it->second;
+        if (g.shares == shares) {
+            continue;
+        }
+        g.shares = shares;
+        g.sg.set_shares(static_cast<float>(g.shares));
+        ssx::spawn_with_gate(
+          _gate, [pc = g.io_priority, shares = g.shares]() mutable {
+              return pc.update_shares(shares);
+          });
+    }
+}
+
+void tenant_groups::update_mapping() {
+    _by_principal.clear();
+    _by_listener.clear();
+    for (const auto& raw_rule : _mapping_cfg()) {
+        // validated by the property
+        auto rule = config::parse_kafka_tenant_rule(raw_rule);
+        if (!rule) {
+            continue;
+        }
+        auto g = find_group(rule->group);
+        if (!g) {
+            if (ss::this_shard_id() == 0) {
+                vlog(
+                  klog.warn,
+                  "Ignoring {}, no such Kafka tenant group: {}",
+                  raw_rule,
+                  rule->group);
+            }
+            continue;
+        }
+        auto& tenants = rule->kind == config::kafka_tenant_kind::principal
+                          ? _by_principal
+                          : _by_listener;
+        tenants.insert_or_assign(std::move(rule->name), g);
+    }
+}
+
+void tenant_groups::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    auto group_label = sm::label("tenant_group");
+    for (const auto& g : _groups) {
+        std::vector<sm::label_instance> labels{group_label(g.name)};
+        _metrics.add_group(
+          prometheus_sanitize::metrics_name("kafka:tenant"),
+          {sm::make_counter(
+             "requests",
+             [&g] { return g.requests; },
+             sm::description("Number of Kafka requests of the tenant group"),
+             labels),
+           sm::make_counter(
+             "request_bytes",
+             [&g] { return g.request_bytes; },
+             sm::description(
+               "Number of bytes of Kafka requests of the tenant group"),
+             labels),
+           sm::make_gauge(
+             "connections",
+             [&g] { return g.connections; },
+             sm::description("Number of Kafka connections of the tenant group"),
+             labels),
+           sm::make_counter(
+             "runtime_ms",
+             [&g] {
+                 return std::chrono::duration_cast<std::chrono::milliseconds>(
+                          g.sg.get_stats().runtime)
+                   .count();
+             },
+             sm::description("Accumulated runtime of the tenant group"),
+             labels)});
+    }
+}
+
+} // namespace kafka
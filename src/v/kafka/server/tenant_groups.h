@@ -0,0 +1,90 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "seastarx.h"
+#include "security/acl.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/io_priority_class.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <string_view>
+#include <vector>
+
+namespace kafka {
+
+/*
+ * Tenant groups isolate the Kafka requests of tenants from each other. Every
+ * group of kafka_tenant_groups has a cpu scheduling group, created on startup
+ * by scheduling_groups, and an io priority class for the reads of the
+ * partitions. The shares of both follow kafka_tenant_group_shares.
+ *
+ * A connection is assigned to the group of its principal or, failing that,
+ * of its listener (kafka_tenant_group_mapping) once it is authenticated. The
+ * connections without a group stay in the kafka scheduling group and read
+ * with the kafka_read io priority class.
+ */
+class tenant_groups {
+public:
+    /// Shares of the kafka scheduling group and of kafka_read
+    static constexpr uint32_t default_shares = 1000;
+
+    struct group {
+        ss::sstring name;
+        ss::scheduling_group sg;
+        ss::io_priority_class io_priority;
+        uint32_t shares;
+
+        uint64_t requests{0};
+        uint64_t request_bytes{0};
+        uint64_t connections{0};
+    };
+
+    explicit tenant_groups(
+      const std::vector<std::pair<ss::sstring, ss::scheduling_group>>& sgs);
+
+    tenant_groups(const tenant_groups&) = delete;
+    tenant_groups& operator=(const tenant_groups&) = delete;
+    tenant_groups(tenant_groups&&) = delete;
+    tenant_groups& operator=(tenant_groups&&) = delete;
+    ~tenant_groups() noexcept = default;
+
+    ss::future<> start();
+    ss::future<> stop();
+
+    /// The group of a connection, nullptr if it isn't assigned to any
+    group* find(std::string_view listener, const security::acl_principal&);
+
+private:
+    group* find_group(std::string_view name);
+    void update_shares();
+    void update_mapping();
+    void setup_metrics();
+
+    config::binding<std::vector<ss::sstring>> _shares_cfg;
+    config::binding<std::vector<ss::sstring>> _mapping_cfg;
+    // never resized, the connections keep pointers to the groups
+    std::vector<group> _groups;
+    absl::flat_hash_map<ss::sstring, group*> _by_principal;
+    absl::flat_hash_map<ss::sstring, group*> _by_listener;
+    ss::gate _gate;
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace kafka
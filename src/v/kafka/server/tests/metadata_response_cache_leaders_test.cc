@@ -0,0 +1,83 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/metadata_cache.h"
+#include "cluster/partition_leaders_table.h"
+#include "kafka/server/metadata_response_cache.h"
+#include "redpanda/tests/fixture.h"
+#include "test_utils/async.h"
+#include "test_utils/fixture.h"
+
+using namespace std::chrono_literals;
+
+struct metadata_response_cache_fixture : public redpanda_thread_fixture {
+    static constexpr auto version
+      = kafka::metadata_response_cache::max_cached_version;
+
+    metadata_response_cache_fixture() {
+        wait_for_controller_leadership().get0();
+        add_topic(tp_ns).get0();
+        tests::cooperative_spin_wait_with_timeout(2s, [this] {
+            return app.metadata_cache.local()
+              .get_leader_id(tp_ns, model::partition_id(0))
+              .has_value();
+        }).get0();
+    }
+
+    cluster::partition_leaders_table& leaders() {
+        return app.controller->get_partition_leaders().local();
+    }
+
+    cluster::leader_term leader_term() {
+        return *app.metadata_cache.local().get_leader_term(
+          tp_ns, model::partition_id(0));
+    }
+
+    model::topic_namespace tp_ns{model::kafka_namespace, model::topic("t")};
+    model::ntp ntp{tp_ns.ns, tp_ns.tp, model::partition_id(0)};
+};
+
+FIXTURE_TEST(test_new_term_same_leader, metadata_response_cache_fixture) {
+    kafka::metadata_response_cache cache(app.metadata_cache.local());
+    auto before = cache.get(tp_ns, version);
+    BOOST_REQUIRE(before);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+    // the leader node doesn't change, the leader epoch of the response does
+    auto lt = leader_term();
+    leaders().update_partition_leader(
+      ntp, model::term_id(lt.term() + 1), lt.leader);
+
+    auto after = cache.get(tp_ns, version);
+    BOOST_REQUIRE(after);
+    BOOST_REQUIRE(*before != *after);
+    BOOST_REQUIRE(*after == *cache.get(tp_ns, version));
+}
+
+FIXTURE_TEST(test_leader_lost_and_reset, metadata_response_cache_fixture) {
+    kafka::metadata_response_cache cache(app.metadata_cache.local());
+    BOOST_REQUIRE(cache.get(tp_ns, version));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+    // a partition without a leader is not cached
+    auto lt = leader_term();
+    leaders().update_partition_leader(
+      ntp, model::term_id(lt.term() + 1), std::nullopt);
+    BOOST_REQUIRE(cache.get(tp_ns, version));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+
+    leaders().update_partition_leader(
+      ntp, model::term_id(lt.term() + 2), lt.leader);
+    BOOST_REQUIRE(cache.get(tp_ns, version));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+    app.metadata_cache.local().reset_leaders();
+    BOOST_REQUIRE(cache.get(tp_ns, version));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+}
@@ -0,0 +1,74 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/response_writer.h"
+#include "kafka/server/metadata_response_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+kafka::metadata_response make_response() {
+    kafka::metadata_response r;
+    r.data.brokers.push_back(kafka::metadata_response::broker{
+      .node_id = model::node_id(1), .host = "localhost", .port = 9092});
+    r.data.cluster_id = "redpanda.test";
+    r.data.controller_id = model::node_id(1);
+    return r;
+}
+
+kafka::metadata_response::topic make_topic() {
+    kafka::metadata_response::topic t;
+    t.error_code = kafka::error_code::none;
+    t.name = model::topic("tapioca");
+    t.is_internal = false;
+    for (int i = 0; i < 3; ++i) {
+        kafka::metadata_response::partition p;
+        p.error_code = kafka::error_code::none;
+        p.partition_index = model::partition_id(i);
+        p.leader_id = model::node_id(i);
+        p.leader_epoch = kafka::leader_epoch(10 + i);
+        p.replica_nodes = {model::node_id(0), model::node_id(1)};
+        p.isr_nodes = p.replica_nodes;
+        t.partitions.push_back(std::move(p));
+    }
+    return t;
+}
+
+iobuf encode(kafka::metadata_response r, kafka::api_version v) {
+    iobuf buf;
+    kafka::response_writer writer(buf);
+    r.encode(writer, v);
+    return buf;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(encoded_topic_matches_generated_encoder) {
+    const auto max_version = kafka::metadata_response_cache::max_cached_version;
+    for (int16_t v = 0; v <= max_version(); ++v) {
+        const auto version = kafka::api_version(v);
+        // topics are the last field of the response, the encoded response
+        // with a single topic is the one without any topics followed by the
+        // encoded topic, apart from the size of the array.
+        auto with_topic = make_response();
+        with_topic.data.topics.push_back(make_topic());
+        auto expected = encode(std::move(with_topic), version);
+
+        auto assembled = encode(make_response(), version);
+        assembled.trim_back(sizeof(int32_t));
+        kafka::response_writer writer(assembled);
+        writer.write(int32_t(1));
+        auto t = make_topic();
+        writer.write_direct(kafka::metadata_response_cache::encode(t, version));
+
+        BOOST_REQUIRE(expected == assembled);
+    }
+}
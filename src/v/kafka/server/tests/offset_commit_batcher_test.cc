@@ -0,0 +1,217 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf_parser.h"
+#include "cluster/partition.h"
+#include "cluster/partition_manager.h"
+#include "cluster/simple_batch_builder.h"
+#include "kafka/server/offset_commit_batcher.h"
+#include "model/fundamental.h"
+#include "model/record_batch_reader.h"
+#include "redpanda/tests/fixture.h"
+#include "storage/types.h"
+#include "test_utils/async.h"
+#include "test_utils/fixture.h"
+
+#include <seastar/core/when_all.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+#include <vector>
+
+using namespace std::chrono_literals;
+
+struct offset_commit_batcher_fixture : public redpanda_thread_fixture {
+    ss::lw_shared_ptr<cluster::partition> start() {
+        wait_for_controller_leadership().get0();
+        model::topic_namespace tp_ns(model::kafka_namespace, test_topic);
+        add_topic(tp_ns).get0();
+        auto ntp = make_default_ntp(test_topic, model::partition_id(0));
+        tests::cooperative_spin_wait_with_timeout(2s, [this, ntp] {
+            auto p = app.partition_manager.local().get(ntp);
+            return p && p->is_leader();
+        }).get0();
+        return app.partition_manager.local().get(ntp);
+    }
+
+    static std::vector<kafka::offset_commit_batcher::record>
+    make_records(std::vector<std::pair<ss::sstring, ss::sstring>> kvs) {
+        std::vector<kafka::offset_commit_batcher::record> records;
+        for (auto& [k, v] : kvs) {
+            iobuf key;
+            key.append(k.data(), k.size());
+            iobuf value;
+            value.append(v.data(), v.size());
+            records.push_back(kafka::offset_commit_batcher::record{
+              .key = std::move(key), .value = std::move(value)});
+        }
+        return records;
+    }
+
+    /// Key and value of every record of the data batches in the log
+    static std::vector<std::vector<std::pair<ss::sstring, ss::sstring>>>
+    read_batches(cluster::partition& p) {
+        storage::log_reader_config cfg(
+          model::offset(0), model::offset::max(), ss::default_priority_class());
+        cfg.type_filter = model::record_batch_type::raft_data;
+        auto batches = p.make_reader(cfg)
+                         .then([](model::record_batch_reader r) {
+                             return model::consume_reader_to_memory(
+                               std::move(r), model::no_timeout);
+                         })
+                         .get0();
+        std::vector<std::vector<std::pair<ss::sstring, ss::sstring>>> res;
+        for (auto& b : batches) {
+            auto& kvs = res.emplace_back();
+            b.for_each_record([&kvs](model::record r) {
+                auto key = iobuf_parser(r.release_key());
+                auto value = iobuf_parser(r.release_value());
+                kvs.emplace_back(
+                  key.read_string(key.bytes_left()),
+                  value.read_string(value.bytes_left()));
+            });
+        }
+        return res;
+    }
+
+    const model::topic test_topic = model::topic("offset-commits");
+};
+
+FIXTURE_TEST(
+  test_commits_coalesced_within_window, offset_commit_batcher_fixture) {
+    auto p = start();
+    kafka::offset_commit_batcher batcher(p, 1h);
+
+    auto term = p->term();
+    auto s1 = batcher.replicate(term, make_records({{"a", "1"}, {"b", "1"}}));
+    auto s2 = batcher.replicate(term, make_records({{"a", "2"}}));
+    auto s3 = batcher.replicate(term, make_records({{"c", "1"}}));
+    // queued commits are ordered right away
+    BOOST_REQUIRE(s1.request_enqueued.available());
+    BOOST_REQUIRE(s2.request_enqueued.available());
+    BOOST_REQUIRE(s3.request_enqueued.available());
+    BOOST_REQUIRE(!s1.replicate_finished.available());
+
+    batcher.stop().get();
+
+    auto r1 = s1.replicate_finished.get0();
+    auto r2 = s2.replicate_finished.get0();
+    auto r3 = s3.replicate_finished.get0();
+    BOOST_REQUIRE(r1.has_value());
+    BOOST_REQUIRE(r2.has_value());
+    BOOST_REQUIRE(r3.has_value());
+    // all commits are replicated with one batch
+    BOOST_REQUIRE_EQUAL(r1.value().last_offset, r2.value().last_offset);
+    BOOST_REQUIRE_EQUAL(r1.value().last_offset, r3.value().last_offset);
+
+    auto batches = read_batches(*p);
+    BOOST_REQUIRE_EQUAL(batches.size(), 1);
+    // last write of every key wins
+    std::vector<std::pair<ss::sstring, ss::sstring>> expected{
+      {"a", "2"}, {"b", "1"}, {"c", "1"}};
+    BOOST_REQUIRE(batches[0] == expected);
+}
+
+FIXTURE_TEST(test_commits_flushed_by_window, offset_commit_batcher_fixture) {
+    auto p = start();
+    kafka::offset_commit_batcher batcher(p, 10ms);
+
+    auto term = p->term();
+    auto s1 = batcher.replicate(term, make_records({{"a", "1"}}));
+    auto s2 = batcher.replicate(term, make_records({{"b", "1"}}));
+    auto r1 = s1.replicate_finished.get0();
+    auto r2 = s2.replicate_finished.get0();
+    BOOST_REQUIRE(r1.has_value());
+    BOOST_REQUIRE(r2.has_value());
+
+    // commits made after the flush go into the next batch
+    auto s3 = batcher.replicate(term, make_records({{"c", "1"}}));
+    auto r3 = s3.replicate_finished.get0();
+    BOOST_REQUIRE(r3.has_value());
+    BOOST_REQUIRE_GT(r3.value().last_offset, r1.value().last_offset);
+
+    batcher.stop().get();
+    BOOST_REQUIRE_EQUAL(read_batches(*p).size(), 2);
+}
+
+FIXTURE_TEST(test_commit_errors_per_batch, offset_commit_batcher_fixture) {
+    auto p = start();
+    kafka::offset_commit_batcher batcher(p, 1h);
+
+    auto term = p->term();
+    auto ok = batcher.replicate(term, make_records({{"a", "1"}}));
+    // commits of a different term are replicated in their own batch which
+    // fails since the partition is not a leader in that term
+    auto stale = batcher.replicate(
+      term + model::term_id(1), make_records({{"b", "1"}}));
+    batcher.stop().get();
+
+    auto r_ok = ok.replicate_finished.get0();
+    auto r_stale = stale.replicate_finished.get0();
+    BOOST_REQUIRE(r_ok.has_value());
+    BOOST_REQUIRE(r_stale.has_error());
+
+    auto batches = read_batches(*p);
+    BOOST_REQUIRE_EQUAL(batches.size(), 1);
+    std::vector<std::pair<ss::sstring, ss::sstring>> expected{{"a", "1"}};
+    BOOST_REQUIRE(batches[0] == expected);
+}
+
+FIXTURE_TEST(test_commits_flushed_on_stop, offset_commit_batcher_fixture) {
+    auto p = start();
+    kafka::offset_commit_batcher batcher(p, 1h);
+
+    auto s = batcher.replicate(p->term(), make_records({{"a", "1"}}));
+    batcher.stop().get();
+    BOOST_REQUIRE(s.replicate_finished.available());
+    BOOST_REQUIRE(s.replicate_finished.get0().has_value());
+    BOOST_REQUIRE_EQUAL(read_batches(*p).size(), 1);
+
+    // the batcher doesn't accept commits after it is stopped
+    auto after = batcher.replicate(p->term(), make_records({{"b", "1"}}));
+    auto r = after.replicate_finished.get0();
+    BOOST_REQUIRE(r.has_error());
+    BOOST_REQUIRE_EQUAL(r.error(), make_error_code(raft::errc::shutting_down));
+}
+
+FIXTURE_TEST(
+  test_commits_ordered_before_direct, offset_commit_batcher_fixture) {
+    auto p = start();
+    kafka::offset_commit_batcher batcher(p, 1h);
+
+    auto term = p->term();
+    auto s = batcher.replicate(term, make_records({{"a", "1"}}));
+    // a tombstone of the key replicated without the batcher must land after
+    // the commit queued before it
+    batcher.flush_enqueued().get();
+    cluster::simple_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    iobuf key;
+    key.append("a", 1);
+    builder.add_raw_kv(std::move(key), iobuf{});
+    auto r = p->raft()
+               ->replicate(
+                 term,
+                 model::make_memory_record_batch_reader(
+                   std::move(builder).build()),
+                 raft::replicate_options(raft::consistency_level::quorum_ack))
+               .get0();
+    BOOST_REQUIRE(r.has_value());
+    auto committed = s.replicate_finished.get0();
+    BOOST_REQUIRE(committed.has_value());
+    BOOST_REQUIRE_LT(committed.value().last_offset, r.value().last_offset);
+
+    batcher.stop().get();
+    auto batches = read_batches(*p);
+    BOOST_REQUIRE_EQUAL(batches.size(), 2);
+    std::vector<std::pair<ss::sstring, ss::sstring>> expected{{"a", "1"}};
+    BOOST_REQUIRE(batches[0] == expected);
+    std::vector<std::pair<ss::sstring, ss::sstring>> tombstone{{"a", ""}};
+    BOOST_REQUIRE(batches[1] == tombstone);
+}
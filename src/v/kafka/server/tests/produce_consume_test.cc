@@ -7,6 +7,8 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "cluster/partition_manager.h"
+#include "config/configuration.h"
 #include "kafka/client/transport.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/fetch.h"
@@ -14,12 +16,16 @@
 #include "kafka/protocol/request_reader.h"
 #include "kafka/server/handlers/produce.h"
 #include "model/fundamental.h"
+#include "model/record_utils.h"
 #include "random/generators.h"
 #include "redpanda/tests/fixture.h"
+#include "storage/parser_utils.h"
 #include "storage/record_batch_builder.h"
 #include "test_utils/async.h"
 #include "test_utils/fixture.h"
 
+#include <seastar/util/defer.hh>
+
 #include <boost/test/tools/old/interface.hpp>
 
 using namespace std::chrono_literals;
@@ -178,3 +184,197 @@ FIXTURE_TEST(test_version_handler, prod_consume_fixture) {
         .get(),
       kafka::client::kafka_request_disconnected_exception);
 }
+
+struct recompression_fixture : public prod_consume_fixture {
+    recompression_fixture() {
+        set_recompression(model::compression::zstd, 1_MiB);
+    }
+
+    ~recompression_fixture() {
+        ss::smp::invoke_on_all([] {
+            config::shard_local_cfg().log_compression_type.reset();
+            config::shard_local_cfg()
+              .kafka_batch_recompression_max_bytes.reset();
+        }).get();
+    }
+
+    void set_recompression(model::compression codec, uint32_t max_bytes) {
+        ss::smp::invoke_on_all([codec, max_bytes] {
+            config::shard_local_cfg().log_compression_type.set_value(codec);
+            config::shard_local_cfg()
+              .kafka_batch_recompression_max_bytes.set_value(
+                std::make_optional(max_bytes));
+        }).get();
+    }
+
+    static model::record_batch make_batch(int count, size_t value_size) {
+        storage::record_batch_builder builder(
+          model::record_batch_type::raft_data, model::offset(0));
+        for (int i = 0; i < count; ++i) {
+            ss::sstring value(value_size, static_cast<char>('a' + i % 26));
+            iobuf v;
+            v.append(value.data(), value.size());
+            builder.add_raw_kv(iobuf{}, std::move(v));
+        }
+        return std::move(builder).build();
+    }
+
+    kafka::error_code produce_batch(model::record_batch batch) {
+        kafka::produce_request::partition partition;
+        partition.partition_index = model::partition_id(0);
+        partition.records.emplace(std::move(batch));
+        kafka::produce_request::topic tp;
+        tp.name = test_topic;
+        tp.partitions.push_back(std::move(partition));
+        std::vector<kafka::produce_request::topic> topics;
+        topics.push_back(std::move(tp));
+        kafka::produce_request req(std::nullopt, 1, std::move(topics));
+        req.data.timeout_ms = std::chrono::seconds(2);
+        req.has_idempotent = false;
+        req.has_transactional = false;
+        auto resp = producer->dispatch(std::move(req)).get0();
+        return resp.data.responses.begin()->partitions.begin()->error_code;
+    }
+
+    /// Data batches as they are stored in the partition log
+    std::vector<model::record_batch> read_stored_batches() {
+        model::ntp ntp(
+          model::kafka_namespace, test_topic, model::partition_id(0));
+        auto shard = app.shard_table.local().shard_for(ntp);
+        BOOST_REQUIRE(shard);
+        using batches_t = ss::circular_buffer<model::record_batch>;
+        auto batches
+          = app.partition_manager
+              .invoke_on(
+                *shard,
+                [ntp](cluster::partition_manager& pm) {
+                    storage::log_reader_config cfg(
+                      model::offset(0),
+                      model::offset::max(),
+                      ss::default_priority_class());
+                    cfg.type_filter = model::record_batch_type::raft_data;
+                    return pm.get(ntp)
+                      ->make_reader(cfg)
+                      .then([](model::record_batch_reader r) {
+                          return model::consume_reader_to_memory(
+                            std::move(r), model::no_timeout);
+                      })
+                      .then([](batches_t batches) {
+                          return ss::make_foreign(
+                            std::make_unique<batches_t>(std::move(batches)));
+                      });
+                })
+              .get0();
+        std::vector<model::record_batch> res;
+        for (const auto& b : *batches) {
+            res.push_back(b.copy());
+        }
+        return res;
+    }
+
+    static void require_valid_crc(const model::record_batch& b) {
+        BOOST_REQUIRE_EQUAL(b.header().crc, model::crc_record_batch(b));
+        BOOST_REQUIRE_EQUAL(
+          b.header().header_crc, model::internal_header_only_crc(b.header()));
+    }
+};
+
+FIXTURE_TEST(test_produce_recompresses_batch, recompression_fixture) {
+    wait_for_controller_leadership().get0();
+    start();
+
+    auto produced = make_batch(10, 100);
+    BOOST_REQUIRE_EQUAL(
+      produce_batch(produced.copy()), kafka::error_code::none);
+
+    auto stored = read_stored_batches();
+    BOOST_REQUIRE_EQUAL(stored.size(), 1);
+    const auto& hdr = stored[0].header();
+    BOOST_REQUIRE_EQUAL(hdr.attrs.compression(), model::compression::zstd);
+    BOOST_REQUIRE_EQUAL(hdr.record_count, produced.header().record_count);
+    BOOST_REQUIRE_EQUAL(
+      hdr.last_offset_delta, produced.header().last_offset_delta);
+    BOOST_REQUIRE_EQUAL(
+      hdr.first_timestamp, produced.header().first_timestamp);
+    BOOST_REQUIRE_EQUAL(hdr.max_timestamp, produced.header().max_timestamp);
+    require_valid_crc(stored[0]);
+
+    auto decompressed
+      = storage::internal::decompress_batch(stored[0].copy()).get0();
+    BOOST_REQUIRE_EQUAL(decompressed.data(), produced.data());
+}
+
+FIXTURE_TEST(test_produce_recompression_limit, recompression_fixture) {
+    // The limit applies to the uncompressed size of the batch
+    set_recompression(model::compression::zstd, 4_KiB);
+    wait_for_controller_leadership().get0();
+    start();
+
+    auto produced = storage::internal::compress_batch(
+                      model::compression::gzip, make_batch(10, 1_KiB))
+                      .get0();
+    BOOST_REQUIRE_LT(produced.size_bytes(), 4_KiB);
+    BOOST_REQUIRE_EQUAL(
+      produce_batch(produced.copy()), kafka::error_code::none);
+
+    auto stored = read_stored_batches();
+    BOOST_REQUIRE_EQUAL(stored.size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      stored[0].header().attrs.compression(), model::compression::gzip);
+    BOOST_REQUIRE_EQUAL(stored[0].data(), produced.data());
+    require_valid_crc(stored[0]);
+}
+
+FIXTURE_TEST(test_produce_recompression_failure, recompression_fixture) {
+    wait_for_controller_leadership().get0();
+    start();
+
+    // The payload is not gzip data, so the batch can't be decompressed
+    auto produced = make_batch(10, 100);
+    produced.header().attrs |= model::compression::gzip;
+    produced.header().crc = model::crc_record_batch(produced);
+    produced.header().header_crc = model::internal_header_only_crc(
+      produced.header());
+    BOOST_REQUIRE_EQUAL(
+      produce_batch(produced.copy()), kafka::error_code::none);
+
+    // The batch is written as the producer sent it
+    auto stored = read_stored_batches();
+    BOOST_REQUIRE_EQUAL(stored.size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      stored[0].header().attrs.compression(), model::compression::gzip);
+    BOOST_REQUIRE_EQUAL(stored[0].data(), produced.data());
+    require_valid_crc(stored[0]);
+}
+
+FIXTURE_TEST(
+  test_produce_recompression_batch_max_bytes, recompression_fixture) {
+    // Decompressing for a topic without compression would exceed the batch
+    // size limit of the topic
+    set_recompression(model::compression::none, 1_MiB);
+    ss::smp::invoke_on_all([] {
+        config::shard_local_cfg().kafka_batch_max_bytes.set_value(
+          uint32_t(4_KiB));
+    }).get();
+    auto reset = ss::defer([] {
+        ss::smp::invoke_on_all([] {
+            config::shard_local_cfg().kafka_batch_max_bytes.reset();
+        }).get();
+    });
+    wait_for_controller_leadership().get0();
+    start();
+
+    auto produced = storage::internal::compress_batch(
+                      model::compression::gzip, make_batch(10, 1_KiB))
+                      .get0();
+    BOOST_REQUIRE_LT(produced.size_bytes(), 4_KiB);
+    BOOST_REQUIRE_EQUAL(
+      produce_batch(produced.copy()), kafka::error_code::none);
+
+    // The batch keeps the compression of the producer
+    auto stored = read_stored_batches();
+    BOOST_REQUIRE_EQUAL(stored.size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      stored[0].header().attrs.compression(), model::compression::gzip);
+    BOOST_REQUIRE_EQUAL(stored[0].data(), produced.data());
+}
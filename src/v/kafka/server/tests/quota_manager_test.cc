@@ -0,0 +1,200 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "kafka/server/quota_manager.h"
+#include "test_utils/fixture.h"
+#include "units.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/semaphore.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+
+#include <chrono>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace kafka {
+
+/// A quota_manager on every shard, with produce and fetch byte quotas of
+/// byte_rate per client id. The byte quotas are only rebalanced by the tests.
+struct quota_manager_test_fixture {
+    static constexpr size_t byte_rate = 100_KiB;
+    using type = quota_manager::byte_quota_type;
+
+    quota_manager_test_fixture() {
+        ss::smp::invoke_on_all([] {
+            auto& cfg = config::shard_local_cfg();
+            cfg.default_window_sec.set_value(
+              std::chrono::milliseconds(std::chrono::hours(1)));
+            cfg.kafka_client_produce_byte_rate.set_value(
+              std::make_optional(byte_rate));
+            cfg.kafka_client_fetch_byte_rate.set_value(
+              std::make_optional(byte_rate));
+        }).get();
+        qm.start().get();
+        qm.invoke_on_all(&quota_manager::start).get();
+    }
+
+    ~quota_manager_test_fixture() {
+        if (!stopped) {
+            qm.stop().get();
+        }
+        ss::smp::invoke_on_all([] {
+            auto& cfg = config::shard_local_cfg();
+            cfg.default_window_sec.reset();
+            cfg.kafka_client_produce_byte_rate.reset();
+            cfg.kafka_client_fetch_byte_rate.reset();
+        }).get();
+    }
+
+    static quota_manager::byte_quota_owner owner(ss::sstring client_id) {
+        return {.principal = "", .client_id = std::move(client_id)};
+    }
+
+    /// Share of the rate of the client quota of every shard, 0 if the shard
+    /// doesn't track the quota
+    std::vector<size_t> shard_rates(type t, ss::sstring client_id) {
+        quota_manager::byte_quota_key key{
+          quota_manager::byte_quota_entity::client, t, std::move(client_id)};
+        return qm
+          .map([key](quota_manager& q) -> size_t {
+              auto it = q._byte_quotas.find(key);
+              return it == q._byte_quotas.end() ? 0 : it->second->rate;
+          })
+          .get0();
+    }
+
+    void rebalance() {
+        qm.invoke_on(quota_manager_shard, [](quota_manager& q) {
+              return q.do_rebalance_byte_quotas();
+          })
+          .get();
+    }
+
+    ss::sharded<quota_manager> qm;
+    bool stopped{false};
+};
+
+} // namespace kafka
+
+using namespace kafka;
+
+FIXTURE_TEST(test_byte_quota_shared_by_shards, quota_manager_test_fixture) {
+    // the client sends its node wide rate to every shard
+    auto delays = qm
+                    .map([](quota_manager& q) {
+                        return ss::do_with(
+                          ss::abort_source{}, [&q](ss::abort_source& as) {
+                              return q.throttle_bytes(
+                                type::produce, owner("c"), byte_rate, as);
+                          });
+                    })
+                    .get0();
+
+    // every shard has a share of the rate, so that the client is throttled
+    // to about the node wide rate rather than to byte_rate per shard
+    auto rates = shard_rates(type::produce, "c");
+    BOOST_REQUIRE_EQUAL(rates.size(), ss::smp::count);
+    auto total = std::accumulate(rates.begin(), rates.end(), size_t(0));
+    BOOST_REQUIRE_LE(total, byte_rate);
+    BOOST_REQUIRE_GE(total, byte_rate - ss::smp::count);
+    if (ss::smp::count > 1) {
+        for (auto d : delays) {
+            BOOST_REQUIRE(d >= 500ms);
+        }
+    }
+}
+
+FIXTURE_TEST(test_byte_quota_follows_usage, quota_manager_test_fixture) {
+    BOOST_REQUIRE_GT(ss::smp::count, 1);
+    ss::shard_id busy = ss::smp::count - 1;
+    qm.invoke_on_all([busy](quota_manager& q) {
+          auto bytes = ss::this_shard_id() == busy ? 10 * byte_rate : 0;
+          q.record_bytes(type::fetch, owner("c"), bytes);
+      })
+      .get();
+
+    rebalance();
+
+    auto rates = shard_rates(type::fetch, "c");
+    auto total = std::accumulate(rates.begin(), rates.end(), size_t(0));
+    BOOST_REQUIRE_LE(total, byte_rate);
+    // idle shards keep a small share
+    BOOST_REQUIRE_GT(rates[busy], byte_rate * 8 / 10);
+    for (ss::shard_id s = 0; s < busy; ++s) {
+        BOOST_REQUIRE_GT(rates[s], 0);
+        BOOST_REQUIRE_LT(rates[s], byte_rate / 10);
+    }
+
+    // the usage is taken by the rebalance, an idle round splits the rate
+    // evenly again
+    rebalance();
+    rates = shard_rates(type::fetch, "c");
+    BOOST_REQUIRE_EQUAL(rates[busy], rates[0]);
+}
+
+FIXTURE_TEST(test_fetch_debt_delays_next_request, quota_manager_test_fixture) {
+    BOOST_REQUIRE_GT(ss::smp::count, 1);
+    auto& q = qm.local();
+    // the size of a response is recorded once it is ready, the shard share
+    // of the rate puts the quota into debt of at least a second
+    q.record_bytes(type::fetch, owner("c"), byte_rate);
+
+    ss::abort_source as;
+    auto delay = q.throttle_bytes(type::fetch, owner("c"), 0, as).get0();
+    BOOST_REQUIRE(delay >= 500ms);
+
+    // other clients and produce requests are not delayed
+    delay = q.throttle_bytes(type::fetch, owner("other"), 0, as).get0();
+    BOOST_REQUIRE(delay < 250ms);
+    delay = q.throttle_bytes(type::produce, owner("c"), 0, as).get0();
+    BOOST_REQUIRE(delay < 250ms);
+}
+
+FIXTURE_TEST(test_throttled_released_on_clear, quota_manager_test_fixture) {
+    auto& q = qm.local();
+    // a debt that takes a long time to pay off
+    q.record_bytes(type::fetch, owner("c"), 20 * byte_rate);
+    ss::abort_source as;
+    auto throttled = q.throttle_bytes(type::fetch, owner("c"), 0, as);
+    ss::sleep(100ms).get();
+    BOOST_REQUIRE(!throttled.available());
+
+    ss::smp::invoke_on_all([] {
+        config::shard_local_cfg().kafka_client_fetch_byte_rate.set_value(
+          std::optional<size_t>());
+    }).get();
+    auto delay = throttled.get0();
+    BOOST_REQUIRE(delay < 10s);
+    BOOST_REQUIRE(!q.byte_quota_enabled(type::fetch));
+    BOOST_REQUIRE_EQUAL(
+      shard_rates(type::fetch, "c")[ss::this_shard_id()], 0);
+
+    // the produce quota is unaffected
+    BOOST_REQUIRE(q.byte_quota_enabled(type::produce));
+}
+
+FIXTURE_TEST(test_throttled_released_on_stop, quota_manager_test_fixture) {
+    auto& q = qm.local();
+    q.record_bytes(type::produce, owner("c"), 20 * byte_rate);
+    ss::abort_source as;
+    auto throttled = q.throttle_bytes(type::produce, owner("c"), 0, as);
+    ss::sleep(100ms).get();
+    BOOST_REQUIRE(!throttled.available());
+
+    stopped = true;
+    qm.stop().get();
+    BOOST_REQUIRE_THROW(throttled.get(), ss::broken_semaphore);
+}
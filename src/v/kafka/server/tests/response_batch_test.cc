@@ -0,0 +1,142 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/protocol_utils.h"
+#include "kafka/server/response.h"
+#include "kafka/server/response_batch.h"
+
+#include <seastar/net/packet.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <iterator>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/// A response with a payload of the given number of 1 byte fragments
+kafka::response_ptr make_response(
+  size_t fragments, kafka::flex_enabled flex = kafka::flex_enabled::no) {
+    auto r = std::make_unique<kafka::response>(flex);
+    for (size_t i = 0; i < fragments; ++i) {
+        iobuf f;
+        f.append("x", 1);
+        r->buf().append_fragments(std::move(f));
+    }
+    return ss::make_foreign(std::move(r));
+}
+
+kafka::response_ptr make_noop_response() {
+    auto r = make_response(1);
+    r->mark_noop();
+    return r;
+}
+
+size_t fragments_of(const kafka::response_ptr& r) {
+    return static_cast<size_t>(
+      std::distance(r->buf().cbegin(), r->buf().cend()));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(append_response_counts_fragments) {
+    for (auto flex : {kafka::flex_enabled::no, kafka::flex_enabled::yes}) {
+        for (size_t payload : {1, 5, 100}) {
+            ss::scattered_message<char> msg;
+            auto n = kafka::append_response(msg, make_response(payload, flex));
+            auto packet = std::move(msg).release();
+            BOOST_REQUIRE_EQUAL(n, packet.nr_frags());
+            // the header and the tagged fields add at most two fragments
+            BOOST_REQUIRE_GT(n, payload);
+            BOOST_REQUIRE_LE(n, payload + 2);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batch_coalesces_ready_responses) {
+    kafka::response_stats stats;
+    kafka::response_batch batch(stats);
+    size_t bytes = 0;
+    for (int i = 0; i < 3; ++i) {
+        auto r = make_response(2);
+        bytes += r->buf().size_bytes();
+        BOOST_REQUIRE(batch.fits(*r));
+        batch.append(std::move(r), std::nullopt);
+    }
+    BOOST_REQUIRE(!batch.empty());
+    auto packet = std::move(batch).release().release();
+    BOOST_REQUIRE_EQUAL(stats.responses, 3);
+    BOOST_REQUIRE_EQUAL(stats.writes, 1);
+    BOOST_REQUIRE_EQUAL(stats.blocked_responses, 0);
+    // framed as size and correlation id in front of every response
+    BOOST_REQUIRE_EQUAL(packet.len(), bytes + 3 * 2 * sizeof(int32_t));
+}
+
+BOOST_AUTO_TEST_CASE(batch_caps_fragments) {
+    kafka::response_stats stats;
+    kafka::response_batch batch(stats, 10);
+
+    // the first response always fits, even when larger than the cap
+    auto large = make_response(20);
+    BOOST_REQUIRE(batch.fits(*large));
+    batch.append(std::move(large), std::nullopt);
+    BOOST_REQUIRE_GT(batch.fragments(), 10);
+    BOOST_REQUIRE(!batch.fits(*make_response(1)));
+
+    kafka::response_batch next(stats, 10);
+    auto r = make_response(4);
+    BOOST_REQUIRE(next.fits(*r));
+    next.append(std::move(r), std::nullopt);
+    BOOST_REQUIRE_LE(next.fragments(), 6);
+    // the estimate of 4 + 2 fragments goes over the cap
+    auto over = make_response(4);
+    BOOST_REQUIRE_GT(next.fragments() + fragments_of(over) + 2, 10);
+    BOOST_REQUIRE(!next.fits(*over));
+    BOOST_REQUIRE(next.fits(*make_response(1)));
+}
+
+BOOST_AUTO_TEST_CASE(batch_of_noop_responses_is_empty) {
+    kafka::response_stats stats;
+    kafka::response_batch batch(stats, 1);
+    for (int i = 0; i < 3; ++i) {
+        auto r = make_noop_response();
+        // noop responses are not written and always fit
+        BOOST_REQUIRE(batch.fits(*r));
+        batch.append(std::move(r), std::nullopt);
+    }
+    BOOST_REQUIRE(batch.empty());
+    BOOST_REQUIRE_EQUAL(batch.fragments(), 0);
+    BOOST_REQUIRE_EQUAL(stats.responses, 0);
+    BOOST_REQUIRE_EQUAL(stats.writes, 0);
+
+    auto r = make_response(3);
+    batch.append(std::move(r), std::nullopt);
+    BOOST_REQUIRE(batch.fits(*make_noop_response()));
+    BOOST_REQUIRE(!batch.empty());
+    BOOST_REQUIRE_EQUAL(stats.responses, 1);
+}
+
+BOOST_AUTO_TEST_CASE(batch_accounts_blocked_responses) {
+    kafka::response_stats stats;
+    kafka::response_batch batch(stats);
+    batch.append(make_response(1), std::nullopt);
+    batch.append(make_response(1), 10us);
+    // a blocked noop response is accounted for as well
+    batch.append(make_noop_response(), 30us);
+    batch.append(make_response(1), 0us);
+    std::move(batch).release();
+
+    BOOST_REQUIRE_EQUAL(stats.responses, 3);
+    BOOST_REQUIRE_EQUAL(stats.writes, 1);
+    BOOST_REQUIRE_EQUAL(stats.blocked_responses, 3);
+    BOOST_REQUIRE(stats.blocked_time == 40us);
+    BOOST_REQUIRE(stats.max_blocked_time == 30us);
+}
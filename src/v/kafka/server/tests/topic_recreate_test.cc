@@ -99,12 +99,16 @@ public:
     ss::future<kafka::metadata_response>
     get_topic_metadata(const model::topic& tp) {
         return do_with_client([tp](kafka::client::transport& client) {
-            std::vector<kafka::metadata_request_topic> topics;
-            topics.push_back(kafka::metadata_request_topic{tp});
-            kafka::metadata_request md_req{
-              .data = {.topics = topics, .allow_auto_topic_creation = false},
-              .list_all_topics = false};
-            return client.dispatch(md_req);
+            // the request refers to the name, keep it until it is sent
+            return ss::do_with(tp, [&client](const model::topic& tp) {
+                std::vector<kafka::metadata_request_topic> topics;
+                topics.push_back(kafka::metadata_request_topic{tp});
+                kafka::metadata_request md_req{
+                  .data
+                  = {.topics = topics, .allow_auto_topic_creation = false},
+                  .list_all_topics = false};
+                return client.dispatch(md_req);
+            });
         });
     }
 
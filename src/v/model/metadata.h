@@ -435,6 +435,21 @@ operator<<(std::ostream& o, const partition_autobalancing_mode& m) {
     }
 }
 
+enum class leader_balancer_mode {
+    greedy_balanced_shards = 0,
+    throughput_balanced_shards,
+};
+
+inline std::ostream&
+operator<<(std::ostream& o, const leader_balancer_mode& m) {
+    switch (m) {
+    case model::leader_balancer_mode::greedy_balanced_shards:
+        return o << "greedy_balanced_shards";
+    case model::leader_balancer_mode::throughput_balanced_shards:
+        return o << "throughput_balanced_shards";
+    }
+}
+
 namespace internal {
 /*
  * Old version for use in backwards compatibility serialization /
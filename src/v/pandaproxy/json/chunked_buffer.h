@@ -0,0 +1,62 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/details/io_allocation_size.h"
+#include "bytes/iobuf.h"
+#include "json/stringbuffer.h"
+#include "json/writer.h"
+
+namespace pandaproxy::json {
+
+/// Output buffer for ::json::Writer that doesn't linearize the document
+///
+/// The writer appends to a small StringBuffer. Its content is moved into
+/// an iobuf whenever it grows beyond 'chunk_size', so the document is
+/// stored as a list of fragments and the StringBuffer capacity is reused.
+/// The writer keeps all of its state to itself, so the buffer can be
+/// flushed at any point of the serialization.
+class chunked_buffer {
+public:
+    static constexpr size_t default_chunk_size
+      = details::io_allocation_size::ss_max_small_allocation;
+
+    explicit chunked_buffer(size_t chunk_size = default_chunk_size)
+      : _chunk_size(chunk_size) {}
+
+    ::json::StringBuffer& buffer() { return _buf; }
+
+    /// Move the buffered data into the iobuf if there is enough of it
+    void maybe_flush() {
+        if (_buf.GetSize() >= _chunk_size) {
+            flush();
+        }
+    }
+
+    /// Move the buffered data into the iobuf
+    void flush() {
+        _out.append(_buf.GetString(), _buf.GetSize());
+        _buf.Clear();
+    }
+
+    iobuf release() && {
+        flush();
+        return std::move(_out);
+    }
+
+private:
+    size_t _chunk_size;
+    ::json::StringBuffer _buf;
+    iobuf _out;
+};
+
+} // namespace pandaproxy::json
@@ -20,6 +20,7 @@
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
+#include "pandaproxy/json/chunked_buffer.h"
 #include "pandaproxy/json/exceptions.h"
 #include "pandaproxy/json/iobuf.h"
 #include "pandaproxy/json/requests/produce.h"
@@ -27,7 +28,9 @@
 #include "pandaproxy/json/types.h"
 #include "seastarx.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 namespace pandaproxy::json {
 
@@ -72,39 +75,77 @@ public:
 
     void operator()(
       ::json::Writer<::json::StringBuffer>& w, kafka::fetch_response&& res) {
-        // Eager check for errors
+        check_errors(res);
+
+        w.StartArray();
         for (auto& v : res) {
-            if (v.partition_response->error_code != kafka::error_code::none) {
-                throw serialize_error(v.partition_response->error_code);
+            auto r = std::move(*v.partition_response);
+            model::topic_partition_view tpv(
+              v.partition->name, r.partition_index);
+            while (r.records && !r.records->empty()) {
+                serialize_batch(w, tpv, r.records->consume_batch(), [] {});
             }
         }
+        w.EndArray();
+    }
+
+    /// Serialize the response into an iobuf
+    ///
+    /// Unlike the writer based overload the response is never linearized:
+    /// the serialized records are moved into the iobuf in small chunks, and
+    /// the reactor is yielded to between record batches.
+    ss::future<iobuf> to_iobuf(kafka::fetch_response res) {
+        check_errors(res);
 
+        chunked_buffer buf;
+        ::json::Writer<::json::StringBuffer> w(buf.buffer());
         w.StartArray();
         for (auto& v : res) {
             auto r = std::move(*v.partition_response);
             model::topic_partition_view tpv(
               v.partition->name, r.partition_index);
             while (r.records && !r.records->empty()) {
-                auto adapter = r.records->consume_batch();
-                if (
-                  !adapter.batch
-                  || adapter.batch->header().attrs.is_control()) {
-                    continue;
-                }
-
-                auto rjs = rjson_serialize_impl<model::record>(
-                  _fmt, tpv, adapter.batch->base_offset());
-
-                adapter.batch->for_each_record(
-                  [&rjs, &w](model::record record) {
-                      rjs(w, std::move(record));
+                serialize_batch(
+                  w, tpv, r.records->consume_batch(), [&buf] {
+                      buf.maybe_flush();
                   });
+                co_await ss::coroutine::maybe_yield();
             }
         }
         w.EndArray();
+        co_return std::move(buf).release();
     }
 
 private:
+    static void check_errors(kafka::fetch_response& res) {
+        // Eager check for errors
+        for (auto& v : res) {
+            if (v.partition_response->error_code != kafka::error_code::none) {
+                throw serialize_error(v.partition_response->error_code);
+            }
+        }
+    }
+
+    template<typename OnRecord>
+    void serialize_batch(
+      ::json::Writer<::json::StringBuffer>& w,
+      model::topic_partition_view tpv,
+      kafka::kafka_batch_adapter adapter,
+      OnRecord on_record) {
+        if (!adapter.batch || adapter.batch->header().attrs.is_control()) {
+            return;
+        }
+
+        auto rjs = rjson_serialize_impl<model::record>(
+          _fmt, tpv, adapter.batch->base_offset());
+
+        adapter.batch->for_each_record(
+          [&rjs, &w, &on_record](model::record record) {
+              rjs(w, std::move(record));
+              on_record();
+          });
+    }
+
     serialization_format _fmt;
 };
 
@@ -97,3 +97,25 @@ SEASTAR_THREAD_TEST_CASE(test_produce_fetch_one) {
 
     BOOST_REQUIRE_EQUAL(str_buf.GetString(), expected);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_fetch_chunked) {
+    std::vector<model::topic_partition> tps = {
+      {model::topic{"topic1"}, model::partition_id{1}},
+      {model::topic{"topic2"}, model::partition_id{2}},
+    };
+    auto fmt = ppj::serialization_format::binary_v2;
+
+    ::json::StringBuffer str_buf;
+    ::json::Writer<::json::StringBuffer> w(str_buf);
+    ppj::rjson_serialize_fmt(fmt)(
+      w, make_fetch_response(tps, model::offset{42}, 1000));
+    ss::sstring expected{str_buf.GetString(), str_buf.GetSize()};
+
+    auto buf = ppj::rjson_serialize_impl<kafka::fetch_response>(fmt)
+                 .to_iobuf(make_fetch_response(tps, model::offset{42}, 1000))
+                 .get();
+
+    BOOST_REQUIRE_GT(std::distance(buf.begin(), buf.end()), 1);
+    iobuf_parser p{std::move(buf)};
+    BOOST_REQUIRE_EQUAL(p.read_string(p.bytes_left()), expected);
+}
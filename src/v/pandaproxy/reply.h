@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "kafka/client/exceptions.h"
 #include "kafka/protocol/exceptions.h"
 #include "pandaproxy/error.h"
@@ -22,7 +23,9 @@
 #include "pandaproxy/schema_registry/exceptions.h"
 #include "seastarx.h"
 
+#include <seastar/core/do_with.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/iostream.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/http/exception.hh>
 #include <seastar/http/reply.hh>
@@ -60,6 +63,25 @@ inline ss::httpd::reply& set_reply_unavailable(ss::httpd::reply& rep) {
       .add_header("Retry-After", "0");
 }
 
+/// Write the body of the reply straight from the iobuf
+///
+/// The body is written fragment by fragment into the connection's output
+/// stream, so it's never linearized into one contiguous string.
+inline void write_body(
+  ss::httpd::reply& rep, const ss::sstring& content_type, iobuf body) {
+    rep.write_body(
+      content_type,
+      [body = std::move(body)](ss::output_stream<char>&& os) mutable {
+          return ss::do_with(
+            std::move(os),
+            std::move(body),
+            [](ss::output_stream<char>& os, iobuf& body) {
+                return write_iobuf_to_output_stream(std::move(body), os)
+                  .finally([&os] { return os.close(); });
+            });
+      });
+}
+
 inline std::unique_ptr<ss::httpd::reply> reply_unavailable() {
     auto rep = std::make_unique<ss::httpd::reply>(ss::httpd::reply{});
     set_reply_unavailable(*rep);
@@ -174,36 +174,34 @@ get_topics_records(server::request_t rq, server::reply_t rp) {
       timeout,
       max_bytes);
 
-    return rq.service()
-      .client_cache()
-      .invoke_on_cache(
-        rq.user,
-        [user{rq.user},
-         authn_method{rq.authn_method},
-         offset{offset},
-         timeout{timeout},
-         max_bytes{max_bytes},
-         res_fmt,
-         tp{std::move(tp)}](kafka_client_cache& cache) mutable {
-            client_ptr client = cache.fetch_or_insert(user, authn_method);
-            return client
-              ->fetch_partition(std::move(tp), offset, max_bytes, timeout)
-              .then([res_fmt](kafka::fetch_response res) {
-                  ::json::StringBuffer str_buf;
-                  ::json::Writer<::json::StringBuffer> w(str_buf);
-
-                  ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-                  // TODO Ben: Prevent this linearization
-                  return ss::make_ready_future<ss::sstring>(
-                    str_buf.GetString());
-              })
-              .finally([client] {});
-        })
-      .then([res_fmt, rp = std::move(rp)](ss::sstring json_rslt) mutable {
-          rp.rep->write_body("json", json_rslt);
-          rp.mime_type = res_fmt;
-          return std::move(rp);
+    // the response is serialized on the shard of the client: its record
+    // batches are owned by that shard
+    auto json_rslt = co_await rq.service().client_cache().invoke_on_cache(
+      rq.user,
+      [user{rq.user},
+       authn_method{rq.authn_method},
+       offset{offset},
+       timeout{timeout},
+       max_bytes{max_bytes},
+       res_fmt{res_fmt},
+       tp{std::move(tp)}](kafka_client_cache& cache) mutable {
+          client_ptr client = cache.fetch_or_insert(user, authn_method);
+          return client
+            ->fetch_partition(std::move(tp), offset, max_bytes, timeout)
+            .then([res_fmt](kafka::fetch_response res) {
+                return ss::do_with(
+                  ppj::rjson_serialize_impl<kafka::fetch_response>(res_fmt),
+                  std::move(res),
+                  [](auto& serializer, kafka::fetch_response& res) {
+                      return serializer.to_iobuf(std::move(res));
+                  });
+            })
+            .finally([client] {});
       });
+
+    write_body(*rp.rep, "json", std::move(json_rslt));
+    rp.mime_type = res_fmt;
+    co_return std::move(rp);
 }
 
 ss::future<server::reply_t>
@@ -451,14 +449,10 @@ consumer_fetch(server::request_t rq, server::reply_t rp) {
 
         auto res = co_await client->consumer_fetch(
           group_id, name, timeout, max_bytes);
-        ::json::StringBuffer str_buf;
-        ::json::Writer<::json::StringBuffer> w(str_buf);
-
-        ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-
-        // TODO Ben: Prevent this linearization
-        ss::sstring json_rslt = str_buf.GetString();
-        rp.rep->write_body("json", json_rslt);
+        auto serializer = ppj::rjson_serialize_impl<kafka::fetch_response>(
+          res_fmt);
+        auto json_rslt = co_await serializer.to_iobuf(std::move(res));
+        write_body(*rp.rep, "json", std::move(json_rslt));
         rp.mime_type = res_fmt;
         co_return std::move(rp);
     };
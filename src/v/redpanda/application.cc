@@ -20,6 +20,7 @@
 #include "cluster/cluster_discovery.h"
 #include "cluster/cluster_utils.h"
 #include "cluster/cluster_uuid.h"
+#include "cluster/controller_api.h"
 #include "cluster/controller.h"
 #include "cluster/ephemeral_credential_frontend.h"
 #include "cluster/ephemeral_credential_service.h"
@@ -55,6 +56,7 @@
 #include "kafka/server/protocol.h"
 #include "kafka/server/queue_depth_monitor.h"
 #include "kafka/server/quota_manager.h"
+#include "kafka/server/tenant_groups.h"
 #include "kafka/server/rm_group_frontend.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -81,6 +83,7 @@
 #include "version.h"
 #include "vlog.h"
 
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/core/metrics.hh>
 #include <seastar/core/prometheus.hh>
 #include <seastar/core/seastar.hh>
@@ -136,6 +139,56 @@ static void set_sr_local_kafka_client_config(
     }
 }
 
+namespace {
+/**
+ * Measures the phases of startup. Every phase ends when the next one begins,
+ * the durations of all of them are logged once startup completes.
+ */
+class startup_timer {
+public:
+    explicit startup_timer(ss::logger& log)
+      : _log(log) {}
+
+    void begin(std::string_view phase) {
+        end_current();
+        _current = ss::sstring(phase);
+        _started = ss::lowres_clock::now();
+    }
+
+    void finish() {
+        end_current();
+        auto total = std::chrono::milliseconds(0);
+        for (const auto& [_, d] : _phases) {
+            total += d;
+        }
+        vlog(_log.info, "Startup took {} ms", total.count());
+        for (const auto& [phase, d] : _phases) {
+            vlog(_log.info, "Startup phase {}: {} ms", phase, d.count());
+        }
+    }
+
+private:
+    void end_current() {
+        if (_current.empty()) {
+            return;
+        }
+        auto d = std::chrono::duration_cast<std::chrono::milliseconds>(
+          ss::lowres_clock::now() - _started);
+        vlog(
+          _log.debug,
+          "Startup phase {} finished in {} ms",
+          _current,
+          d.count());
+        _phases.emplace_back(std::exchange(_current, {}), d);
+    }
+
+    ss::logger& _log;
+    ss::sstring _current;
+    ss::lowres_clock::time_point _started;
+    std::vector<std::pair<ss::sstring, std::chrono::milliseconds>> _phases;
+};
+} // namespace
+
 application::application(ss::sstring logger_name)
   : _log(std::move(logger_name)){};
 
@@ -363,6 +416,19 @@ void application::initialize(
     }
 
     _scheduling_groups.create_groups().get();
+    auto kafka_tenants = config::shard_local_cfg().kafka_tenant_groups();
+    if (auto available = _scheduling_groups.available_groups();
+        kafka_tenants.size() > available) {
+        vlog(
+          _log.error,
+          "Only {} scheduling groups are left, ignoring {} of "
+          "kafka_tenant_groups",
+          available,
+          kafka_tenants.size() - available);
+        kafka_tenants.resize(available);
+    }
+    _scheduling_groups.create_kafka_tenant_groups(std::move(kafka_tenants))
+      .get();
     _scheduling_groups_probe.wire_up(_scheduling_groups);
     _deferred.emplace_back([this] {
         _scheduling_groups_probe.clear();
@@ -912,6 +978,9 @@ void application::wire_up_redpanda_services(model::node_id node_id) {
     // metrics and quota management
     syschecks::systemd_message("Adding kafka quota manager").get();
     construct_service(quota_mgr).get();
+    construct_service(
+      tenant_groups, std::cref(_scheduling_groups.kafka_tenant_sgs()))
+      .get();
 
     syschecks::systemd_message("Creating metadata dissemination service").get();
     construct_service(
@@ -1429,9 +1498,13 @@ void application::start_bootstrap_services() {
 }
 
 void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
+    startup_timer timer(_log);
+    timer.begin("bootstrap services");
     wire_up_bootstrap_services();
     start_bootstrap_services();
 
+    timer.begin("cluster discovery");
+
     // Begin the cluster discovery manager so we can confirm our initial node
     // ID. A valid node ID is required before we can initialize the rest of our
     // subsystems.
@@ -1454,6 +1527,7 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
       node_id,
       storage.local().get_cluster_uuid());
 
+    timer.begin("runtime services wiring");
     wire_up_runtime_services(node_id);
 
     if (test_mode) {
@@ -1475,8 +1549,10 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
             *controller, group_router));
     }
 
+    timer.begin("runtime services start");
     start_runtime_services(cd);
 
+    timer.begin("http proxies start");
     if (_proxy_config) {
         _proxy.invoke_on_all(&pandaproxy::rest::proxy::start).get();
         vlog(
@@ -1493,10 +1569,17 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
           _schema_reg_config->schema_registry_api());
     }
 
+    timer.begin("kafka api start");
     start_kafka(node_id, app_signal);
 
+    // partitions of user topics may still be recovering in the background,
+    // the node only reports itself ready once all of them are bootstrapped
+    timer.begin("partitions bootstrap");
+    controller->get_api().local().wait_for_bootstrap().get();
+
     _admin.invoke_on_all([](admin_server& admin) { admin.set_ready(); }).get();
 
+    timer.finish();
     vlog(_log.info, "Successfully started Redpanda!");
     syschecks::systemd_notify_ready().get();
 }
@@ -1660,6 +1743,7 @@ void application::start_runtime_services(cluster::cluster_discovery& cd) {
           .get();
     }
     quota_mgr.invoke_on_all(&kafka::quota_manager::start).get();
+    tenant_groups.invoke_on_all(&kafka::tenant_groups::start).get();
 
     if (!config::node().admin().empty()) {
         _admin.invoke_on_all(&admin_server::start).get0();
@@ -1708,11 +1792,13 @@ void application::start_kafka(
       .invoke_on_all([this, qdc_config](net::server& s) {
           auto proto = std::make_unique<kafka::protocol>(
             smp_service_groups.kafka_smp_sg(),
+            _scheduling_groups.kafka_recompression_sg(),
             metadata_cache,
             controller->get_topics_frontend(),
             controller->get_config_frontend(),
             controller->get_feature_table(),
             quota_mgr,
+            tenant_groups,
             group_router,
             shard_table,
             partition_manager,
@@ -98,6 +98,7 @@ public:
     ss::sharded<kafka::fetch_session_cache> fetch_session_cache;
     smp_groups smp_service_groups;
     ss::sharded<kafka::quota_manager> quota_mgr;
+    ss::sharded<kafka::tenant_groups> tenant_groups;
     ss::sharded<cluster::id_allocator_frontend> id_allocator_frontend;
     ss::sharded<cloud_storage::remote> cloud_storage_api;
     ss::sharded<cloud_storage::partition_recovery_manager>
@@ -109,11 +109,13 @@ public:
         // used by request context builder
         proto = std::make_unique<kafka::protocol>(
           app.smp_service_groups.kafka_smp_sg(),
+          ss::default_scheduling_group(),
           app.metadata_cache,
           app.controller->get_topics_frontend(),
           app.controller->get_config_frontend(),
           app.controller->get_feature_table(),
           app.quota_mgr,
+          app.tenant_groups,
           app.group_router,
           app.shard_table,
           app.partition_manager,
@@ -16,6 +16,10 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/scheduling.hh>
+#include <seastar/core/sstring.hh>
+
+#include <utility>
+#include <vector>
 
 // manage cpu scheduling groups. scheduling groups are global, so one instance
 // of this class can be created at the top level and passed down into any server
@@ -37,6 +41,24 @@ public:
         _archival_upload = co_await ss::create_scheduling_group(
           "archival_upload", 100);
         _node_status = co_await ss::create_scheduling_group("node_status", 50);
+        _kafka_recompression = co_await ss::create_scheduling_group(
+          "kafka_recompression", 100);
+    }
+
+    // scheduling groups supported by seastar that are not created yet
+    size_t available_groups() const {
+        return ss::max_scheduling_groups() - all_scheduling_groups().size();
+    }
+
+    // scheduling groups of the kafka tenants, created once on startup with
+    // the shares of the kafka group. kafka::tenant_groups sets their shares.
+    // The names must fit available_groups().
+    ss::future<> create_kafka_tenant_groups(std::vector<ss::sstring> names) {
+        for (auto& name : names) {
+            auto sg = co_await ss::create_scheduling_group(
+              "kafka_tenant_" + name, 1000);
+            _kafka_tenants.emplace_back(std::move(name), sg);
+        }
     }
 
     ss::future<> destroy_groups() {
@@ -50,6 +72,11 @@ public:
         co_await destroy_scheduling_group(_raft_learner_recovery);
         co_await destroy_scheduling_group(_archival_upload);
         co_await destroy_scheduling_group(_node_status);
+        co_await destroy_scheduling_group(_kafka_recompression);
+        for (auto& [_, sg] : _kafka_tenants) {
+            co_await destroy_scheduling_group(sg);
+        }
+        _kafka_tenants.clear();
         co_return;
     }
 
@@ -67,22 +94,35 @@ public:
     }
     ss::scheduling_group archival_upload() { return _archival_upload; }
     ss::scheduling_group node_status() { return _node_status; }
+    ss::scheduling_group kafka_recompression_sg() {
+        return _kafka_recompression;
+    }
+    const std::vector<std::pair<ss::sstring, ss::scheduling_group>>&
+    kafka_tenant_sgs() const {
+        return _kafka_tenants;
+    }
 
     std::vector<std::reference_wrapper<const ss::scheduling_group>>
     all_scheduling_groups() const {
-        return {
-          std::cref(_default),
-          std::cref(_admin),
-          std::cref(_raft),
-          std::cref(_kafka),
-          std::cref(_cluster),
-          std::cref(_coproc),
-          std::cref(_cache_background_reclaim),
-          std::cref(_compaction),
-          std::cref(_raft_learner_recovery),
-          std::cref(_archival_upload),
-          std::cref(_node_status),
-        };
+        std::vector<std::reference_wrapper<const ss::scheduling_group>>
+          groups{
+            std::cref(_default),
+            std::cref(_admin),
+            std::cref(_raft),
+            std::cref(_kafka),
+            std::cref(_cluster),
+            std::cref(_coproc),
+            std::cref(_cache_background_reclaim),
+            std::cref(_compaction),
+            std::cref(_raft_learner_recovery),
+            std::cref(_archival_upload),
+            std::cref(_node_status),
+            std::cref(_kafka_recompression),
+          };
+        for (const auto& [_, sg] : _kafka_tenants) {
+            groups.push_back(std::cref(sg));
+        }
+        return groups;
     }
 
 private:
@@ -98,4 +138,6 @@ private:
     ss::scheduling_group _raft_learner_recovery;
     ss::scheduling_group _archival_upload;
     ss::scheduling_group _node_status;
+    ss::scheduling_group _kafka_recompression;
+    std::vector<std::pair<ss::sstring, ss::scheduling_group>> _kafka_tenants;
 };
@@ -55,7 +55,8 @@ enum class resource_type : int8_t {
 
 template<typename T>
 inline resource_type get_resource_type() {
-    if constexpr (std::is_same_v<T, model::topic>) {
+    if constexpr (
+      std::is_same_v<T, model::topic> || std::is_same_v<T, model::topic_view>) {
         return resource_type::topic;
     } else if constexpr (std::is_same_v<T, kafka::group_id>) {
         return resource_type::group;
@@ -101,20 +101,21 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
     }
 
     /*
-     * the acls are sorted within (resource-type, pattern-type) bounds by name
-     * in reverse order so longer names (prefixes) appear first.
+     * a prefixed pattern can only match if its name is a prefix of `name`, so
+     * probe for a pattern at each distinct prefix length that is in use. the
+     * lengths are visited longest first, like the ordering of the acls.
      */
     std::vector<acl_matches::entry_set_ref> prefixes;
-    {
-        auto it = _acls.lower_bound(
-          resource_pattern(resource, name, pattern_type::prefixed));
-
-        auto end = _acls.upper_bound(resource_pattern(
-          resource, name.substr(0, 1), pattern_type::prefixed));
-
-        for (; it != end; ++it) {
-            if (std::string_view(name).starts_with(it->first.name())) {
-                prefixes.emplace_back(it->second);
+    if (const auto lengths = _prefix_lengths.find(resource);
+        lengths != _prefix_lengths.end()) {
+        for (auto it = lengths->second.lower_bound(name.size());
+             it != lengths->second.end();
+             ++it) {
+            const resource_pattern prefix_pattern(
+              resource, name.substr(0, it->first), pattern_type::prefixed);
+            if (const auto acl = _acls.find(prefix_pattern);
+                acl != _acls.end()) {
+                prefixes.emplace_back(acl->second);
             }
         }
     }
@@ -185,6 +186,19 @@ std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
               }
               return false;
           });
+
+        // drop patterns without entries so that they are no longer probed
+        // for when searching for matching prefixes.
+        if (!dry_run && it->second.empty()) {
+            if (resource.pattern() == pattern_type::prefixed) {
+                remove_prefix_length(resource);
+            }
+            _acls.erase(it);
+        }
+    }
+
+    if (!dry_run) {
+        ++_version;
     }
 
     std::vector<std::vector<acl_binding>> res;
@@ -197,6 +211,27 @@ std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
     return res;
 }
 
+void acl_store::add_prefix_length(const resource_pattern& pattern) {
+    ++_prefix_lengths[pattern.resource()][pattern.name().size()];
+}
+
+void acl_store::remove_prefix_length(const resource_pattern& pattern) {
+    auto lengths = _prefix_lengths.find(pattern.resource());
+    if (lengths == _prefix_lengths.end()) {
+        return;
+    }
+    auto it = lengths->second.find(pattern.name().size());
+    if (it == lengths->second.end()) {
+        return;
+    }
+    if (--it->second == 0) {
+        lengths->second.erase(it);
+        if (lengths->second.empty()) {
+            _prefix_lengths.erase(lengths);
+        }
+    }
+}
+
 std::vector<acl_binding>
 acl_store::acls(const acl_binding_filter& filter) const {
     std::vector<acl_binding> result;
@@ -12,6 +12,7 @@
 #include "security/acl.h"
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
 namespace security {
@@ -117,10 +118,16 @@ public:
 
     void add_bindings(const std::vector<acl_binding>& bindings) {
         for (auto& binding : bindings) {
-            auto& entries = _acls[binding.pattern()];
-            entries.insert(binding.entry());
-            entries.rehash();
+            auto [it, inserted] = _acls.try_emplace(binding.pattern());
+            if (
+              inserted
+              && binding.pattern().pattern() == pattern_type::prefixed) {
+                add_prefix_length(binding.pattern());
+            }
+            it->second.insert(binding.entry());
+            it->second.rehash();
         }
+        ++_version;
     }
 
     // remove bindings according the input filters and return the bindings that
@@ -132,7 +139,16 @@ public:
     std::vector<acl_binding> acls(const acl_binding_filter&) const;
     acl_matches find(resource_type, const ss::sstring&) const;
 
+    /*
+     * Bumped on every change to the set of bindings. Consumers that memoize
+     * results derived from the store use it to detect stale entries.
+     */
+    uint64_t version() const { return _version; }
+
 private:
+    void add_prefix_length(const resource_pattern&);
+    void remove_prefix_length(const resource_pattern&);
+
     /*
      * resource pattern ordering:
      *
@@ -155,6 +171,17 @@ private:
 
     absl::btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>
       _acls;
+
+    /*
+     * Distinct lengths of prefixed pattern names per resource type, along
+     * with the number of patterns of each length. Matching prefixes for a
+     * name are found with one lookup per length instead of scanning every
+     * prefixed pattern that sorts between the name and its first character.
+     */
+    using prefix_lengths = absl::btree_map<size_t, size_t, std::greater<>>;
+    absl::flat_hash_map<resource_type, prefix_lengths> _prefix_lengths;
+
+    uint64_t _version{0};
 };
 
 } // namespace security
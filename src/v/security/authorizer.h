@@ -21,9 +21,12 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 #include <fmt/core.h>
 
+#include <string_view>
+
 namespace security {
 
 /*
@@ -36,21 +39,33 @@ namespace security {
  * perform any operation. When authorization occurs if the assocaited principal
  * is found in the set of superusers then its request will be permitted. If the
  * principal is not a superuser then normal ACL authorization applies.
+ *
+ * decision cache
+ * ==============
+ *
+ * The outcome of ACL authorization is memoized per (principal, host,
+ * resource, operation). The authorizer is instantiated on each shard so the
+ * cache is shard-local. It is bounded in size and it is dropped whenever the
+ * version of the ACL store changes.
  */
 class authorizer final {
 public:
     // allow operation when no ACL match is found
     using allow_empty_matches = ss::bool_class<struct allow_empty_matches_type>;
 
+    static constexpr size_t default_decision_cache_size = 4096;
+
     explicit authorizer(
       std::function<config::binding<std::vector<ss::sstring>>()> superusers_cb)
       : authorizer(allow_empty_matches::no, superusers_cb) {}
 
     authorizer(
       allow_empty_matches allow,
-      std::function<config::binding<std::vector<ss::sstring>>()> superusers_cb)
+      std::function<config::binding<std::vector<ss::sstring>>()> superusers_cb,
+      size_t decision_cache_size = default_decision_cache_size)
       : _superusers_conf(superusers_cb())
-      , _allow_empty_matches(allow) {
+      , _allow_empty_matches(allow)
+      , _decision_cache_size(decision_cache_size) {
         update_superusers();
         _superusers_conf.watch([this]() { update_superusers(); });
     }
@@ -94,13 +109,56 @@ public:
       acl_operation operation,
       const acl_principal& principal,
       const acl_host& host) const {
-        auto type = get_resource_type<T>();
-        auto acls = _store.find(type, resource_name());
-
         if (_superusers.contains(principal)) {
             return true;
         }
 
+        auto type = get_resource_type<T>();
+        if (_decision_cache_version != _store.version()) {
+            _decision_cache.clear();
+            _decision_cache_version = _store.version();
+        }
+
+        // look up without copying, the owned key is built on a miss
+        decision_key_view view{
+          .principal = principal,
+          .host = host,
+          .resource = type,
+          .name = resource_name(),
+          .operation = operation,
+        };
+        if (auto it = _decision_cache.find(view);
+            it != _decision_cache.end()) {
+            return it->second;
+        }
+
+        decision_key key{
+          .principal = principal,
+          .host = host,
+          .resource = type,
+          .name = ss::sstring(view.name),
+          .operation = operation,
+        };
+        auto decision = do_authorized(
+          type, key.name, operation, principal, host);
+        if (_decision_cache.size() >= _decision_cache_size) {
+            // the cache only needs to cover the working set of a shard, so
+            // start over instead of tracking recency of every entry.
+            _decision_cache.clear();
+        }
+        _decision_cache.emplace(std::move(key), decision);
+        return decision;
+    }
+
+private:
+    bool do_authorized(
+      resource_type type,
+      const ss::sstring& resource_name,
+      acl_operation operation,
+      const acl_principal& principal,
+      const acl_host& host) const {
+        auto acls = _store.find(type, resource_name);
+
         if (acls.empty()) {
             return bool(_allow_empty_matches);
         }
@@ -121,6 +179,78 @@ public:
           });
     }
 
+    struct decision_key_view {
+        const acl_principal& principal;
+        const acl_host& host;
+        resource_type resource;
+        std::string_view name;
+        acl_operation operation;
+
+        friend bool
+        operator==(const decision_key_view& a, const decision_key_view& b) {
+            return a.principal == b.principal && a.host == b.host
+                   && a.resource == b.resource && a.name == b.name
+                   && a.operation == b.operation;
+        }
+
+        template<typename H>
+        friend H AbslHashValue(H h, const decision_key_view& k) {
+            return H::combine(
+              std::move(h),
+              k.principal,
+              k.host,
+              k.resource,
+              k.name,
+              k.operation);
+        }
+    };
+
+    struct decision_key {
+        acl_principal principal;
+        acl_host host;
+        resource_type resource;
+        ss::sstring name;
+        acl_operation operation;
+
+        decision_key_view view() const {
+            return {
+              .principal = principal,
+              .host = host,
+              .resource = resource,
+              .name = name,
+              .operation = operation,
+            };
+        }
+    };
+
+    // heterogeneous lookup of owned keys by views
+    struct decision_key_hash {
+        using is_transparent = void;
+
+        size_t operator()(const decision_key_view& k) const {
+            return absl::Hash<decision_key_view>{}(k);
+        }
+        size_t operator()(const decision_key& k) const {
+            return (*this)(k.view());
+        }
+    };
+
+    struct decision_key_eq {
+        using is_transparent = void;
+
+        static decision_key_view view(const decision_key& k) {
+            return k.view();
+        }
+        static decision_key_view view(const decision_key_view& k) {
+            return k;
+        }
+
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return view(a) == view(b);
+        }
+    };
+
 private:
     acl_store _store;
 
@@ -142,6 +272,12 @@ private:
     }
 
     allow_empty_matches _allow_empty_matches;
+
+    size_t _decision_cache_size;
+    mutable absl::
+      flat_hash_map<decision_key, bool, decision_key_hash, decision_key_eq>
+        _decision_cache;
+    mutable uint64_t _decision_cache_version{0};
 };
 
 } // namespace security
@@ -687,6 +687,101 @@ BOOST_AUTO_TEST_CASE(single_char) {
       !auth.authorized(model::topic("foo_"), acl_operation::read, user, host));
 }
 
+BOOST_AUTO_TEST_CASE(prefix_lengths) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+
+    auto auth = make_test_instance();
+
+    auto add_pre = [&auth](ss::sstring name, const acl_entry& acl) {
+        std::vector<acl_binding> bindings;
+        bindings.emplace_back(
+          resource_pattern(resource_type::topic, name, pattern_type::prefixed),
+          acl);
+        auth.add_bindings(bindings);
+    };
+
+    auto remove_pre = [&auth](ss::sstring name) {
+        std::vector<acl_binding_filter> filters;
+        filters.emplace_back(
+          resource_pattern_filter(resource_pattern(
+            resource_type::topic, name, pattern_type::prefixed)),
+          acl_entry_filter::any());
+        auth.remove_bindings(filters);
+    };
+
+    add_pre("fo", allow_read_acl);
+    add_pre("foo-bar", deny_read_acl);
+    add_pre("bar", deny_read_acl);
+
+    BOOST_REQUIRE(
+      auth.authorized(model::topic("foo"), acl_operation::read, user, host));
+    BOOST_REQUIRE(!auth.authorized(
+      model::topic("foo-bar"), acl_operation::read, user, host));
+    BOOST_REQUIRE(!auth.authorized(
+      model::topic("foo-baz"), acl_operation::write, user, host));
+
+    // dry run removal leaves acls and cached decisions in place
+    {
+        std::vector<acl_binding_filter> filters;
+        filters.emplace_back(
+          resource_pattern_filter(resource_pattern(
+            resource_type::topic, "foo-bar", pattern_type::prefixed)),
+          acl_entry_filter::any());
+        auth.remove_bindings(filters, true);
+    }
+    BOOST_REQUIRE(!auth.authorized(
+      model::topic("foo-bar"), acl_operation::read, user, host));
+
+    // removing the longer prefix invalidates the cached deny
+    remove_pre("foo-bar");
+    BOOST_REQUIRE(auth.authorized(
+      model::topic("foo-bar"), acl_operation::read, user, host));
+
+    // adding an acl invalidates the cached allow
+    add_pre("foo", deny_read_acl);
+    BOOST_REQUIRE(!auth.authorized(
+      model::topic("foo-bar"), acl_operation::read, user, host));
+
+    remove_pre("foo");
+    remove_pre("fo");
+    BOOST_REQUIRE(
+      !auth.authorized(model::topic("foo"), acl_operation::read, user, host));
+}
+
+BOOST_AUTO_TEST_CASE(decision_cache_bounded) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+
+    auto auth = authorizer(
+      authorizer::allow_empty_matches::no,
+      []() {
+          return config::mock_binding<std::vector<ss::sstring>>(
+            std::vector<ss::sstring>{});
+      },
+      4);
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(prefixed_resource, allow_read_acl);
+    auth.add_bindings(bindings);
+
+    // decisions stay correct while the cache is repeatedly filled up
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            BOOST_REQUIRE(auth.authorized(
+              model::topic(fmt::format("foo-{}", j)),
+              acl_operation::read,
+              user,
+              host));
+            BOOST_REQUIRE(!auth.authorized(
+              model::topic(fmt::format("bar-{}", j)),
+              acl_operation::read,
+              user,
+              host));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(get_acls_principal) {
     acl_principal user(principal_type::user, "alice");
 
@@ -22,6 +22,7 @@
 #include "vlog.h"
 
 #include <seastar/core/metrics.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
@@ -380,6 +381,7 @@ ss::future<> kvstore::recover() {
         load_snapshot_in_thread();
 
         auto dir = std::filesystem::path(_ntpc.work_directory());
+        ss::recursive_touch_directory(dir.string()).get();
         auto segments
           = recover_segments(
               std::move(dir),
@@ -16,6 +16,7 @@
 #include "resource_mgmt/io_priority.h"
 #include "ssx/async-clear.h"
 #include "ssx/future-util.h"
+#include "storage/api.h"
 #include "storage/batch_cache.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/fs_utils.h"
@@ -242,6 +243,48 @@ ss::future<> log_manager::recover_log_state(const ntp_config& cfg) {
       });
 }
 
+ss::future<> log_manager::create_work_directory(const ntp_config& cfg) {
+    auto topic_dir = cfg.topic_directory().string();
+    auto path = cfg.work_directory();
+    if (auto it = _topic_dir_creation.find(topic_dir);
+        it != _topic_dir_creation.end()) {
+        co_await it->second.get_shared_future();
+    } else {
+        auto& done = _topic_dir_creation[topic_dir];
+        auto f = done.get_shared_future();
+        std::exception_ptr ex;
+        try {
+            co_await ss::recursive_touch_directory(topic_dir);
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        if (ex) {
+            done.set_exception(ex);
+        } else {
+            done.set_value();
+        }
+        _topic_dir_creation.erase(topic_dir);
+        co_await std::move(f);
+    }
+
+    bool created = true;
+    try {
+        co_await ss::touch_directory(path);
+    } catch (const std::filesystem::filesystem_error& e) {
+        // topic directory may be removed by a concurrent removal of the last
+        // partition of the topic, fall back to creating all the parents
+        if (e.code() != std::errc::no_such_file_or_directory) {
+            throw;
+        }
+        created = false;
+    }
+    if (created) {
+        co_await ss::sync_directory(topic_dir);
+    } else {
+        co_await ss::recursive_touch_directory(path);
+    }
+}
+
 ss::future<log> log_manager::do_manage(ntp_config cfg) {
     if (_config.base_dir.empty()) {
         throw std::runtime_error(
@@ -272,6 +315,7 @@ ss::future<log> log_manager::do_manage(ntp_config cfg) {
     }
 
     co_await recover_log_state(cfg);
+    co_await create_work_directory(cfg);
 
     ss::sstring path = cfg.work_directory();
     with_cache cache_enabled = cfg.cache_enabled();
@@ -307,6 +351,55 @@ ss::future<> log_manager::shutdown(model::ntp ntp) {
     co_await clean_close(handle.mapped()->handle);
 }
 
+ss::future<> log_manager::move_persistent_state(
+  model::ntp ntp,
+  ss::shard_id source_shard,
+  ss::shard_id target_shard,
+  ss::sharded<api>& api) {
+    struct log_state {
+        std::optional<iobuf> start_offset;
+        std::optional<iobuf> clean_segment;
+    };
+    using state_ptr = std::unique_ptr<log_state>;
+    vlog(
+      stlog.debug,
+      "moving {} log state from {} to {}",
+      ntp,
+      source_shard,
+      target_shard);
+    static constexpr auto ks = kvstore::key_space::storage;
+    auto state = co_await api.invoke_on(
+      source_shard, [&ntp](storage::api& api) {
+          log_state st{
+            .start_offset = api.kvs().get(
+              ks, internal::start_offset_key(ntp)),
+            .clean_segment = api.kvs().get(
+              ks, internal::clean_segment_key(ntp)),
+          };
+          return ss::make_foreign<state_ptr>(
+            std::make_unique<log_state>(std::move(st)));
+      });
+
+    co_await api.invoke_on(
+      target_shard,
+      [&ntp, state = std::move(state)](storage::api& api) -> ss::future<> {
+          // keys missing on the source shard are removed, the target shard
+          // may have a stale state from the time it managed the log before.
+          // the source state is kept so that the move can be retried
+          auto put_or_remove = [&api](
+                                 bytes key, const std::optional<iobuf>& value) {
+              if (value) {
+                  return api.kvs().put(ks, std::move(key), value->copy());
+              }
+              return api.kvs().remove(ks, std::move(key));
+          };
+          co_await put_or_remove(
+            internal::start_offset_key(ntp), state->start_offset);
+          co_await put_or_remove(
+            internal::clean_segment_key(ntp), state->clean_segment);
+      });
+}
+
 ss::future<> log_manager::remove(model::ntp ntp) {
     vlog(stlog.info, "Asked to remove: {}", ntp);
     return ss::with_gate(_open_gate, [this, ntp = std::move(ntp)] {
@@ -16,6 +16,7 @@
 #include "random/simple_time_jitter.h"
 #include "seastarx.h"
 #include "storage/batch_cache.h"
+#include "storage/fwd.h"
 #include "storage/log.h"
 #include "storage/log_housekeeping_meta.h"
 #include "storage/ntp_config.h"
@@ -34,10 +35,13 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/scheduling.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/sharded.hh>
 #include <seastar/core/sstring.hh>
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
+#include <absl/container/node_hash_map.h>
 
 #include <array>
 #include <chrono>
@@ -207,6 +211,18 @@ public:
      */
     ss::future<> remove(model::ntp);
 
+    /**
+     * Moves the kvstore state of a log which is not managed by any shard from
+     * the source shard to the target one, so that the log can be managed by
+     * the target shard without recovery. Used when a partition is moved
+     * between the cores of a node.
+     */
+    static ss::future<> move_persistent_state(
+      model::ntp,
+      ss::shard_id source_shard,
+      ss::shard_id target_shard,
+      ss::sharded<api>&);
+
     ss::future<> stop();
 
     ss::future<ss::lw_shared_ptr<segment>> make_log_segment(
@@ -257,6 +273,7 @@ private:
     std::optional<batch_cache_index> create_cache(with_cache);
 
     ss::future<> dispatch_topic_dir_deletion(ss::sstring dir);
+    ss::future<> create_work_directory(const ntp_config&);
     ss::future<> recover_log_state(const ntp_config&);
     ss::future<> async_clear_logs();
 
@@ -272,6 +289,13 @@ private:
     batch_cache _batch_cache;
     ss::gate _open_gate;
     ss::abort_source _abort_source;
+    /**
+     * Topic directories being created. Creating a directory together with its
+     * parents syncs every one of them, partitions of the same topic created at
+     * once wait for a single creation of the topic directory and then only
+     * create their own directory.
+     */
+    absl::node_hash_map<ss::sstring, ss::shared_promise<>> _topic_dir_creation;
 
     friend std::ostream& operator<<(std::ostream&, const log_manager&);
 };
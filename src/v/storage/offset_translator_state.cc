@@ -16,27 +16,36 @@
 namespace storage {
 
 int64_t offset_translator_state::delta(model::offset o) const {
-    if (_last_offset2batch.empty()) {
+    if (_batches.empty()) {
         return 0;
     }
 
-    auto it = _last_offset2batch.lower_bound(o);
-    if (it == _last_offset2batch.begin()) {
+    batches_map::reader reader(_batches);
+    return delta(reader, reader.lower_bound(o), o);
+}
+
+int64_t offset_translator_state::delta(
+  batches_map::reader& reader, size_t ix, model::offset o) const {
+    if (ix == 0) {
         throw std::runtime_error{fmt::format(
           "ntp {}: log offset {} is outside the translation range (starting at "
           "{})",
           _ntp,
           o,
-          model::next_offset(_last_offset2batch.begin()->first))};
+          model::next_offset(_batches.front().last_offset))};
     }
 
-    auto delta = std::prev(it)->second.next_delta;
-    if (it == _last_offset2batch.end() || o < it->second.base_offset) {
+    auto delta = reader.get(ix - 1).next_delta;
+    if (ix == _batches.size()) {
+        return delta;
+    }
+    const auto& next = reader.get(ix);
+    if (o < next.base_offset) {
         return delta;
     } else {
         // The offset is inside the non-data batch, so the data offset stops
         // increasing at the base offset.
-        return delta + (o - it->second.base_offset);
+        return delta + (o - next.base_offset);
     }
 }
 
@@ -45,9 +54,31 @@ model::offset offset_translator_state::from_log_offset(model::offset o) const {
     return model::offset(o - d);
 }
 
+void offset_translator_state::from_log_offsets(
+  std::vector<model::offset>& offsets) const {
+    if (_batches.empty() || offsets.empty()) {
+        return;
+    }
+
+    batches_map::reader reader(_batches);
+    size_t ix = reader.lower_bound(offsets.front());
+    model::offset prev = offsets.front();
+    for (auto& o : offsets) {
+        // the interval found for the previous offset is reused as long as the
+        // offset falls into it, the map is searched again otherwise
+        if (
+          o < prev
+          || (ix < _batches.size() && reader.get(ix).last_offset < o)) {
+            ix = reader.lower_bound(o);
+        }
+        prev = o;
+        o = model::offset(o - delta(reader, ix, o));
+    }
+}
+
 model::offset offset_translator_state::to_log_offset(
   model::offset data_offset, model::offset hint) const {
-    if (_last_offset2batch.empty()) {
+    if (_batches.empty()) {
         return data_offset;
     }
 
@@ -55,12 +86,11 @@ model::offset offset_translator_state::to_log_offset(
         return data_offset;
     }
 
-    model::offset min_log_offset = model::next_offset(
-      _last_offset2batch.begin()->first);
+    const auto front = _batches.front();
+    model::offset min_log_offset = model::next_offset(front.last_offset);
 
-    model::offset min_data_offset
-      = min_log_offset
-        - model::offset(_last_offset2batch.begin()->second.next_delta);
+    model::offset min_data_offset = min_log_offset
+                                    - model::offset(front.next_delta);
     if (data_offset < min_data_offset) {
         throw std::runtime_error{fmt::format(
           "ntp {}: data offset {} is outside the translation range (starting "
@@ -78,74 +108,68 @@ model::offset offset_translator_state::to_log_offset(
     // log offset equal to `data_offset` (because log offset is at least as
     // big as data offset) and stopping when we find the interval where
     // given data offset is achievable.
-    auto interval_end_it = _last_offset2batch.lower_bound(search_start);
+    batches_map::reader reader(_batches);
+    auto interval_end_ix = reader.lower_bound(search_start);
     vassert(
-      interval_end_it != _last_offset2batch.begin(),
+      interval_end_ix != 0,
       "ntp {}: log offset search start too small: {}",
+      _ntp,
       search_start);
-    auto delta = std::prev(interval_end_it)->second.next_delta;
+    auto delta = reader.get(interval_end_ix - 1).next_delta;
 
-    while (interval_end_it != _last_offset2batch.end()) {
+    for (; interval_end_ix < _batches.size(); ++interval_end_ix) {
+        const auto& interval_end = reader.get(interval_end_ix);
         model::offset max_do_this_interval
-          = model::prev_offset(interval_end_it->second.base_offset)
+          = model::prev_offset(interval_end.base_offset)
             - model::offset{delta};
         if (max_do_this_interval >= data_offset) {
             break;
         }
 
-        delta = interval_end_it->second.next_delta;
-        ++interval_end_it;
+        delta = interval_end.next_delta;
     }
 
     return data_offset + model::offset(delta);
 }
 
 int64_t offset_translator_state::last_delta() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->second.next_delta;
+    return _batches.back().next_delta;
 }
 
 model::offset offset_translator_state::last_gap_offset() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->first;
+    return _batches.back().last_offset;
 }
 
 void offset_translator_state::add_gap(
   model::offset base_offset, model::offset last_offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto rbegin = _last_offset2batch.rbegin();
+    const auto back = _batches.back();
     vassert(
-      base_offset > rbegin->first,
+      base_offset > back.last_offset,
       "ntp {}: trying to add batch to offset translator at offset {} that "
       "is not higher than the previous last offset {}",
       _ntp,
       base_offset,
-      rbegin->first);
+      back.last_offset);
 
     int64_t length = last_offset() - base_offset() + 1;
-    int64_t next_delta = rbegin->second.next_delta + length;
-    _last_offset2batch.emplace(
-      last_offset,
-      batch_info{.base_offset = base_offset, .next_delta = next_delta});
+    int64_t next_delta = back.next_delta + length;
+    _batches.push_back(batch_info{
+      .last_offset = last_offset,
+      .base_offset = base_offset,
+      .next_delta = next_delta});
 }
 
 bool offset_translator_state::add_absolute_delta(
   model::offset offset, int64_t delta) {
     auto prev = model::prev_offset(offset);
 
-    if (_last_offset2batch.empty()) {
+    if (_batches.empty()) {
         vassert(
           delta <= offset(),
           "ntp {}: inconsistent add_absolute_delta: delta {} can't be > offset "
@@ -155,15 +179,18 @@ bool offset_translator_state::add_absolute_delta(
           offset);
 
         model::offset base_offset = offset - model::offset{delta};
-        _last_offset2batch.emplace(
-          prev, batch_info{.base_offset = base_offset, .next_delta = delta});
+        _batches.push_back(batch_info{
+          .last_offset = prev,
+          .base_offset = base_offset,
+          .next_delta = delta});
         return true;
     } else {
-        int64_t last_delta = _last_offset2batch.rbegin()->second.next_delta;
+        const auto back = _batches.back();
+        int64_t last_delta = back.next_delta;
         int64_t gap_length = delta - last_delta;
 
         if (gap_length != 0) {
-            model::offset last_offset = _last_offset2batch.rbegin()->first;
+            model::offset last_offset = back.last_offset;
             auto base_offset = offset - model::offset{gap_length};
             vassert(
               base_offset > last_offset && base_offset < offset,
@@ -175,9 +202,10 @@ bool offset_translator_state::add_absolute_delta(
               last_offset,
               last_delta);
 
-            _last_offset2batch.emplace(
-              prev,
-              batch_info{.base_offset = base_offset, .next_delta = delta});
+            _batches.push_back(batch_info{
+              .last_offset = prev,
+              .base_offset = base_offset,
+              .next_delta = delta});
             return true;
         } else {
             return false;
@@ -186,33 +214,32 @@ bool offset_translator_state::add_absolute_delta(
 }
 
 bool offset_translator_state::truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.lower_bound(offset);
-    if (it == _last_offset2batch.begin()) {
+    batches_map::reader reader(_batches);
+    auto ix = reader.lower_bound(offset);
+    if (ix == 0) {
         throw std::runtime_error{fmt::format(
           "ntp {}: trying to truncate offset_translator at offset {} which is "
           "<= base translation offset {}",
           _ntp,
           offset,
-          _last_offset2batch.begin()->first)};
+          _batches.front().last_offset)};
     }
 
-    if (it != _last_offset2batch.end()) {
-        if (offset > it->second.base_offset) {
+    if (ix != _batches.size()) {
+        const auto& batch = reader.get(ix);
+        if (offset > batch.base_offset) {
             throw std::runtime_error{fmt::format(
               "ntp {}: trying to truncate offset_translator at offset {} which "
               "is in the middle of the batch [{},{}]",
               _ntp,
               offset,
-              it->second.base_offset,
-              it->first)};
+              batch.base_offset,
+              batch.last_offset)};
         }
 
-        _last_offset2batch.erase(it, _last_offset2batch.end());
+        _batches.truncate(ix);
         return true;
     }
 
@@ -220,38 +247,298 @@ bool offset_translator_state::truncate(model::offset offset) {
 }
 
 bool offset_translator_state::prefix_truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.upper_bound(offset);
-    if (it != _last_offset2batch.end() && offset >= it->second.base_offset) {
-        throw std::runtime_error{fmt::format(
-          "ntp {}: trying to prefix truncate offset translator at offset {} "
-          "which is in the middle of the batch {}-{}",
-          _ntp,
-          offset,
-          it->second.base_offset,
-          it->first)};
+    batches_map::reader reader(_batches);
+    auto ix = reader.upper_bound(offset);
+    if (ix != _batches.size()) {
+        const auto& batch = reader.get(ix);
+        if (offset >= batch.base_offset) {
+            throw std::runtime_error{fmt::format(
+              "ntp {}: trying to prefix truncate offset translator at offset "
+              "{} which is in the middle of the batch {}-{}",
+              _ntp,
+              offset,
+              batch.base_offset,
+              batch.last_offset)};
+        }
     }
 
-    if (it == _last_offset2batch.begin()) {
+    if (ix == 0) {
         return false;
     }
 
-    auto prev_it = std::prev(it);
-    if (prev_it == _last_offset2batch.begin() && prev_it->first == offset) {
+    if (ix == 1 && _batches.front().last_offset == offset) {
         return false;
     }
 
-    auto base_batch = prev_it->second;
+    auto base_batch = reader.get(ix - 1);
+    base_batch.last_offset = offset;
     base_batch.base_offset = offset;
-    _last_offset2batch.erase(_last_offset2batch.begin(), it);
-    _last_offset2batch.emplace(offset, base_batch);
+    _batches.replace_prefix(ix, base_batch);
     return true;
 }
 
+offset_translator_state::batches_map::batches_map()
+  : _columns{encoder_t(0), encoder_t(0), encoder_t(0)} {}
+
+offset_translator_state::batch_info
+offset_translator_state::batches_map::front() const {
+    // the first entry is always kept in the head
+    return _head.front();
+}
+
+offset_translator_state::batch_info
+offset_translator_state::batches_map::back() const {
+    if (!_tail.empty()) {
+        return _tail.back();
+    }
+    if (!_blocks.empty()) {
+        return _blocks.back().last;
+    }
+    return _head.back();
+}
+
+void offset_translator_state::batches_map::push_back(batch_info batch) {
+    if (empty()) {
+        _head.push_back(batch);
+        return;
+    }
+    _tail.push_back(batch);
+    if (_tail.size() == block_size) {
+        seal_tail();
+    }
+}
+
+void offset_translator_state::batches_map::truncate(size_t n) {
+    if (n >= size()) {
+        return;
+    }
+    if (n <= _head.size()) {
+        _head.resize(n);
+        drop_back_blocks(0);
+        _tail.clear();
+        return;
+    }
+
+    auto ix = n - _head.size();
+    auto sealed = _blocks.size() * block_size;
+    if (ix < sealed) {
+        auto b = ix / block_size;
+        block_t block;
+        decode(b, block);
+        drop_back_blocks(b);
+        _tail.assign(block.begin(), block.begin() + ix % block_size);
+        return;
+    }
+    _tail.resize(ix - sealed);
+}
+
+void offset_translator_state::batches_map::replace_prefix(
+  size_t n, batch_info front) {
+    if (n <= _head.size()) {
+        _head.erase(_head.begin(), _head.begin() + n);
+        _head.insert(_head.begin(), front);
+        return;
+    }
+
+    std::vector<batch_info> head;
+    head.push_back(front);
+    auto ix = n - _head.size();
+    auto sealed = _blocks.size() * block_size;
+    if (ix < sealed) {
+        auto b = ix / block_size;
+        block_t block;
+        decode(b, block);
+        head.insert(head.end(), block.begin() + ix % block_size, block.end());
+        drop_front_blocks(b + 1);
+    } else {
+        _tail.erase(_tail.begin(), _tail.begin() + (ix - sealed));
+        drop_front_blocks(_blocks.size());
+    }
+    _head = std::move(head);
+}
+
+int64_t offset_translator_state::batches_map::get(
+  const batch_info& batch, column c) {
+    switch (c) {
+    case last_offset_col:
+        return batch.last_offset();
+    case base_offset_col:
+        return batch.base_offset();
+    case next_delta_col:
+        return batch.next_delta;
+    case columns:
+        break;
+    }
+    __builtin_unreachable();
+}
+
+void offset_translator_state::batches_map::set(
+  batch_info& batch, column c, int64_t v) {
+    switch (c) {
+    case last_offset_col:
+        batch.last_offset = model::offset(v);
+        return;
+    case base_offset_col:
+        batch.base_offset = model::offset(v);
+        return;
+    case next_delta_col:
+        batch.next_delta = v;
+        return;
+    case columns:
+        break;
+    }
+    __builtin_unreachable();
+}
+
+void offset_translator_state::batches_map::seal_tail() {
+    block_header header{.last = _tail.back(), .pos = {}};
+    encoder_t::row_t row;
+    for (size_t c = 0; c < columns; ++c) {
+        for (size_t i = 0; i < block_size; ++i) {
+            row[i] = get(_tail[i], column(c));
+        }
+        header.pos[c] = _columns[c].get_size_bytes();
+        _columns[c].add(row);
+    }
+    _blocks.push_back(header);
+    _tail.clear();
+}
+
+void offset_translator_state::batches_map::decode(
+  size_t b, block_t& block) const {
+    decoder_t::row_t row;
+    for (size_t c = 0; c < columns; ++c) {
+        auto initial = b == 0 ? _columns[c].get_initial_value()
+                              : get(_blocks[b - 1].last, column(c));
+        auto pos = _blocks[b].pos[c];
+        auto end = b + 1 < _blocks.size() ? _blocks[b + 1].pos[c]
+                                          : _columns[c].get_size_bytes();
+        decoder_t decoder(initial, 1, _columns[c].share(pos, end - pos));
+        row.fill(0);
+        decoder.read(row);
+        for (size_t i = 0; i < block_size; ++i) {
+            set(block[i], column(c), row[i]);
+        }
+    }
+}
+
+void offset_translator_state::batches_map::drop_front_blocks(size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (n == _blocks.size()) {
+        _blocks.clear();
+        _columns = {encoder_t(0), encoder_t(0), encoder_t(0)};
+        return;
+    }
+
+    const auto start = _blocks[n].pos;
+    for (size_t c = 0; c < columns; ++c) {
+        auto& encoder = _columns[c];
+        encoder = encoder_t(
+          get(_blocks[n - 1].last, column(c)),
+          _blocks.size() - n,
+          encoder.get_last_value(),
+          encoder.share(start[c], encoder.get_size_bytes() - start[c]));
+    }
+    _blocks.erase(_blocks.begin(), _blocks.begin() + n);
+    for (auto& header : _blocks) {
+        for (size_t c = 0; c < columns; ++c) {
+            header.pos[c] -= start[c];
+        }
+    }
+}
+
+void offset_translator_state::batches_map::drop_back_blocks(size_t n) {
+    if (n == _blocks.size()) {
+        return;
+    }
+    if (n == 0) {
+        _blocks.clear();
+        _columns = {encoder_t(0), encoder_t(0), encoder_t(0)};
+        return;
+    }
+
+    for (size_t c = 0; c < columns; ++c) {
+        auto& encoder = _columns[c];
+        encoder = encoder_t(
+          encoder.get_initial_value(),
+          n,
+          get(_blocks[n - 1].last, column(c)),
+          encoder.share(0, _blocks[n].pos[c]));
+    }
+    _blocks.resize(n);
+}
+
+size_t
+offset_translator_state::batches_map::reader::lower_bound(model::offset o) {
+    return search(o, std::less<>{});
+}
+
+size_t
+offset_translator_state::batches_map::reader::upper_bound(model::offset o) {
+    return search(o, std::less_equal<>{});
+}
+
+template<typename Less>
+size_t offset_translator_state::batches_map::reader::search(
+  model::offset o, Less less) {
+    auto by_last = [&less](const batch_info& b, model::offset offset) {
+        return less(b.last_offset, offset);
+    };
+
+    const auto& head = _map._head;
+    auto head_it = std::lower_bound(head.begin(), head.end(), o, by_last);
+    if (head_it != head.end()) {
+        return head_it - head.begin();
+    }
+
+    // the first block whose last entry isn't less than the offset contains
+    // the searched entry
+    const auto& blocks = _map._blocks;
+    auto block_it = std::lower_bound(
+      blocks.begin(),
+      blocks.end(),
+      o,
+      [&by_last](const block_header& h, model::offset offset) {
+          return by_last(h.last, offset);
+      });
+    if (block_it != blocks.end()) {
+        size_t b = block_it - blocks.begin();
+        const auto& rows = block(b);
+        auto it = std::lower_bound(rows.begin(), rows.end(), o, by_last);
+        return head.size() + b * block_size + (it - rows.begin());
+    }
+
+    const auto& tail = _map._tail;
+    auto tail_it = std::lower_bound(tail.begin(), tail.end(), o, by_last);
+    return head.size() + blocks.size() * block_size + (tail_it - tail.begin());
+}
+
+const offset_translator_state::batch_info&
+offset_translator_state::batches_map::reader::get(size_t ix) {
+    if (ix < _map._head.size()) {
+        return _map._head[ix];
+    }
+    ix -= _map._head.size();
+    auto sealed = _map._blocks.size() * block_size;
+    if (ix < sealed) {
+        return block(ix / block_size)[ix % block_size];
+    }
+    return _map._tail[ix - sealed];
+}
+
+const offset_translator_state::batches_map::block_t&
+offset_translator_state::batches_map::reader::block(size_t b) {
+    if (_block_index != b) {
+        _map.decode(b, _block);
+        _block_index = b;
+    }
+    return _block;
+}
+
 namespace {
 
 struct persisted_batch {
@@ -282,21 +569,20 @@ struct persisted_batches_map
 } // namespace
 
 iobuf offset_translator_state::serialize_map() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!_batches.empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
     std::vector<persisted_batch> batches;
-    batches.reserve(_last_offset2batch.size());
-    for (const auto& [o, b] : _last_offset2batch) {
-        int32_t length = int32_t(o - b.base_offset) + 1;
+    batches.reserve(_batches.size());
+    batches_map::reader reader(_batches);
+    for (size_t i = 0; i < _batches.size(); ++i) {
+        const auto& b = reader.get(i);
+        int32_t length = int32_t(b.last_offset - b.base_offset) + 1;
         batches.push_back(
           persisted_batch{.base_offset = b.base_offset, .length = length});
     }
 
     persisted_batches_map persisted{
-      .start_delta = _last_offset2batch.begin()->second.next_delta,
+      .start_delta = _batches.front().next_delta,
       .batches = std::move(batches),
     };
 
@@ -311,7 +597,7 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
           "ntp {}: persisted offset translator map shouldn't be empty", ntp)};
     }
 
-    absl::btree_map<model::offset, batch_info> last_offset2batch;
+    offset_translator_state state(std::move(ntp));
     int64_t cur_delta = persisted.start_delta;
     model::offset prev_last_offset;
     for (auto it = persisted.batches.begin(); it != persisted.batches.end();
@@ -322,7 +608,7 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
                 throw std::runtime_error{fmt::format(
                   "ntp {}: inconsistency in serialized offset translator "
                   "state: offset {} is after {}",
-                  ntp,
+                  state._ntp,
                   b.base_offset,
                   prev_last_offset)};
             }
@@ -330,14 +616,13 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
         }
 
         model::offset last_offset = b.base_offset + model::offset{b.length - 1};
-        last_offset2batch.emplace(
-          last_offset,
-          batch_info{.base_offset = b.base_offset, .next_delta = cur_delta});
+        state._batches.push_back(batch_info{
+          .last_offset = last_offset,
+          .base_offset = b.base_offset,
+          .next_delta = cur_delta});
         prev_last_offset = last_offset;
     }
 
-    offset_translator_state state(std::move(ntp));
-    state._last_offset2batch = std::move(last_offset2batch);
     return state;
 }
 
@@ -345,23 +630,23 @@ offset_translator_state offset_translator_state::from_bootstrap_state(
   model::ntp ntp, const absl::btree_map<model::offset, int64_t>& offset2delta) {
     offset_translator_state state(std::move(ntp));
     for (const auto& [o, d] : offset2delta) {
-        state._last_offset2batch.emplace(
-          o, batch_info{.base_offset = o, .next_delta = d});
+        state._batches.push_back(
+          batch_info{.last_offset = o, .base_offset = o, .next_delta = d});
     }
     return state;
 }
 
 std::ostream&
 operator<<(std::ostream& os, const offset_translator_state& state) {
-    const auto& map = state._last_offset2batch;
+    const auto& map = state._batches;
 
     if (map.empty()) {
         return os << "{empty}";
     }
 
-    return os << "{base offset/delta: " << map.begin()->first << "/"
-              << map.begin()->second.next_delta << ", map size: " << map.size()
-              << ", last delta: " << map.rbegin()->second.next_delta << "}";
+    return os << "{base offset/delta: " << map.front().last_offset << "/"
+              << map.front().next_delta << ", map size: " << map.size()
+              << ", last delta: " << map.back().next_delta << "}";
 }
 
 } // namespace storage
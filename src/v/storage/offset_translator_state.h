@@ -13,9 +13,14 @@
 
 #include "model/fundamental.h"
 #include "serde/serde.h"
+#include "utils/delta_for.h"
 
 #include <absl/container/btree_map.h>
 
+#include <array>
+#include <limits>
+#include <vector>
+
 namespace storage {
 
 /// Provides offset translation between raw log offsets and offsets not counting
@@ -27,7 +32,9 @@ namespace storage {
 ///
 /// It works by maintaining an in-memory map of all filtered batch offsets.
 /// This map allows us to quickly find a delta between the raw log offset and
-/// corresponding translated offset.
+/// corresponding translated offset. Partitions with many configuration or
+/// transaction control batches accumulate a lot of entries, so the map is
+/// kept as a sorted sequence compressed with delta-FOR (see batches_map).
 class offset_translator_state {
 public:
     /// Create an empty translator - the delta between log and kafka offsets is
@@ -40,9 +47,10 @@ public:
     offset_translator_state(
       model::ntp ntp, model::offset base_offset, int64_t base_delta)
       : _ntp(std::move(ntp)) {
-        _last_offset2batch.emplace(
-          base_offset,
-          batch_info{.base_offset = base_offset, .next_delta = base_delta});
+        _batches.push_back(batch_info{
+          .last_offset = base_offset,
+          .base_offset = base_offset,
+          .next_delta = base_delta});
     }
 
     offset_translator_state(const offset_translator_state&) = delete;
@@ -52,7 +60,7 @@ public:
 
     const model::ntp& ntp() const { return _ntp; }
 
-    bool empty() const { return _last_offset2batch.empty(); }
+    bool empty() const { return _batches.empty(); }
 
     /// Difference between the log offset and the kafka offset.
     int64_t delta(model::offset) const;
@@ -60,6 +68,12 @@ public:
     /// Translate log offset into kafka offset.
     model::offset from_log_offset(model::offset) const;
 
+    /// Translate log offsets into kafka offsets in place. Same as calling
+    /// from_log_offset for every element, but a non-decreasing sequence (e.g.
+    /// base offsets of the batches of a fetch) is translated in a single pass
+    /// over the map.
+    void from_log_offsets(std::vector<model::offset>&) const;
+
     /// Translate kafka offset into log offset.
     model::offset to_log_offset(
       model::offset data_offset, model::offset hint = model::offset{}) const;
@@ -99,21 +113,123 @@ public:
 
 private:
     struct batch_info {
+        model::offset last_offset;
         model::offset base_offset;
         int64_t next_delta;
     };
 
-    // Map from the last offset of non-data batches to the corresponding batch
-    // info. next_delta in the batch info is active in the log offset interval
-    // (last offset; next last offset] (left end exclusive, right end
-    // inclusive). As prefix truncations happen, we maintain an invariant that
-    // there is always an element of the map with the key prev_offset(start of
-    // the log) - this way we can calculate delta for any offset in the log.
-    using batches_map_t = absl::btree_map<model::offset, batch_info>;
+    /// Sorted sequence of the non-data batches, ordered by the last offset.
+    /// next_delta in the batch info is active in the log offset interval
+    /// (last offset; next last offset] (left end exclusive, right end
+    /// inclusive). As prefix truncations happen, we maintain an invariant that
+    /// there is always an element with the last offset equal to
+    /// prev_offset(start of the log) - this way we can calculate delta for any
+    /// offset in the log.
+    ///
+    /// Batches are only ever appended at the end, so full blocks of
+    /// block_size entries are sealed and stored column by column in delta-FOR
+    /// encoded streams. Headers of the sealed blocks hold their last entry in
+    /// plain form, so a lookup is a binary search over the headers followed by
+    /// decoding of a single block. The entries that don't fill a block are
+    /// kept as is: the ones left after a prefix truncation in the middle of a
+    /// block in the head, the most recently added ones in the tail.
+    class batches_map {
+    public:
+        static constexpr size_t block_size = details::FOR_buffer_depth;
+        using block_t = std::array<batch_info, block_size>;
+
+        batches_map();
+
+        batches_map(const batches_map&) = delete;
+        batches_map& operator=(const batches_map&) = delete;
+        batches_map(batches_map&&) = default;
+        batches_map& operator=(batches_map&&) = default;
+        ~batches_map() = default;
+
+        bool empty() const { return size() == 0; }
+        size_t size() const {
+            return _head.size() + _blocks.size() * block_size + _tail.size();
+        }
+
+        batch_info front() const;
+        batch_info back() const;
+
+        /// Precondition: batches are added in the order of offsets
+        void push_back(batch_info);
+        /// Keep first `n` entries
+        void truncate(size_t n);
+        /// Replace first `n` entries with `front`
+        void replace_prefix(size_t n, batch_info front);
+
+        /// Sequential access to the map entries, caches the decoded block
+        /// that was accessed last. Invalidated by the map updates.
+        class reader {
+        public:
+            explicit reader(const batches_map& m)
+              : _map(m) {}
+
+            /// Index of the first entry with last offset not less than the
+            /// offset, size() if there is none.
+            size_t lower_bound(model::offset);
+            /// Index of the first entry with last offset greater than the
+            /// offset, size() if there is none.
+            size_t upper_bound(model::offset);
+
+            const batch_info& get(size_t index);
+
+        private:
+            template<typename Less>
+            size_t search(model::offset, Less);
+            const block_t& block(size_t);
+
+            const batches_map& _map;
+            size_t _block_index{std::numeric_limits<size_t>::max()};
+            block_t _block;
+        };
+
+    private:
+        using encoder_t = deltafor_encoder<int64_t>;
+        using decoder_t = deltafor_decoder<int64_t>;
+
+        enum column : size_t {
+            last_offset_col,
+            base_offset_col,
+            next_delta_col,
+            columns
+        };
+
+        struct block_header {
+            /// Last entry of the block
+            batch_info last;
+            /// Position of the block in the column streams
+            std::array<size_t, columns> pos;
+        };
+
+        static int64_t get(const batch_info&, column);
+        static void set(batch_info&, column, int64_t);
+
+        void seal_tail();
+        void decode(size_t, block_t&) const;
+        /// Remove first `n` sealed blocks
+        void drop_front_blocks(size_t n);
+        /// Keep first `n` sealed blocks
+        void drop_back_blocks(size_t n);
+
+        std::vector<batch_info> _head;
+        std::vector<block_header> _blocks;
+        std::vector<batch_info> _tail;
+        // sharing the encoded data doesn't change it, but needs a non const
+        // iobuf
+        mutable std::array<encoder_t, columns> _columns;
+    };
+
+    /// Delta at the offset, `ix` is the index of the lower bound of the
+    /// offset in the map.
+    int64_t delta(batches_map::reader&, size_t ix, model::offset) const;
 
 private:
     model::ntp _ntp;
-    batches_map_t _last_offset2batch;
+    batches_map _batches;
 };
 
 } // namespace storage
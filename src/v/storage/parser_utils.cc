@@ -37,10 +37,13 @@ ss::future<model::record_batch> decompress_batch(model::record_batch&& b) {
     if (!b.compressed()) {
         return ss::make_ready_future<model::record_batch>(std::move(b));
     }
-    return decompress_batch(b);
+    return ss::do_with(std::move(b), [](model::record_batch& b) {
+        return decompress_batch(b);
+    });
 }
 
-ss::future<model::record_batch> decompress_batch(const model::record_batch& b) {
+ss::future<model::record_batch>
+decompress_batch(const model::record_batch& b, size_t max_size) {
     if (unlikely(!b.compressed())) {
         return ss::make_exception_future<model::record_batch>(
           std::runtime_error(fmt_with_ctx(
@@ -48,15 +51,16 @@ ss::future<model::record_batch> decompress_batch(const model::record_batch& b) {
             "Asked to decompressed a non-compressed batch:{}",
             b.header())));
     }
-    iobuf body_buf = compression::compressor::uncompress(
-      b.data(), b.header().attrs.compression());
-    // must remove compression first!
-    auto h = b.header();
-    h.attrs.remove_compression();
-    reset_size_checksum_metadata(h, body_buf);
-    auto batch = model::record_batch(
-      h, std::move(body_buf), model::record_batch::tag_ctor_ng{});
-    return ss::make_ready_future<model::record_batch>(std::move(batch));
+    return compression::compressor::uncompress_async(
+             b.data(), b.header().attrs.compression(), max_size)
+      .then([&b](iobuf body_buf) {
+          // must remove compression first!
+          auto h = b.header();
+          h.attrs.remove_compression();
+          reset_size_checksum_metadata(h, body_buf);
+          return model::record_batch(
+            h, std::move(body_buf), model::record_batch::tag_ctor_ng{});
+      });
 }
 
 compress_batch_consumer::compress_batch_consumer(
@@ -100,14 +104,15 @@ compress_batch(model::compression c, const model::record_batch& b) {
       "Asked to compress a batch with type `none`: {} - {}",
       c,
       b.header());
-    auto payload = compression::compressor::compress(b.data(), c);
-    auto h = b.header();
-    // compression bit must be set first!
-    h.attrs |= c;
-    reset_size_checksum_metadata(h, payload);
-    auto batch = model::record_batch(
-      h, std::move(payload), model::record_batch::tag_ctor_ng{});
-    return ss::make_ready_future<model::record_batch>(std::move(batch));
+    return compression::compressor::compress_async(b.data(), c)
+      .then([c, &b](iobuf payload) {
+          auto h = b.header();
+          // compression bit must be set first!
+          h.attrs |= c;
+          reset_size_checksum_metadata(h, payload);
+          return model::record_batch(
+            h, std::move(payload), model::record_batch::tag_ctor_ng{});
+      });
 }
 
 /// \brief resets the size, header crc and payload crc
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "bytes/iobuf_parser.h"
+#include "compression/compression.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
 
@@ -42,8 +43,11 @@ private:
 
 /// \brief batch decompression
 ss::future<model::record_batch> decompress_batch(model::record_batch&&);
-/// \brief batch decompression
-ss::future<model::record_batch> decompress_batch(const model::record_batch&);
+/// \brief batch decompression, fails with compression::output_limit_exceeded
+/// if the records are larger than max_size
+ss::future<model::record_batch> decompress_batch(
+  const model::record_batch&,
+  size_t max_size = compression::no_output_limit);
 
 /// \brief batch compression
 ss::future<model::record_batch>
@@ -446,25 +446,15 @@ ss::future<segment_set> recover_segments(
   std::optional<ss::sstring> last_clean_segment,
   storage_resources& resources,
   bool is_internal_topic) {
-    return ss::recursive_touch_directory(path.string())
-      .then([&as,
-             cache_factory,
+    return open_segments(
+             path.string(),
              sanitize_fileops,
-             path = std::move(path),
+             cache_factory,
+             as,
              read_buf_size,
              read_readahead_count,
-             &resources,
-             is_internal_topic] {
-          return open_segments(
-            path.string(),
-            sanitize_fileops,
-            cache_factory,
-            as,
-            read_buf_size,
-            read_readahead_count,
-            resources,
-            is_internal_topic);
-      })
+             resources,
+             is_internal_topic)
       .then([&as,
              is_compaction_enabled,
              last_clean_segment = std::move(last_clean_segment)](
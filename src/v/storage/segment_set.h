@@ -89,6 +89,8 @@ private:
     friend std::ostream& operator<<(std::ostream&, const segment_set&);
 };
 
+/// Open and recover the segments of the log stored in \p path, the
+/// directory must exist
 ss::future<segment_set> recover_segments(
   std::filesystem::path path,
   debug_sanitize_files sanitize_fileops,
@@ -0,0 +1,172 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE storage
+#include "model/fundamental.h"
+#include "random/generators.h"
+#include "storage/offset_translator_state.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+struct gap {
+    model::offset base;
+    model::offset last;
+};
+
+const model::ntp test_ntp(
+  model::ns("test"), model::topic("tp"), model::partition_id(0));
+
+/// Reference translation computed from the list of the gaps
+struct reference {
+    model::offset start;
+    std::vector<gap> gaps;
+
+    int64_t delta(model::offset o) const {
+        int64_t delta = 0;
+        for (const auto& g : gaps) {
+            if (g.last < o) {
+                delta += g.last - g.base + 1;
+            } else if (g.base <= o) {
+                delta += o - g.base;
+            }
+        }
+        return delta;
+    }
+
+    bool is_gap(model::offset o) const {
+        return std::any_of(gaps.begin(), gaps.end(), [o](const gap& g) {
+            return g.base <= o && o <= g.last;
+        });
+    }
+
+    model::offset end() const {
+        return gaps.empty() ? start : gaps.back().last + model::offset(5);
+    }
+};
+
+reference make_state(storage::offset_translator_state& state, int gaps) {
+    reference ref{.start = model::offset(0)};
+    model::offset next(0);
+    for (int i = 0; i < gaps; ++i) {
+        auto base = next + model::offset(random_generators::get_int(0, 5));
+        auto last = base + model::offset(random_generators::get_int(0, 3));
+        state.add_gap(base, last);
+        ref.gaps.push_back(gap{.base = base, .last = last});
+        next = last + model::offset(1);
+    }
+    return ref;
+}
+
+void check_translation(
+  const storage::offset_translator_state& state, const reference& ref) {
+    std::vector<model::offset> offsets;
+    for (auto o = ref.start; o <= ref.end(); ++o) {
+        BOOST_REQUIRE_EQUAL(state.delta(o), ref.delta(o));
+        offsets.push_back(o);
+        if (!ref.is_gap(o)) {
+            auto data_offset = state.from_log_offset(o);
+            BOOST_REQUIRE_EQUAL(data_offset, o - model::offset(ref.delta(o)));
+            BOOST_REQUIRE_EQUAL(state.to_log_offset(data_offset), o);
+        }
+    }
+
+    auto translated = offsets;
+    state.from_log_offsets(translated);
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(translated[i], state.from_log_offset(offsets[i]));
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_translation_matches_reference) {
+    for (int gaps : {0, 1, 15, 16, 17, 100, 1000}) {
+        storage::offset_translator_state state(
+          test_ntp, model::offset(-1), 0);
+        auto ref = make_state(state, gaps);
+        check_translation(state, ref);
+        if (gaps > 0) {
+            BOOST_REQUIRE_EQUAL(state.last_gap_offset(), ref.gaps.back().last);
+            BOOST_REQUIRE_EQUAL(state.last_delta(), ref.delta(ref.end()));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_translation_of_unordered_offsets) {
+    storage::offset_translator_state state(test_ntp, model::offset(-1), 0);
+    auto ref = make_state(state, 200);
+
+    std::vector<model::offset> offsets;
+    for (int i = 0; i < 1000; ++i) {
+        offsets.emplace_back(random_generators::get_int<int64_t>(
+          ref.start(), ref.end()()));
+    }
+    auto translated = offsets;
+    state.from_log_offsets(translated);
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(translated[i], state.from_log_offset(offsets[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_serialization_roundtrip) {
+    storage::offset_translator_state state(test_ntp, model::offset(-1), 0);
+    auto ref = make_state(state, 500);
+
+    auto restored = storage::offset_translator_state::from_serialized_map(
+      test_ntp, state.serialize_map());
+    check_translation(restored, ref);
+    BOOST_REQUIRE(restored.serialize_map() == state.serialize_map());
+}
+
+BOOST_AUTO_TEST_CASE(test_truncation) {
+    for (int i = 0; i < 50; ++i) {
+        storage::offset_translator_state state(
+          test_ntp, model::offset(-1), 0);
+        auto ref = make_state(state, 300);
+
+        // prefix truncate at an offset that isn't a part of any gap
+        auto prefix_ix = random_generators::get_int<size_t>(
+          0, ref.gaps.size() - 1);
+        auto prefix_at = ref.gaps[prefix_ix].last;
+        if (random_generators::get_int(0, 1) == 1) {
+            prefix_at = model::prev_offset(ref.gaps[prefix_ix].base);
+        }
+        if (prefix_at >= ref.start) {
+            state.prefix_truncate(prefix_at);
+            ref.start = model::next_offset(prefix_at);
+        }
+
+        // truncate at the base offset of one of the following gaps
+        auto truncate_ix = random_generators::get_int<size_t>(
+          prefix_ix + 1, ref.gaps.size());
+        if (truncate_ix < ref.gaps.size()) {
+            auto truncate_at = ref.gaps[truncate_ix].base;
+            if (truncate_at > ref.start) {
+                BOOST_REQUIRE(state.truncate(truncate_at));
+                ref.gaps.resize(truncate_ix);
+            }
+        }
+        check_translation(state, ref);
+
+        // the state keeps growing after the truncations
+        auto next = ref.end();
+        for (int j = 0; j < 40; ++j) {
+            state.add_gap(next, next + model::offset(j % 3));
+            ref.gaps.push_back(
+              gap{.base = next, .last = next + model::offset(j % 3)});
+            next = next + model::offset(j % 3 + 2);
+        }
+        check_translation(state, ref);
+    }
+}
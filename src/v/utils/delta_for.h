@@ -224,6 +224,12 @@ public:
     /// Share the underlying iobuf
     iobuf share() { return _data.share(0, _data.size_bytes()); }
 
+    /// Share a byte range of the underlying iobuf
+    iobuf share(size_t pos, size_t len) { return _data.share(pos, len); }
+
+    /// Return size of the encoded data in bytes
+    size_t get_size_bytes() const noexcept { return _data.size_bytes(); }
+
     /// Return number of rows stored in the underlying iobuf instance
     uint32_t get_row_count() const noexcept { return _cnt; }
 
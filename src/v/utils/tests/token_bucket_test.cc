@@ -191,3 +191,33 @@ SEASTAR_THREAD_TEST_CASE(test_available_tokens_change_capacity) {
     ss::manual_clock::advance(ss::lowres_clock::duration(2s));
     BOOST_REQUIRE_EQUAL(throttler.available(), RATE * 3);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_record_debt) {
+    token_bucket<ss::manual_clock> throttler(RATE, "test_record_debt");
+    throttler.record(RATE * 2);
+    BOOST_REQUIRE_EQUAL(throttler.available(), 0);
+    BOOST_REQUIRE(!throttler.try_throttle(1));
+
+    // the debt is paid off before the waiter is let through
+    ss::abort_source as;
+    auto result = throttler.throttle(0, as);
+    ss::manual_clock::advance(ss::lowres_clock::duration(1s));
+    throttler.available();
+    BOOST_REQUIRE(!result.available());
+    ss::manual_clock::advance(ss::lowres_clock::duration(2s));
+    throttler.available();
+    result.get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_refill_releases_waiters) {
+    token_bucket<ss::manual_clock> throttler(RATE, "test_refill");
+    throttler.record(RATE * 2);
+
+    ss::abort_source as;
+    auto result = throttler.throttle(0, as);
+    BOOST_REQUIRE(!result.available());
+    // the debt is forgiven without waiting for the refresh
+    throttler.refill();
+    result.get();
+    BOOST_REQUIRE_EQUAL(throttler.available(), RATE);
+}
@@ -75,6 +75,30 @@ public:
          */
         return _sem.try_wait(size);
     }
+
+    /*
+     * Takes the tokens without waiting. The bucket may go into debt, in which
+     * case throttle() waits until it is paid off before taking more tokens.
+     * Used when the size is only known after the fact, e.g. the size of a
+     * response.
+     */
+    void record(size_t size) {
+        refresh();
+        _sem.consume(size);
+    }
+
+    /*
+     * Fills the bucket up to its capacity, forgiving any debt. The waiters
+     * are let through.
+     */
+    void refill() {
+        refresh();
+        auto available = _sem.available_units();
+        if (available < static_cast<ssize_t>(_capacity)) {
+            _sem.signal(_capacity - available);
+        }
+    }
+
     void shutdown() {
         _refresh_timer.cancel();
         _sem.broken();
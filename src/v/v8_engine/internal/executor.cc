@@ -10,45 +10,50 @@
 
 #include "v8_engine/internal/executor.h"
 
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "seastarx.h"
-#include "utils/mutex.h"
 #include "vassert.h"
 
 #include <seastar/core/alien.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/smp.hh>
 
+#include <algorithm>
 #include <exception>
+#include <limits>
 
 namespace v8_engine {
 
 namespace internal {
 
-// spsc_queue
+// mpsc_queue
 
-spsc_queue::spsc_queue(size_t queue_size)
+mpsc_queue::mpsc_queue(size_t queue_size)
   : _items(queue_size) {}
 
-void spsc_queue::close() {
+void mpsc_queue::close() {
     _is_stopped = true;
-    _push_mutex.broken();
     _has_element_cv.notify_all();
 }
 
-ss::future<> spsc_queue::push(work_item* item) {
-    // Only one coroutine can wait on ss::readable_eventfd, so we need to use
-    // mutex for push
-    auto lock = co_await _push_mutex.get_units();
-
-    while (!_items.push(item)) {
-        co_await _is_not_full.wait();
-    }
+void mpsc_queue::push(work_item* item) {
+    // The executor reserves capacity before pushing, so the queue can not be
+    // full here
+    auto pushed = _items.bounded_push(item);
+    vassert(pushed, "Executor queue overflow");
 
     _has_element_cv.notify_one();
 }
 
-work_item* spsc_queue::pop() {
+work_item* mpsc_queue::pop() {
     work_item* item = nullptr;
+
+    if (_items.pop(item)) {
+        return item;
+    }
+
     std::unique_lock lock{_std_mutex};
 
     // We need to use wait_for, because std::thread can miss notification from
@@ -57,16 +62,50 @@ work_item* spsc_queue::pop() {
         return !empty() || _is_stopped;
     });
 
-    if (!empty()) {
-        item = _items.front();
-        _items.pop();
-        _is_not_full.write_side().signal(1);
-    }
+    _items.pop(item);
 
     return item;
 }
 
-bool spsc_queue::empty() { return _items.empty(); }
+bool mpsc_queue::empty() { return _items.empty(); }
+
+// executor_probe
+
+void executor_probe::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("v8_engine:executor"),
+      {
+        sm::make_counter(
+          "tasks",
+          [this] { return _tasks.load(std::memory_order_relaxed); },
+          sm::description("Total number of tasks completed by the executor.")),
+        sm::make_counter(
+          "items",
+          [this] { return _items.load(std::memory_order_relaxed); },
+          sm::description(
+            "Total number of functions run by the executor, a batch task runs "
+            "several of them.")),
+        sm::make_counter(
+          "queue_time_us",
+          [this] { return _queue_time_us.load(std::memory_order_relaxed); },
+          sm::description(
+            "Total time in microseconds that tasks spent in the queue.")),
+        sm::make_counter(
+          "execution_time_us",
+          [this] { return _exec_time_us.load(std::memory_order_relaxed); },
+          sm::description(
+            "Total time in microseconds that tasks spent in execution.")),
+        sm::make_gauge(
+          "queued_tasks",
+          [this] { return _queued.load(std::memory_order_relaxed); },
+          sm::description("Current number of tasks waiting in the queues.")),
+      });
+}
 
 } // namespace internal
 
@@ -74,38 +113,96 @@ bool spsc_queue::empty() { return _items.empty(); }
 
 executor::executor(
   ss::alien::instance& instance, uint8_t cpu_id, size_t queue_size)
+  : executor(instance, std::vector<unsigned>{cpu_id}, queue_size) {}
+
+executor::executor(
+  ss::alien::instance& instance,
+  std::vector<unsigned> cpu_ids,
+  size_t queue_size)
   : _alien_instance(instance)
-  , _thread([this, cpu_id] {
-      pin(cpu_id);
-      loop();
-  })
-  , _tasks(queue_size)
-  , _watchdog_shard(ss::this_shard_id()) {}
+  , _watchdog_shard(ss::this_shard_id()) {
+    vassert(!cpu_ids.empty(), "Executor needs at least one thread");
+
+    // Every shard can fill a queue with its tasks. The lock-free queue can't
+    // hold more than 2^16 - 1 elements, so the number of tasks in flight
+    // per shard is reduced to fit.
+    const size_t max_shard_queue_size = std::max<size_t>(
+      (std::numeric_limits<uint16_t>::max() - 1) / ss::smp::count, 1);
+    queue_size = std::min(queue_size, max_shard_queue_size);
+    const size_t worker_queue_size = queue_size * ss::smp::count;
+
+    _shards.reserve(ss::smp::count);
+    for (ss::shard_id i = 0; i < ss::smp::count; ++i) {
+        _shards.push_back(std::make_unique<shard_state>(queue_size));
+    }
+
+    _workers.reserve(cpu_ids.size());
+    for (auto cpu_id : cpu_ids) {
+        _workers.push_back(std::make_unique<worker>(worker_queue_size, cpu_id));
+    }
+
+    for (auto& w : _workers) {
+        w->thread = std::thread([this, w = w.get()] {
+            pin(w->cpu_id);
+            loop(*w);
+        });
+    }
+
+    _probe.setup_metrics();
+}
 
 ss::future<> executor::stop() {
-    _tasks.close();
-    return _gate.close().then([this] {
-        _is_stopped = true;
-        _thread.join();
+    // Gates and semaphores must be closed on the shards which use them. The
+    // gates wait for the tasks in flight, which are processed by the threads
+    // blocked on the open queues in the meantime.
+    co_await ss::smp::invoke_on_all([this] {
+        auto& state = *_shards[ss::this_shard_id()];
+        state.units.broken();
+        return state.gate.close();
     });
+
+    // No task can be pushed anymore, the threads exit once woken up
+    _is_stopped = true;
+    for (auto& w : _workers) {
+        w->tasks.close();
+    }
+    for (auto& w : _workers) {
+        w->thread.join();
+    }
 }
 
 bool executor::is_stopping() const {
     return _is_stopped.load(std::memory_order_relaxed);
 }
 
+ss::future<>
+executor::submit_task(internal::task_base& task, size_t affinity) {
+    auto& state = *_shards[ss::this_shard_id()];
+    gate_guard guard{state.gate};
+
+    auto units = co_await ss::get_units(state.units, 1);
+
+    auto& w = *_workers[affinity % _workers.size()];
+    task._enqueued_at = internal::work_item::clock_type::now();
+    _probe.task_queued();
+    w.tasks.push(&task);
+
+    co_await task.get_future().finally(
+      [this, &task] { _probe.task_done(task); });
+}
+
 void executor::rearm_watchdog(
-  internal::work_item& task, std::chrono::milliseconds timeout) {
+  worker& w, internal::work_item& task, std::chrono::milliseconds timeout) {
     // We need to reset callback for each item in queue. Because we have only
-    // one timer for all tasks in executor.
-    _watchdog.set_callback([&task] { task.cancel(); });
+    // one timer for all tasks in executor thread.
+    w.watchdog.set_callback([&task] { task.cancel(); });
 
-    _watchdog.rearm(
+    w.watchdog.rearm(
       ss::lowres_clock::time_point(ss::lowres_clock::now() + timeout));
 }
 
-void executor::cancel_watchdog(internal::work_item& task) {
-    if (!_watchdog.cancel()) {
+void executor::cancel_watchdog(worker& w, internal::work_item& task) {
+    if (!w.watchdog.cancel()) {
         task.on_timeout();
     }
 }
@@ -118,16 +215,19 @@ void executor::pin(unsigned cpu_id) {
     vassert(r == 0, "Can not pin executor thread to core {}", cpu_id);
 }
 
-void executor::loop() {
-    while (!(is_stopping() && _tasks.empty())) {
-        internal::work_item* item = _tasks.pop();
+void executor::loop(worker& w) {
+    while (!(is_stopping() && w.tasks.empty())) {
+        internal::work_item* item = w.tasks.pop();
 
         if (item) {
+            item->_started_at = internal::work_item::clock_type::now();
+            _probe.task_dequeued();
+
             ss::alien::submit_to(
               _alien_instance,
               _watchdog_shard,
-              [this, item] {
-                  rearm_watchdog(*item, item->get_timeout());
+              [this, &w, item] {
+                  rearm_watchdog(w, *item, item->get_timeout());
                   return ss::now();
               })
               .wait();
@@ -137,12 +237,13 @@ void executor::loop() {
             ss::alien::submit_to(
               _alien_instance,
               _watchdog_shard,
-              [this, item] {
-                  cancel_watchdog(*item);
+              [this, &w, item] {
+                  cancel_watchdog(w, *item);
                   return ss::now();
               })
               .wait();
 
+            item->_finished_at = internal::work_item::clock_type::now();
             item->done();
         }
     }
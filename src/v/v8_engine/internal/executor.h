@@ -12,7 +12,6 @@
 
 #include "seastarx.h"
 #include "utils/gate_guard.h"
-#include "utils/mutex.h"
 
 #include <seastar/core/alien.hh>
 #include <seastar/core/coroutine.hh>
@@ -20,16 +19,21 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/internal/pollable_fd.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/semaphore.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/timer.hh>
 #include <seastar/util/later.hh>
 
-#include <boost/lockfree/spsc_queue.hpp>
+#include <boost/lockfree/queue.hpp>
 
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <exception>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace v8_engine {
 
@@ -37,6 +41,8 @@ namespace internal {
 
 // Abstract class for executor task
 struct work_item {
+    using clock_type = std::chrono::steady_clock;
+
     virtual ~work_item() {}
     virtual void process() noexcept = 0;
     virtual void cancel() noexcept = 0;
@@ -46,89 +52,148 @@ struct work_item {
     };
     virtual std::chrono::milliseconds get_timeout() const noexcept = 0;
 
+    // Number of units of work processed by the task
+    virtual size_t size() const noexcept { return 1; }
+
     virtual void done() = 0;
 
     std::exception_ptr _exception;
+
+    // Set by the submitting shard when the task is pushed to the queue and
+    // by the executor thread when the task is picked up and finished.
+    clock_type::time_point _enqueued_at;
+    clock_type::time_point _started_at;
+    clock_type::time_point _finished_at;
+};
+
+// Save first exception for task
+template<typename FunForExecute>
+void func_wrapper(work_item& item, FunForExecute&& func) {
+    if (item._exception) {
+        return;
+    }
+
+    try {
+        func();
+    } catch (...) {
+        item.set_exception(std::current_exception());
+    }
+}
+
+// Promise logic shared by the executor tasks
+struct task_base : work_item {
+    // Signal from std::thread to seastar about the end of task processing
+    void done() override { _on_done.write_side().signal(1); }
+
+    // Get future from seastar thread for waiting when executor thread will
+    // complete task
+    ss::future<> get_future() {
+        return _on_done.wait().discard_result().then([this] {
+            if (_exception) {
+                return ss::make_exception_future(_exception);
+            } else {
+                return ss::now();
+            }
+        });
+    }
+
+    seastar::readable_eventfd _on_done;
 };
 
 // This class implement task for executor. Contains promise logic
 template<typename Func>
-struct task final : work_item {
+struct task final : task_base {
     task(Func&& f, std::chrono::milliseconds timeout)
-      : work_item()
-      , _func(std::forward<Func>(f))
+      : _func(std::forward<Func>(f))
       , _timeout(timeout) {}
 
-    // Save first exception for task
-    template<typename FunForExecute>
-    void func_wrapper(FunForExecute&& func) {
-        if (_exception) {
-            return;
-        }
-
-        try {
-            func();
-        } catch (...) {
-            set_exception(std::current_exception());
-        }
-    }
-
     // Process task from executor in executor thread and set state in ss::future
     void process() noexcept override {
-        func_wrapper([this] { _func(); });
+        func_wrapper(*this, [this] { _func(); });
     }
 
     // Run this function for cancel task execution
     void cancel() noexcept override {
-        func_wrapper([this] { _func.cancel(); });
+        func_wrapper(*this, [this] { _func.cancel(); });
     }
 
     // Run this function after wathdog was alarmed and execution was canceled.
     // For example: prepare inside task fields for next execution
     void on_timeout() noexcept override {
-        func_wrapper([this] { _func.on_timeout(); });
+        func_wrapper(*this, [this] { _func.on_timeout(); });
     }
 
     std::chrono::milliseconds get_timeout() const noexcept override {
         return _timeout;
     }
 
-    // Signal from std::thread to seastar about the end of task processing
-    void done() override { _on_done.write_side().signal(1); }
+    Func _func;
 
-    // Get future from seastar thread for waiting when executor thread will
-    // complete task
-    ss::future<> get_future() {
-        return _on_done.wait().discard_result().then([this] {
+    std::chrono::milliseconds _timeout;
+};
+
+// Task which runs several functions one after another in the executor thread,
+// so that the cost of handing a task over to the executor is paid once for the
+// whole vector. Processing stops at the first exception. The timeout applies
+// to each function, the watchdog is armed for the sum of them.
+template<typename Func>
+struct batch_task final : task_base {
+    batch_task(std::vector<Func>&& funcs, std::chrono::milliseconds timeout)
+      : _funcs(std::move(funcs))
+      , _timeout(timeout) {}
+
+    void process() noexcept override {
+        for (auto& func : _funcs) {
             if (_exception) {
-                return ss::make_exception_future(_exception);
-            } else {
-                return ss::now();
+                return;
             }
-        });
+            _current.store(&func, std::memory_order_release);
+            func_wrapper(*this, [&func] { func(); });
+        }
     }
 
-    Func _func;
-    seastar::readable_eventfd _on_done;
+    // The watchdog runs on a seastar shard, so it can only see the function
+    // that was current when it fired.
+    void cancel() noexcept override {
+        if (auto func = _current.load(std::memory_order_acquire); func) {
+            func_wrapper(*this, [func] { func->cancel(); });
+        }
+    }
+
+    void on_timeout() noexcept override {
+        if (auto func = _current.load(std::memory_order_acquire); func) {
+            func_wrapper(*this, [func] { func->on_timeout(); });
+        }
+    }
+
+    std::chrono::milliseconds get_timeout() const noexcept override {
+        return _timeout * _funcs.size();
+    }
+
+    size_t size() const noexcept override { return _funcs.size(); }
+
+    std::vector<Func> _funcs;
+    std::atomic<Func*> _current{nullptr};
 
     std::chrono::milliseconds _timeout;
 };
 
-// This class implement queue for submit task from seastar to std::thread. Only
-// one core with seastar can submit task to queue. Only one std::thread can
-// consume task from queue.
-class spsc_queue {
+// This class implement queue for submit task from seastar to std::thread. Any
+// seastar core can submit task to queue. Only one std::thread can consume task
+// from queue. The queue doesn't apply backpressure, the capacity is reserved
+// by the executor before a task is pushed.
+class mpsc_queue {
     static constexpr std::chrono::milliseconds _timeout_cond_wait_std_thread_ms{
       30};
 
 public:
-    explicit spsc_queue(size_t queue_size);
+    explicit mpsc_queue(size_t queue_size);
 
-    // Close queue and break waiting on seastar mutex
+    // Close queue and wake up the consumer
     void close();
 
-    // Push new item to queue. Only one future can wait on readable_eventfd
-    ss::future<> push(work_item* item);
+    // Push new item to queue
+    void push(work_item* item);
 
     // Pop element from queue (blocking)
     work_item* pop();
@@ -136,27 +201,62 @@ public:
     bool empty();
 
 private:
-    mutex _push_mutex;
-    seastar::readable_eventfd _is_not_full;
-
     std::atomic<bool> _is_stopped{false};
 
-    boost::lockfree::spsc_queue<work_item*> _items;
+    boost::lockfree::queue<work_item*, boost::lockfree::fixed_sized<true>>
+      _items;
 
     std::mutex _std_mutex;
     std::condition_variable _has_element_cv;
 };
 
+// Task counters of the executor. They are updated from every shard which
+// submits tasks, so they are atomic, and exported from the executor shard.
+class executor_probe {
+public:
+    void task_done(const work_item& item) {
+        auto queued = std::chrono::duration_cast<std::chrono::microseconds>(
+          item._started_at - item._enqueued_at);
+        auto executed = std::chrono::duration_cast<std::chrono::microseconds>(
+          item._finished_at - item._started_at);
+        _tasks.fetch_add(1, std::memory_order_relaxed);
+        _items.fetch_add(item.size(), std::memory_order_relaxed);
+        _queue_time_us.fetch_add(queued.count(), std::memory_order_relaxed);
+        _exec_time_us.fetch_add(executed.count(), std::memory_order_relaxed);
+    }
+
+    void task_queued() { _queued.fetch_add(1, std::memory_order_relaxed); }
+    void task_dequeued() { _queued.fetch_sub(1, std::memory_order_relaxed); }
+
+    void setup_metrics();
+
+private:
+    std::atomic<uint64_t> _tasks{0};
+    std::atomic<uint64_t> _items{0};
+    std::atomic<uint64_t> _queue_time_us{0};
+    std::atomic<uint64_t> _exec_time_us{0};
+    std::atomic<int64_t> _queued{0};
+
+    ss::metrics::metric_groups _metrics;
+};
+
 } // namespace internal
 
-// This class implement executor (std::thread) for runing v8 script. It
-// uses boost::spsc_queue for storing task.
-// For use we need create ss::shared<executor> and run submit like
-// executor_sharded.invoke_on(<core with executor>)
+// This class implement executor (pool of std::thread) for runing v8 script.
+// Every thread has its own queue. Tasks are routed to a thread by an affinity
+// key, so the tasks of one v8::Isolate always run on the same thread.
+// The executor is created on one shard, tasks can be submitted from any
+// shard. Each shard may have up to queue_size tasks in flight, the value is
+// reduced if the thread queues can't hold that many tasks from every shard.
 class executor {
 public:
     executor(ss::alien::instance& instance, uint8_t cpu_id, size_t queue_size);
 
+    executor(
+      ss::alien::instance& instance,
+      std::vector<unsigned> cpu_ids,
+      size_t queue_size);
+
     executor(const executor& other) = delete;
     executor& operator=(const executor& other) = delete;
     executor(executor&& other) = delete;
@@ -164,15 +264,18 @@ public:
 
     ~executor() = default;
 
-    // Stop executou. Stop queue with task and close gate
+    // Stop executor. Close gates on all shards, then stop queues with task
     ss::future<> stop();
 
     bool is_stopping() const;
 
+    size_t workers_count() const { return _workers.size(); }
+
     /// Submit new task in executor.
     ///
     /// \param start_func is used for set watchdog
     /// \param func_for_executor is v8 script
+    /// \param affinity selects the executor thread
 
     template<typename WrapperFuncForExecutor>
     requires requires(WrapperFuncForExecutor func) {
@@ -182,43 +285,91 @@ public:
     }
     ss::future<> submit(
       WrapperFuncForExecutor&& func_for_executor,
-      std::chrono::milliseconds timeout) {
-        gate_guard guard{_gate};
-
+      std::chrono::milliseconds timeout,
+      size_t affinity = 0) {
         auto new_task
           = std::make_unique<internal::task<WrapperFuncForExecutor>>(
             std::forward<WrapperFuncForExecutor>(func_for_executor), timeout);
 
-        co_await _tasks.push(new_task.get());
-        co_await new_task->get_future();
+        co_await submit_task(*new_task, affinity);
+    }
+
+    /// Submit several functions as one task. They are run in order by
+    /// the same executor thread.
+    ///
+    /// \param funcs_for_executor are v8 scripts
+    /// \param timeout for every function in the vector
+    /// \param affinity selects the executor thread
+
+    template<typename WrapperFuncForExecutor>
+    requires requires(WrapperFuncForExecutor func) {
+        { func() } -> std::same_as<void>;
+        { func.cancel() } -> std::same_as<void>;
+        { func.on_timeout() } -> std::same_as<void>;
+    }
+    ss::future<> submit(
+      std::vector<WrapperFuncForExecutor> funcs_for_executor,
+      std::chrono::milliseconds timeout,
+      size_t affinity = 0) {
+        if (funcs_for_executor.empty()) {
+            co_return;
+        }
+
+        auto new_task
+          = std::make_unique<internal::batch_task<WrapperFuncForExecutor>>(
+            std::move(funcs_for_executor), timeout);
+
+        co_await submit_task(*new_task, affinity);
     }
 
 private:
+    // Seastar objects used by a submitting shard. They are only accessed from
+    // that shard.
+    struct shard_state {
+        explicit shard_state(size_t queue_size)
+          : units(queue_size) {}
+
+        ss::gate gate;
+        ss::semaphore units;
+    };
+
+    struct worker {
+        worker(size_t queue_size, unsigned cpu_id)
+          : tasks(queue_size)
+          , cpu_id(cpu_id) {}
+
+        internal::mpsc_queue tasks;
+        unsigned cpu_id;
+        std::thread thread;
+
+        ss::timer<ss::lowres_clock> watchdog;
+    };
+
+    ss::future<> submit_task(internal::task_base& task, size_t affinity);
+
     // Set callback and rearm watchdog
     void rearm_watchdog(
-      internal::work_item& task, std::chrono::milliseconds timeout);
+      worker& w, internal::work_item& task, std::chrono::milliseconds timeout);
 
     // Cancel watchdog
-    void cancel_watchdog(internal::work_item& task);
+    void cancel_watchdog(worker& w, internal::work_item& task);
 
     // We need to pin thread to core without seastar reactor
     void pin(unsigned cpu_id);
 
     // Main loop for threads in executor
-    void loop();
+    void loop(worker& w);
 
     ss::alien::instance& _alien_instance;
 
     std::atomic<bool> _is_stopped{false};
 
-    std::thread _thread;
-
-    ss::gate _gate;
-    internal::spsc_queue _tasks;
-
-    ss::timer<ss::lowres_clock> _watchdog;
+    std::vector<std::unique_ptr<shard_state>> _shards;
+    std::vector<std::unique_ptr<worker>> _workers;
 
     ss::shard_id _watchdog_shard;
+
+    internal::executor_probe _probe;
 };
 
 } // namespace v8_engine
@@ -18,6 +18,7 @@
 #include <seastar/core/temporary_buffer.hh>
 #include <seastar/util/later.hh>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <string_view>
@@ -25,8 +26,13 @@
 
 namespace v8_engine {
 
+// Scripts are created on every shard
+static std::atomic<size_t> next_script_id{0};
+
 script::script(size_t max_heap_size_in_bytes, size_t timeout_ms)
-  : _timeout_ms(timeout_ms) {
+  : _timeout_ms(timeout_ms)
+  , _executor_affinity(
+      next_script_id.fetch_add(1, std::memory_order_relaxed)) {
     v8::Isolate::CreateParams isolate_params;
     isolate_params.array_buffer_allocator_shared
       = std::shared_ptr<v8::ArrayBuffer::Allocator>(
@@ -73,8 +73,10 @@ public:
       ss::temporary_buffer<char> js_code,
       Executor& executor) {
         compile_task task(*this, std::move(js_code));
-        return add_future_handlers(
-                 executor.submit(std::move(task), _first_run_timeout_ms))
+        return add_future_handlers(executor.submit(
+                                     std::move(task),
+                                     _first_run_timeout_ms,
+                                     executor_affinity()))
           .then([this, name = std::move(name)] { set_function(name); });
     }
 
@@ -87,10 +89,32 @@ public:
     ss::future<> run(ss::temporary_buffer<char> data, Executor& executor) {
         run_task task(*this, std::move(data));
         return add_future_handlers(
-          executor.submit(std::move(task), _timeout_ms));
+          executor.submit(std::move(task), _timeout_ms, executor_affinity()));
+    }
+
+    /// Run function from js script for every buffer, as a single executor
+    /// task. Processing stops at the first failed run.
+    ///
+    /// \param data for js script, e.g. the records of a batch
+    /// \param executor for run script
+    template<typename Executor>
+    ss::future<>
+    run(std::vector<ss::temporary_buffer<char>> data, Executor& executor) {
+        std::vector<run_task> tasks;
+        tasks.reserve(data.size());
+        for (auto& buf : data) {
+            tasks.emplace_back(*this, std::move(buf));
+        }
+        return add_future_handlers(
+          executor.submit(std::move(tasks), _timeout_ms, executor_affinity()));
     }
 
 private:
+    // The isolate can be entered by one thread at a time, so all tasks of
+    // the script are routed to the same executor thread. Scripts are
+    // numbered in creation order to spread them evenly over the threads.
+    size_t executor_affinity() const { return _executor_affinity; }
+
     // Must be running in executor, because it runs js code
     // in first time for init global vars and e.t.c.
     void compile_script(ss::temporary_buffer<char> js_code);
@@ -139,6 +163,8 @@ private:
     // Script timeout
     std::chrono::milliseconds _timeout_ms;
 
+    size_t _executor_affinity;
+
     // This class implement task for executor. We need to add operator(),
     // cancel(), on_timeout()
 
@@ -21,6 +21,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
+#include <set>
+#include <thread>
 #include <unordered_map>
 
 class test_exception final : public std::exception {
@@ -194,3 +197,114 @@ SEASTAR_THREAD_TEST_CASE(stop_executor_with_finish_item_test) {
         }
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(batch_task_test) {
+    struct task_for_test {
+        explicit task_for_test(char& is_finish)
+          : _is_finish(&is_finish) {}
+
+        void operator()() {
+            if (_is_finish == nullptr) {
+                throw test_exception("Process exception");
+            }
+            *_is_finish = 1;
+        }
+
+        void cancel() {}
+
+        void on_timeout() {}
+
+        char* _is_finish;
+    };
+
+    v8_engine::executor test_executor(ss::engine().alien(), 1, ss::smp::count);
+
+    const size_t tasks_count = 10;
+    std::vector<char> finish_flags(tasks_count, 0);
+
+    std::vector<task_for_test> tasks;
+    for (auto& flag : finish_flags) {
+        tasks.emplace_back(flag);
+    }
+    test_executor.submit(std::move(tasks), std::chrono::milliseconds(5000))
+      .get();
+    for (auto flag : finish_flags) {
+        BOOST_REQUIRE_EQUAL(flag, 1);
+    }
+
+    // Processing stops at the first failed function
+    std::fill(finish_flags.begin(), finish_flags.end(), 0);
+    tasks.clear();
+    for (auto& flag : finish_flags) {
+        tasks.emplace_back(flag);
+    }
+    tasks[5]._is_finish = nullptr;
+
+    auto fut = test_executor.submit(
+      std::move(tasks), std::chrono::milliseconds(5000));
+    BOOST_REQUIRE_EXCEPTION(
+      fut.get(), test_exception, [](const test_exception& e) {
+          return "Process exception" == std::string(e.what());
+      });
+    for (size_t i = 0; i < tasks_count; ++i) {
+        BOOST_REQUIRE_EQUAL(finish_flags[i], i < 5 ? 1 : 0);
+    }
+
+    test_executor.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(multiple_workers_test) {
+    struct task_for_test {
+        explicit task_for_test(std::thread::id& thread_id)
+          : _thread_id(thread_id) {}
+
+        void operator()() { _thread_id = std::this_thread::get_id(); }
+
+        void cancel() {}
+
+        void on_timeout() {}
+
+        std::thread::id& _thread_id;
+    };
+
+    v8_engine::executor test_executor(
+      ss::engine().alien(), std::vector<unsigned>{1, 1, 1}, ss::smp::count);
+    BOOST_REQUIRE_EQUAL(test_executor.workers_count(), 3);
+
+    // Tasks with the same affinity run on the same thread
+    const size_t tasks_count = 12;
+    std::vector<std::thread::id> thread_ids(tasks_count);
+    std::vector<ss::future<>> futures;
+    futures.reserve(tasks_count);
+    for (size_t i = 0; i < tasks_count; ++i) {
+        futures.emplace_back(test_executor.submit(
+          task_for_test(thread_ids[i]), std::chrono::milliseconds(5000), i));
+    }
+    ss::when_all_succeed(futures.begin(), futures.end()).get();
+
+    std::set<std::thread::id> threads;
+    for (size_t i = 0; i < tasks_count; ++i) {
+        BOOST_REQUIRE_EQUAL(thread_ids[i], thread_ids[i % 3]);
+        threads.insert(thread_ids[i]);
+    }
+    BOOST_REQUIRE_EQUAL(threads.size(), 3);
+
+    test_executor.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(large_queue_size_test) {
+    struct task_for_test {
+        void operator()() {}
+
+        void cancel() {}
+
+        void on_timeout() {}
+    };
+
+    // Queue size is reduced to fit the thread queue
+    v8_engine::executor test_executor(
+      ss::engine().alien(), 1, std::numeric_limits<uint16_t>::max());
+    test_executor.submit(task_for_test(), std::chrono::milliseconds(5000))
+      .get();
+    test_executor.stop().get();
+}
@@ -22,6 +22,10 @@
 #include <boost/algorithm/string/case_conv.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <memory>
+#include <set>
+#include <vector>
+
 class executor_wrapper_for_test {
 public:
     executor_wrapper_for_test()
@@ -152,3 +156,50 @@ SEASTAR_THREAD_TEST_CASE(run_timeout_test) {
           return "Sript timeout" == std::string(e.what());
       });
 }
+
+// Forwards tasks to the executor and records the threads they are routed to
+class worker_recording_executor {
+public:
+    explicit worker_recording_executor(v8_engine::executor& executor)
+      : _executor(executor) {}
+
+    template<typename Task>
+    ss::future<> submit(
+      Task&& task, std::chrono::milliseconds timeout, size_t affinity) {
+        workers.insert(affinity % _executor.workers_count());
+        return _executor.submit(std::forward<Task>(task), timeout, affinity);
+    }
+
+    std::set<size_t> workers;
+
+private:
+    v8_engine::executor& _executor;
+};
+
+SEASTAR_THREAD_TEST_CASE(scripts_spread_over_workers_test) {
+    v8_engine::executor executor(
+      ss::engine().alien(), std::vector<unsigned>{1, 1}, ss::smp::count);
+    worker_recording_executor recorder(executor);
+
+    const size_t scripts_count = 4;
+    std::vector<std::unique_ptr<v8_engine::script>> scripts;
+    for (size_t i = 0; i < scripts_count; ++i) {
+        auto& script = scripts.emplace_back(
+          std::make_unique<v8_engine::script>(100, TIMEOUT_FOR_TEST_MS));
+        ss::temporary_buffer<char> js_code
+          = read_fully_tmpbuf("to_upper.js").get();
+        script->init("to_upper", std::move(js_code), recorder).get();
+
+        ss::sstring raw_data = "qwerty";
+        ss::temporary_buffer<char> data(raw_data.data(), raw_data.size());
+        script->run(data.share(), recorder).get();
+        BOOST_REQUIRE_EQUAL(
+          std::string(data.get_write(), data.size()), "QWERTY");
+    }
+
+    // Every thread of the executor gets its share of the scripts
+    BOOST_REQUIRE_EQUAL(recorder.workers.size(), executor.workers_count());
+
+    scripts.clear();
+    executor.stop().get();
+}